@@ -0,0 +1,97 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file BenchmarkCola2.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/cola2/Cola2.h"
+#include "sick_safetyscanners_base/communication/TCPClient.h"
+
+#include <benchmark/benchmark.h>
+
+namespace sick {
+namespace benchmarks {
+
+namespace {
+
+// The session is never opened, constructing telegrams does not need a connection.
+sick::communication::TCPClientPtr createTCPClient()
+{
+  return sick::make_unique<sick::communication::TCPClient>(
+    boost::asio::ip::address_v4::from_string("127.0.0.1"), 2122);
+}
+
+void BM_ConstructVariableTelegram(benchmark::State& state)
+{
+  sick::cola2::Cola2Session session(createTCPClient());
+  sick::datastructure::TypeCode type_code;
+  sick::cola2::TypeCodeVariableCommand command(session, type_code);
+  std::vector<uint8_t> telegram;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(command.constructTelegram(telegram));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ConstructIndexedVariableTelegram(benchmark::State& state)
+{
+  sick::cola2::Cola2Session session(createTCPClient());
+  sick::datastructure::FieldData field_data;
+  sick::cola2::FieldGeometryVariableCommand command(session, field_data, 17);
+  std::vector<uint8_t> telegram;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(command.constructTelegram(telegram));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ConstructMethodTelegram(benchmark::State& state)
+{
+  sick::cola2::Cola2Session session(createTCPClient());
+  sick::datastructure::CommSettings settings;
+  sick::cola2::ChangeCommSettingsCommand command(session, settings);
+  std::vector<uint8_t> telegram;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(command.constructTelegram(telegram));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_ConstructVariableTelegram);
+BENCHMARK(BM_ConstructIndexedVariableTelegram);
+BENCHMARK(BM_ConstructMethodTelegram);
+
+} // namespace benchmarks
+} // namespace sick
@@ -0,0 +1,81 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file BenchmarkFieldEvaluator.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/FieldEvaluator.h"
+
+#include <benchmark/benchmark.h>
+
+namespace sick {
+namespace benchmarks {
+
+namespace {
+
+// Contours shaped like the fields of the sensor, which span 275 degrees from -47.5 degrees.
+std::vector<sick::datastructure::FieldData> createFields(std::size_t number_of_fields)
+{
+  std::vector<sick::datastructure::FieldData> fields(number_of_fields);
+  for (std::size_t i = 0; i < number_of_fields; i++)
+  {
+    sick::datastructure::FieldData& field = fields[i];
+    field.setIsValid(true);
+    field.setIsDefined(true);
+    field.setIsProtectiveField(i % 2 == 0);
+    field.setIsWarningField(i % 2 != 0);
+    field.setStartAngleDegrees(-47.5f);
+    field.setAngularBeamResolutionDegrees(0.5f);
+    field.setBeamDistances(std::vector<uint16_t>(551, static_cast<uint16_t>(500 + 250 * i)));
+  }
+  return fields;
+}
+
+void BM_EvaluateFields(benchmark::State& state)
+{
+  sick::datastructure::Data data = tools::parsedTelegram(2751);
+  sick::data_processing::FieldEvaluator evaluator(createFields(state.range(0)));
+  std::vector<sick::data_processing::FieldEvaluation> evaluations;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(evaluator.evaluate(data, evaluations));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_EvaluateFields)->Arg(1)->Arg(4)->Arg(16);
+
+} // namespace benchmarks
+} // namespace sick
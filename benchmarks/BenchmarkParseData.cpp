@@ -0,0 +1,170 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file BenchmarkParseData.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/ParseApplicationData.h"
+#include "sick_safetyscanners_base/data_processing/ParseData.h"
+#include "sick_safetyscanners_base/data_processing/ParseIntrusionData.h"
+#include "sick_safetyscanners_base/data_processing/ParseMeasurementData.h"
+
+#include <benchmark/benchmark.h>
+
+namespace sick {
+namespace benchmarks {
+
+namespace {
+
+const sick::types::SensorFeatures MEASUREMENT_ONLY =
+  sick::SensorDataFeatures::DERIVED_SETTINGS | sick::SensorDataFeatures::MEASUREMENT_DATA;
+const sick::types::SensorFeatures INTRUSION_ONLY =
+  sick::SensorDataFeatures::DERIVED_SETTINGS | sick::SensorDataFeatures::INTRUSION_DATA;
+
+void addBeamCounts(benchmark::internal::Benchmark* benchmark,
+                   const std::vector<sick::types::SensorFeatures>& features)
+{
+  for (sick::types::SensorFeatures feature : features)
+  {
+    for (int beams : {1, 541, 1101, 2751})
+    {
+      benchmark->Args({beams, feature});
+    }
+  }
+}
+
+void ParseDataArguments(benchmark::internal::Benchmark* benchmark)
+{
+  addBeamCounts(benchmark,
+                {sick::SensorDataFeatures::GENERAL_SYSTEM_STATE,
+                 MEASUREMENT_ONLY,
+                 INTRUSION_ONLY,
+                 sick::SensorDataFeatures::ALL});
+}
+
+void BM_ParseData(benchmark::State& state)
+{
+  sick::datastructure::PacketBuffer buffer(
+    tools::createTelegram(static_cast<uint16_t>(state.range(0)),
+                   static_cast<sick::types::SensorFeatures>(state.range(1)),
+                   1));
+  sick::data_processing::ParseData parser;
+  sick::datastructure::Data data;
+  for (auto _ : state)
+  {
+    parser.parseUDPSequence(buffer, data);
+    benchmark::DoNotOptimize(data);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * buffer.getLength());
+}
+
+void BM_ParseDataNewInstance(benchmark::State& state)
+{
+  sick::datastructure::PacketBuffer buffer(
+    tools::createTelegram(static_cast<uint16_t>(state.range(0)),
+                   static_cast<sick::types::SensorFeatures>(state.range(1)),
+                   1));
+  sick::data_processing::ParseData parser;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(parser.parseUDPSequence(buffer));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * buffer.getLength());
+}
+
+void BM_ParseIntrusionData(benchmark::State& state)
+{
+  sick::datastructure::PacketBuffer buffer(
+    tools::createTelegram(static_cast<uint16_t>(state.range(0)), sick::SensorDataFeatures::ALL, 1));
+  sick::datastructure::Data data;
+  sick::data_processing::ParseData().parseUDPSequence(buffer, data);
+  sick::data_processing::ParseIntrusionData parser;
+  sick::datastructure::IntrusionData intrusion_data;
+  for (auto _ : state)
+  {
+    parser.parseUDPSequence(buffer, data, intrusion_data);
+    benchmark::DoNotOptimize(intrusion_data);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ParseMeasurementRegions(benchmark::State& state)
+{
+  sick::datastructure::PacketBuffer buffer(
+    tools::createTelegram(2751, sick::SensorDataFeatures::ALL, 1));
+  sick::datastructure::Data data;
+  sick::data_processing::ParseData().parseUDPSequence(buffer, data);
+  // A front sector, a decimated full scan and a distance band
+  std::vector<sick::data_processing::BeamRegion> regions(3);
+  regions[0].start_angle  = -45.0f;
+  regions[0].end_angle    = 45.0f;
+  regions[1].stride       = static_cast<uint32_t>(state.range(0));
+  regions[2].min_distance = 500;
+  regions[2].max_distance = 5000;
+  sick::data_processing::ParseMeasurementData parser;
+  std::vector<sick::datastructure::MeasurementData> measurement_data;
+  for (auto _ : state)
+  {
+    parser.parseUDPSequence(buffer, data, regions, measurement_data);
+    benchmark::DoNotOptimize(measurement_data);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ParseApplicationData(benchmark::State& state)
+{
+  sick::datastructure::PacketBuffer buffer(
+    tools::createTelegram(541, sick::SensorDataFeatures::ALL, 1));
+  sick::datastructure::Data data;
+  sick::data_processing::ParseData().parseUDPSequence(buffer, data);
+  sick::data_processing::ParseApplicationData parser;
+  sick::datastructure::ApplicationData application_data;
+  for (auto _ : state)
+  {
+    parser.parseUDPSequence(buffer, data, application_data);
+    benchmark::DoNotOptimize(application_data);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_ParseData)->Apply(ParseDataArguments);
+BENCHMARK(BM_ParseDataNewInstance)->Apply(ParseDataArguments);
+BENCHMARK(BM_ParseIntrusionData)->Arg(1)->Arg(541)->Arg(1101)->Arg(2751);
+BENCHMARK(BM_ParseMeasurementRegions)->Arg(2)->Arg(4);
+BENCHMARK(BM_ParseApplicationData);
+
+} // namespace benchmarks
+} // namespace sick
@@ -0,0 +1,64 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file BenchmarkPointCloud.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/PointCloudConverter.h"
+
+#include <benchmark/benchmark.h>
+
+namespace sick {
+namespace benchmarks {
+
+namespace {
+
+void BM_ConvertPointCloud(benchmark::State& state)
+{
+  sick::datastructure::Data data = tools::parsedTelegram(static_cast<uint16_t>(state.range(0)));
+  sick::data_processing::PointCloudConverter converter(
+    sick::data_processing::PlanarTransform(0.5f, -0.25f, 0.3f));
+  std::vector<sick::data_processing::CartesianPoint> points(state.range(0));
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(converter.convert(data, points.data(), points.size()));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_ConvertPointCloud)->Arg(1)->Arg(541)->Arg(1101)->Arg(2751);
+
+} // namespace benchmarks
+} // namespace sick
@@ -0,0 +1,126 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file BenchmarkUDPPacketMerger.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/UDPPacketMerger.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+namespace sick {
+namespace benchmarks {
+
+namespace {
+
+enum FragmentOrder
+{
+  IN_ORDER,
+  OUT_OF_ORDER,
+  DUPLICATED
+};
+
+std::vector<sick::datastructure::PacketBuffer> createScanDatagrams(uint16_t number_of_beams,
+                                                                   FragmentOrder order)
+{
+  std::vector<sick::datastructure::PacketBuffer> datagrams = tools::createDatagrams(
+    tools::createTelegram(number_of_beams, sick::SensorDataFeatures::ALL, 1), 1);
+  if (order == OUT_OF_ORDER)
+  {
+    std::reverse(datagrams.begin(), datagrams.end());
+  }
+  else if (order == DUPLICATED)
+  {
+    // Every fragment but the last arrives twice, a duplicate after completion would start a new
+    // telegram.
+    std::vector<sick::datastructure::PacketBuffer> duplicated;
+    for (std::size_t i = 0; i + 1 < datagrams.size(); i++)
+    {
+      duplicated.push_back(datagrams[i]);
+      duplicated.push_back(datagrams[i]);
+    }
+    duplicated.push_back(datagrams.back());
+    datagrams.swap(duplicated);
+  }
+  return datagrams;
+}
+
+void benchmarkAddUDPPacket(benchmark::State& state, FragmentOrder order)
+{
+  std::vector<sick::datastructure::PacketBuffer> datagrams =
+    createScanDatagrams(static_cast<uint16_t>(state.range(0)), order);
+  sick::data_processing::UDPPacketMerger merger;
+  std::size_t bytes = 0;
+  for (const auto& datagram : datagrams)
+  {
+    bytes += datagram.getLength();
+  }
+
+  for (auto _ : state)
+  {
+    for (const auto& datagram : datagrams)
+    {
+      if (merger.addUDPPacket(datagram))
+      {
+        benchmark::DoNotOptimize(merger.getDeployedPacketBuffer());
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+void BM_UDPPacketMergerInOrder(benchmark::State& state)
+{
+  benchmarkAddUDPPacket(state, IN_ORDER);
+}
+
+void BM_UDPPacketMergerOutOfOrder(benchmark::State& state)
+{
+  benchmarkAddUDPPacket(state, OUT_OF_ORDER);
+}
+
+void BM_UDPPacketMergerDuplicated(benchmark::State& state)
+{
+  benchmarkAddUDPPacket(state, DUPLICATED);
+}
+
+} // namespace
+
+BENCHMARK(BM_UDPPacketMergerInOrder)->Arg(541)->Arg(1101)->Arg(2751);
+BENCHMARK(BM_UDPPacketMergerOutOfOrder)->Arg(541)->Arg(1101)->Arg(2751);
+BENCHMARK(BM_UDPPacketMergerDuplicated)->Arg(541)->Arg(1101)->Arg(2751);
+
+} // namespace benchmarks
+} // namespace sick
@@ -37,7 +37,9 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_GENERICS_H
 #define SICK_SAFETYSCANNERS_BASE_GENERICS_H
 
+#include <cstddef>
 #include <memory>
+#include <type_traits>
 
 namespace sick {
 
@@ -57,5 +59,58 @@ std::unique_ptr<T> make_unique(Ts&&... params)
   return std::unique_ptr<T>(new T(std::forward<Ts>(params)...));
 }
 
+/*!
+ * \brief Non-owning view of a contiguous sequence of elements.
+ *
+ * C++11 does not come with std::span, so this is a minimal replacement. The viewed memory has to
+ * outlive the span.
+ */
+template <typename T>
+class Span
+{
+public:
+  using value_type     = typename std::remove_cv<T>::type;
+  using iterator       = T*;
+  using const_iterator = const T*;
+
+  Span()
+    : m_data(nullptr)
+    , m_size(0)
+  {
+  }
+
+  Span(T* data, std::size_t size)
+    : m_data(data)
+    , m_size(size)
+  {
+  }
+
+  template <typename Container>
+  Span(Container& container)
+    : m_data(container.data())
+    , m_size(container.size())
+  {
+  }
+
+  T* data() const { return m_data; }
+  std::size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  T* begin() const { return m_data; }
+  T* end() const { return m_data + m_size; }
+  T& operator[](std::size_t index) const { return m_data[index]; }
+
+  /*!
+   * \brief Returns a view of count elements starting at offset.
+   */
+  Span subspan(std::size_t offset, std::size_t count) const
+  {
+    return Span(m_data + offset, count);
+  }
+
+private:
+  T* m_data;
+  std::size_t m_size;
+};
+
 } // namespace sick
 #endif // SICK_SAFETYSCANNERS_BASE_GENERICS_H
\ No newline at end of file
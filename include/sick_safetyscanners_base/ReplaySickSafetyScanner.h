@@ -0,0 +1,134 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ReplaySickSafetyScanner.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_REPLAYSICKSAFETYSCANNER_H
+#define SICK_SAFETYSCANNERS_BASE_REPLAYSICKSAFETYSCANNER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "sick_safetyscanners_base/Types.h"
+#include "sick_safetyscanners_base/communication/CaptureFile.h"
+#include "sick_safetyscanners_base/data_processing/ParseData.h"
+#include "sick_safetyscanners_base/data_processing/UDPPacketMerger.h"
+#include "sick_safetyscanners_base/datastructure/DataPool.h"
+
+namespace sick {
+
+/*!
+ * \brief Pace at which a capture is replayed.
+ */
+enum class ReplayPace
+{
+  //! Datagrams are passed on with the time differences they were received with.
+  RECORDED,
+  //! Datagrams are passed on as fast as they can be processed.
+  MAXIMUM
+};
+
+/*!
+ * \brief Replays a capture recorded with SickSafetyscannersBase::startCapture() without a sensor.
+ * The datagrams run through the same packet merger and parser as received ones, every complete
+ * scan is passed to the callback.
+ */
+class ReplaySickSafetyScanner
+{
+public:
+  ReplaySickSafetyScanner()                               = delete;
+  ReplaySickSafetyScanner(const ReplaySickSafetyScanner&) = delete;
+  ReplaySickSafetyScanner& operator=(const ReplaySickSafetyScanner&) = delete;
+
+  /*!
+   * \brief Constructor of the replay, opens the capture. Throws a runtime error if the capture
+   * cannot be opened.
+   *
+   * \param path Path of the capture file.
+   * \param callback Callback called for every complete scan.
+   * \param parse_features Bitset of the blocks to parse immediately, see sick::SensorDataFeatures.
+   */
+  ReplaySickSafetyScanner(const std::string& path,
+                          sick::types::ScanDataCb callback,
+                          sick::types::SensorFeatures parse_features = SensorDataFeatures::ALL);
+
+  /*!
+   * \brief Replays the capture from its beginning. Blocks until the end of the capture is
+   * reached or stop() is called. Datagrams keep their recorded receive times, when replayed at the
+   * recorded pace these are shifted to the start of the replay.
+   *
+   * \param pace The pace the capture is replayed at.
+   */
+  void run(ReplayPace pace = ReplayPace::RECORDED);
+
+  /*!
+   * \brief Stops a running replay, can be called from any thread.
+   */
+  void stop();
+
+  /*!
+   * \brief Returns the number of datagrams replayed by the last run.
+   *
+   * \returns The number of datagrams.
+   */
+  uint64_t getNumberOfDatagrams() const;
+
+  /*!
+   * \brief Returns the number of complete scans passed to the callback by the last run.
+   *
+   * \returns The number of scans.
+   */
+  uint64_t getNumberOfScans() const;
+
+private:
+  sick::communication::CaptureReader m_reader;
+  sick::types::ScanDataCb m_scan_data_cb;
+  sick::data_processing::UDPPacketMerger m_packet_merger;
+  sick::data_processing::ParseData m_data_parser;
+  sick::datastructure::DataPool m_data_pool;
+  std::shared_ptr<std::vector<uint8_t>> m_datagram;
+  std::atomic<bool> m_stopped;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::atomic<uint64_t> m_number_of_datagrams;
+  std::atomic<uint64_t> m_number_of_scans;
+
+  bool waitUntil(const std::chrono::steady_clock::time_point& time_point);
+  void processDatagram(const sick::communication::CaptureRecord& record, int64_t receive_offset);
+};
+
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_REPLAYSICKSAFETYSCANNER_H
@@ -0,0 +1,164 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ScannerGroup.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_SCANNERGROUP_H
+#define SICK_SAFETYSCANNERS_BASE_SCANNERGROUP_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+
+#include "sick_safetyscanners_base/SickSafetyscanners.h"
+#include "sick_safetyscanners_base/Types.h"
+#include "sick_safetyscanners_base/data_processing/ClockAlignment.h"
+
+namespace sick {
+
+/*!
+ * \brief Runs several asynchronous sensors on one shared pool of worker threads.
+ *
+ * All sensors of the group share a single io_service, so the number of threads does not scale with
+ * the number of sensors. The handlers of each sensor are serialized on its own strand, hence the
+ * callback of a sensor is never invoked concurrently with itself, while different sensors are
+ * processed in parallel. Every scan is passed to the callback of its sensor together with its
+ * sensor timestamp aligned to the monotonic host clock, which makes scans of different sensors
+ * comparable. The alignment uses the time the kernel received the first datagram of the scan, so
+ * parsing and queueing do not add to it. Exceptions thrown by a callback are logged and the sensor
+ * keeps receiving.
+ */
+class ScannerGroup
+{
+public:
+  /*!
+   * \brief Deleted default, copy and copy-assignment constructors.
+   *
+   */
+  ScannerGroup()                    = delete;
+  ScannerGroup(const ScannerGroup&) = delete;
+  ScannerGroup& operator=(const ScannerGroup&) = delete;
+
+  /*!
+   * \brief Constructor of the scanner group, starts the worker threads.
+   *
+   * \param num_threads Number of worker threads processing the data of all sensors, at least one.
+   * \param cpu_ids CPUs the worker threads are pinned to, assigned round robin. Empty for no
+   * pinning. Pinning is only supported on Linux.
+   */
+  explicit ScannerGroup(std::size_t num_threads, const std::vector<int>& cpu_ids = {});
+
+  /*!
+   * \brief Destructor, stops all sensors and joins the worker threads.
+   *
+   */
+  ~ScannerGroup();
+
+  /*!
+   * \brief Adds a sensor to the group. Its COLA2 API is available through the returned scanner.
+   *
+   * \param sensor_ip The IP4 address of the sensor.
+   * \param sensor_tcp_port The TCP port of the sensor (COLA2).
+   * \param comm_settings A CommSettings object containing parameters to be sent to the sensor.
+   * \param callback A callback to process incomming sensor data with its aligned timestamp.
+   *
+   * \returns The scanner of the sensor, owned by the group.
+   */
+  AsyncSickSafetyScanner& addSensor(sick::types::ip_address_t sensor_ip,
+                                    sick::types::port_t sensor_tcp_port,
+                                    CommSettings comm_settings,
+                                    sick::types::AlignedScanDataCb callback);
+
+  /*!
+   * \brief Returns the number of sensors in the group.
+   *
+   * \returns The number of sensors.
+   */
+  std::size_t getNumberOfSensors() const;
+
+  /*!
+   * \brief Returns the number of worker threads of the group.
+   *
+   * \returns The number of worker threads.
+   */
+  std::size_t getNumberOfThreads() const;
+
+  /*!
+   * \brief Starts to receive sensor data of all sensors in the group.
+   *
+   * \param batch_size If greater than zero, the sensors receive in batches of datagrams, see
+   * AsyncSickSafetyScanner::runBatched().
+   */
+  void run(std::size_t batch_size = 0);
+
+  /*!
+   * \brief Stops receiving sensor data of all sensors in the group. The worker threads keep running
+   * until the group is destroyed.
+   *
+   */
+  void stop();
+
+private:
+  struct Sensor
+  {
+    std::unique_ptr<AsyncSickSafetyScanner> scanner;
+    sick::types::AlignedScanDataCb callback;
+    sick::data_processing::ClockAlignment clock_alignment;
+  };
+
+  boost::asio::io_service m_io_service;
+  std::unique_ptr<boost::asio::io_service::work> m_work;
+  std::vector<boost::thread> m_threads;
+  std::vector<std::unique_ptr<Sensor>> m_sensors;
+  mutable std::mutex m_sensors_mutex;
+
+  /*!
+   * \brief Runs the io_service until the group is destroyed. Exceptions thrown while processing the
+   * data of a sensor are logged, the other sensors keep running.
+   *
+   */
+  void runWorker();
+
+  /*!
+   * \brief Pins a worker thread to a CPU.
+   *
+   * \param thread The worker thread.
+   * \param cpu_id The CPU to pin the thread to.
+   */
+  static void pinThread(boost::thread& thread, int cpu_id);
+};
+
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_SCANNERGROUP_H
@@ -38,10 +38,12 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_SICKSAFETYSCANNERS_H
 #define SICK_SAFETYSCANNERS_BASE_SICKSAFETYSCANNERS_H
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -53,9 +55,15 @@
 #include "sick_safetyscanners_base/Logging.h"
 #include "sick_safetyscanners_base/Types.h"
 
+#include "sick_safetyscanners_base/communication/CaptureFile.h"
 #include "sick_safetyscanners_base/communication/TCPClient.h"
 #include "sick_safetyscanners_base/communication/UDPClient.h"
+#include "sick_safetyscanners_base/data_processing/ConfigurationCache.h"
+#include "sick_safetyscanners_base/data_processing/IncrementalMeasurementDecoder.h"
+#include "sick_safetyscanners_base/data_processing/LatencyRecorder.h"
 #include "sick_safetyscanners_base/data_processing/ParseData.h"
+#include "sick_safetyscanners_base/data_processing/PriorityBlockDecoder.h"
+#include "sick_safetyscanners_base/data_processing/SequenceTracker.h"
 #include "sick_safetyscanners_base/data_processing/UDPPacketMerger.h"
 
 #include "sick_safetyscanners_base/cola2/Cola2Session.h"
@@ -134,6 +142,11 @@ public:
    */
   // virtual ~SickSafetyscannersBase();
 
+  /*!
+   * \brief Destructor, closes a COLA2 session kept open.
+   */
+  ~SickSafetyscannersBase();
+
   /*!
    * \brief Changes the internal settings of the sensor.
    * \param settings New set of settings to pass to the sensor.
@@ -260,11 +273,131 @@ public:
    */
   void requestMonitoringCases(std::vector<MonitoringCaseData>& monitoring_cases);
 
+  /*!
+   * \brief Requests all static metadata and the configuration of the sensor at once. All items
+   * are requested pipelined over a single session instead of one session per item.
+   *
+   * \param snapshot Returned metadata and configuration, including the timing of every item.
+   */
+  void requestSensorSnapshot(datastructure::SensorSnapshot& snapshot);
+
+  /*!
+   * \brief Requests the field data and monitoring cases using an on-disk cache. Only the serial
+   * number and the configuration metadata are requested if the cache entry of the sensor matches,
+   * otherwise the data is requested from the sensor and the cache entry is replaced.
+   *
+   * \param cache The configuration cache.
+   * \param field_data Returned field data.
+   * \param monitoring_cases Returned monitoring cases.
+   *
+   * \returns If the data was taken from the cache.
+   */
+  bool requestCachedConfiguration(const data_processing::ConfigurationCache& cache,
+                                  std::vector<FieldData>& field_data,
+                                  std::vector<MonitoringCaseData>& monitoring_cases);
+
+  /*!
+   * \brief Returns the number of sensor data datagrams dropped by the kernel because the receive
+   * queue of the UDP socket overflowed. Only available on Linux when receiving asynchronously.
+   *
+   * \return The number of dropped datagrams.
+   */
+  uint32_t getKernelDropCount() const;
+
+  /*!
+   * \brief Sets the data blocks which are parsed as soon as a scan is received. All other blocks
+   * are parsed from the retained raw data on first access. This is independent of the features
+   * requested from the sensor in the CommSettings.
+   *
+   * \param parse_features Bitset of the blocks, see sick::SensorDataFeatures.
+   */
+  void setParseFeatures(sick::types::SensorFeatures parse_features);
+
+  /*!
+   * \brief Returns the data blocks which are parsed as soon as a scan is received.
+   *
+   * \return Bitset of the blocks, see sick::SensorDataFeatures.
+   */
+  sick::types::SensorFeatures getParseFeatures() const;
+
+  /*!
+   * \brief Restricts the measurement data of the following scans to the beams of a region. Beams
+   * outside the region are not decoded, which saves parsing time if only a sector is of interest.
+   *
+   * \param region The region of the beams to decode, see sick::data_processing::BeamRegion.
+   */
+  void setBeamRegion(const sick::data_processing::BeamRegion& region);
+
+  /*!
+   * \brief Decodes all beams of the measurement data of the following scans again.
+   */
+  void clearBeamRegion();
+
+  /*!
+   * \brief Keeps one COLA2 session open across requests instead of opening and closing a session
+   * for every single request. The session is reopened transparently if the sensor dropped it.
+   *
+   * \param keep_alive Whether to keep the session open.
+   */
+  void setSessionKeepAlive(bool keep_alive);
+
+  /*!
+   * \brief Returns whether one COLA2 session is kept open across requests.
+   *
+   * \return true The session is kept open.
+   */
+  bool getSessionKeepAlive() const;
+
+  /*!
+   * \brief Starts recording all received sensor data datagrams with their receive timestamps to a
+   * capture file, which can be replayed by sick::ReplaySickSafetyScanner. A running capture is
+   * stopped first.
+   *
+   * \param path Path of the capture file, an existing file is overwritten.
+   */
+  void startCapture(const std::string& path);
+
+  /*!
+   * \brief Stops recording datagrams and closes the capture file.
+   */
+  void stopCapture();
+
+  /*!
+   * \brief Returns the latencies of the stages the received scans passed on the host, from the
+   * kernel receiving their datagrams until the callback returned. Can be called from any thread.
+   *
+   * \returns Summaries of the latency histograms of every stage.
+   */
+  sick::datastructure::LatencyStatistics getStatistics() const;
+
+  /*!
+   * \brief Discards the latencies recorded so far.
+   */
+  void resetStatistics();
+
+  /*!
+   * \brief Returns the health counters of the sensor data stream: lost, duplicated, reordered and
+   * late fragments, evicted partial scans, skipped scan and sequence numbers and the memory used
+   * for reassembly. Can be called from any thread.
+   *
+   * \returns The stream counters.
+   */
+  sick::datastructure::StreamCounters getStreamCounters() const;
+
+  /*!
+   * \brief Sets when partially received scans are discarded.
+   *
+   * \param identification_window Number of scans a partial scan may fall behind the newest one.
+   * \param max_age Maximum time a partial scan waits for its missing fragments.
+   */
+  void setEvictionPolicy(uint32_t identification_window, sick::types::time_duration_t max_age);
+
 private:
   sick::types::ip_address_t m_sensor_ip;
   sick::types::port_t m_sensor_tcp_port;
   CommSettings m_comm_settings;
   bool m_is_initialized;
+  bool m_session_keep_alive;
   std::unique_ptr<boost::asio::io_service> m_io_service_ptr;
 
   /*!
@@ -277,17 +410,61 @@ private:
   template <class CommandT, typename... Args>
   void inline createAndExecuteCommand(Args&&... args)
   {
-    m_session.open();
-    CommandT cmd(std::forward<Args>(args)...);
-    m_session.sendCommand(cmd);
-    m_session.close();
+    executeInSession([&]() {
+      CommandT cmd(std::forward<Args>(args)...);
+      m_session.sendCommand(cmd);
+    });
   }
 
+  /*!
+   * \brief Executes a function sending commands within an open COLA2 session. Without keep alive
+   * the session is opened before and closed afterwards. With keep alive the current session is
+   * reused and the function is retried once in a new session if the reused one failed.
+   *
+   * \param function Function sending the commands, may be called twice.
+   */
+  void executeInSession(const std::function<void()>& function);
+
 protected:
   boost::asio::io_service& m_io_service;
   sick::communication::UDPClient m_udp_client;
   sick::cola2::Cola2Session m_session;
   sick::data_processing::UDPPacketMerger m_packet_merger;
+  std::atomic<sick::types::SensorFeatures> m_parse_features;
+  std::atomic<bool> m_has_beam_region;
+  std::mutex m_beam_region_mutex;
+  sick::data_processing::BeamRegion m_beam_region;
+  sick::data_processing::ParseData m_data_parser;
+  sick::data_processing::IncrementalMeasurementDecoder m_measurement_decoder;
+  sick::data_processing::PriorityBlockDecoder m_priority_decoder;
+  std::atomic<bool> m_is_capturing;
+  std::mutex m_capture_mutex;
+  std::unique_ptr<sick::communication::CaptureWriter> m_capture_writer;
+  sick::data_processing::LatencyRecorder m_latency_recorder;
+  sick::data_processing::SequenceTracker m_sequence_tracker;
+
+  /*!
+   * \brief Records a received datagram if a capture is running.
+   *
+   * \param buffer The received datagram.
+   */
+  void captureDatagram(const sick::datastructure::PacketBuffer& buffer);
+
+  /*!
+   * \brief Decodes the measurement data and the priority blocks of a data packet while its
+   * fragments arrive.
+   *
+   * \param buffer The partially received data packet.
+   * \param progress The fragment which was added to the data packet.
+   */
+  void decodePartialPacket(const sick::datastructure::PacketBuffer& buffer,
+                           const sick::datastructure::PacketProgress& progress);
+
+  /*!
+   * \brief Applies the parse features and the beam region to the data parser before a scan is
+   * parsed.
+   */
+  void configureDataParser();
 };
 
 /*!
@@ -368,13 +545,69 @@ public:
    */
   void run();
 
+  /*!
+   * \brief Starts to receive sensor data via UDP like run(), but drains the socket in batches of
+   * datagrams with a single system call each (recvmmsg on Linux). This reduces system calls and
+   * wakeups, since a scan arrives as a burst of fragments.
+   *
+   * \param batch_size The maximum number of datagrams read with one system call.
+   */
+  void runBatched(std::size_t batch_size = sick::communication::UDPClient::DEFAULT_BATCH_SIZE);
+
   /*!
    * \brief Stops receiving and processing sensor data.
    *
    */
   void stop();
 
+  /*!
+   * \brief Default number of scans buffered between receiving and the callback in decoupled
+   * delivery.
+   */
+  static const std::size_t DEFAULT_DELIVERY_CAPACITY = 8;
+
+  /*!
+   * \brief Decouples the callback from receiving. Parsed scans are handed over through a bounded
+   * lock-free ring to an internal delivery thread which invokes the callback, so a slow callback
+   * never stalls reading the socket.
+   *
+   * \param capacity Maximum number of scans waiting for the callback, rounded up to a power of
+   * two and at least two.
+   * \param policy Whether the oldest waiting or the newest scan is dropped if the ring is full.
+   *
+   * \throws sick::runtime_error If the scanner was already started with run() or runBatched().
+   */
+  void enableDecoupledDelivery(
+    std::size_t capacity = DEFAULT_DELIVERY_CAPACITY,
+    sick::datastructure::OverflowPolicy policy = sick::datastructure::OverflowPolicy::DROP_OLDEST);
+
+  /*!
+   * \brief Returns the counters of the decoupled delivery, all zero if it is not enabled.
+   *
+   * \returns Number of scans handed over, delivered and dropped.
+   */
+  sick::datastructure::RingCounters getDeliveryCounters() const;
+
+  /*!
+   * \brief Sets a callback which receives the safety state of a scan before the scan is complete.
+   *
+   * The callback is invoked on the receiving thread as soon as the fragments holding the data
+   * header and the given blocks arrived, and always before the callback of the full scan. Its data
+   * only holds the data header and these blocks.
+   *
+   * \param callback The callback, an empty function disables it.
+   * \param blocks Bitset of the blocks to wait for, see sick::SensorDataFeatures. Supported are the
+   * general system state, the application data and the derived values.
+   *
+   * \throws sick::runtime_error If the scanner was already started with run() or runBatched().
+   */
+  void setPriorityCallback(
+    sick::types::ScanDataCb callback,
+    sick::types::SensorFeatures blocks = sick::SensorDataFeatures::GENERAL_SYSTEM_STATE);
+
 private:
+  struct DecoupledDelivery;
+
   /*!
    * \brief Merges incomming UDP packets and calls the callback function as passed via the
    * constructor.
@@ -383,10 +616,53 @@ private:
    */
   void processUDPPacket(const sick::datastructure::PacketBuffer& buffer);
 
+  /*!
+   * \brief Merges a batch of incomming UDP packets and calls the callback function for every
+   * completed scan.
+   *
+   * \param batch Returned batch of packet buffers.
+   */
+  void processUDPPacketBatch(const std::vector<sick::datastructure::PacketBuffer>& batch);
+
+  /*!
+   * \brief Calls the callback function and records the latencies of delivery and callback.
+   *
+   * \param data The parsed scan.
+   * \param receive_time The time the first datagram of the scan was received.
+   * \param parsed_time The time parsing the scan was finished.
+   */
+  void invokeCallback(const sick::datastructure::Data& data,
+                      int64_t receive_time,
+                      int64_t parsed_time);
+
+  /*!
+   * \brief Loop of the delivery thread, passes the scans from the ring to the callback.
+   *
+   */
+  void deliverScans();
+
+  /*!
+   * \brief Calls the priority callback if the blocks of a scan were decoded early.
+   *
+   */
+  void dispatchPriorityData();
+
+  /*!
+   * \brief Throws if the scanner was started, the receiving thread reads the delivery settings
+   * without locking.
+   *
+   * \param function Name of the function for the error message.
+   */
+  void requireNotRunning(const char* function) const;
+
   sick::types::ScanDataCb m_scan_data_cb;
+  sick::types::ScanDataCb m_priority_cb;
   std::unique_ptr<boost::asio::io_service> m_io_service_ptr;
   boost::thread m_service_thread;
   std::unique_ptr<boost::asio::io_service::work> m_work;
+  sick::datastructure::DataPool m_data_pool;
+  std::unique_ptr<DecoupledDelivery> m_delivery;
+  std::atomic<bool> m_is_running;
 };
 
 /*!
@@ -422,6 +698,16 @@ public:
    * \return const Data Returned sensor data.
    */
   const Data receive(sick::types::time_duration_t timeout = boost::posix_time::pos_infin);
+
+  /*!
+   * \brief Blocking call to receive one sensor data message into an existing instance. Blocks of
+   * the instance which are not referenced elsewhere are reused, so that repeatedly receiving into
+   * the same instance does not allocate. Throws an exception if the timeout is exceeded.
+   *
+   * \param data The instance the sensor data is parsed into.
+   * \param timeout Timeout in [seconds].
+   */
+  void receive(Data& data, sick::types::time_duration_t timeout = boost::posix_time::pos_infin);
 };
 } // namespace sick
 
@@ -37,9 +37,12 @@
 
 #include "sick_safetyscanners_base/datastructure/Data.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+#include "sick_safetyscanners_base/datastructure/PacketProgress.h"
 #include <boost/asio/ip/address_v4.hpp>
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace sick {
 namespace types {
@@ -56,6 +59,20 @@ using ScanDataCb = std::function<void(const sick::datastructure::Data&)>;
  */
 using PacketHandler = std::function<void(const sick::datastructure::PacketBuffer&)>;
 
+/*!
+ * \brief Handler for the progress of a data packet which is still reassembled.
+ *
+ * Receives the partially merged data packet and the fragment which was added to it.
+ */
+using PacketProgressHandler = std::function<void(const sick::datastructure::PacketBuffer&,
+                                                 const sick::datastructure::PacketProgress&)>;
+
+/*!
+ * \brief Handler for a batch of packets received with a single system call.
+ */
+using PacketBatchHandler =
+  std::function<void(const std::vector<sick::datastructure::PacketBuffer>&)>;
+
 /*!
  * \brief Type alias for the currently used IP4 address type.
  *
@@ -74,6 +91,20 @@ using port_t = uint16_t;
  */
 using time_duration_t = boost::posix_time::time_duration;
 
+/*!
+ * \brief Type alias for timestamps on the monotonic host clock.
+ *
+ */
+using time_point_t = std::chrono::steady_clock::time_point;
+
+/*!
+ * \brief Type definition for scan data callbacks which additionally receive the sensor timestamp of
+ * the scan aligned to the monotonic host clock.
+ *
+ */
+using AlignedScanDataCb =
+  std::function<void(const sick::datastructure::Data&, const time_point_t&)>;
+
 /*!
  * \brief Type alias for the sensor feature flags.
  *
@@ -38,6 +38,7 @@
 #include "sick_safetyscanners_base/cola2/ChangeCommSettingsCommand.h"
 #include "sick_safetyscanners_base/cola2/CloseSession.h"
 #include "sick_safetyscanners_base/cola2/Command.h"
+#include "sick_safetyscanners_base/cola2/CommandPipeline.h"
 #include "sick_safetyscanners_base/cola2/ConfigMetadataVariableCommand.h"
 #include "sick_safetyscanners_base/cola2/CreateSession.h"
 #include "sick_safetyscanners_base/cola2/DeviceNameVariableCommand.h"
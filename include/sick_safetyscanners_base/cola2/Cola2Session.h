@@ -51,6 +51,11 @@
 
 #include <boost/optional.hpp>
 
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
 namespace sick {
 namespace cola2 {
 
@@ -89,6 +94,38 @@ public:
   void sendCommand(Command& cmd,
                    sick::types::time_duration_t timeout = boost::posix_time::seconds(5));
 
+  /*!
+   * \brief Default number of commands sent to the sensor before waiting for their replies.
+   */
+  static const std::size_t DEFAULT_PIPELINE_DEPTH = 8;
+
+  /*!
+   * \brief Function returning the next command to send in a pipeline, nullptr if there is none.
+   * The returned command has to stay valid until the pipeline finished.
+   */
+  using CommandGenerator = std::function<Command*()>;
+
+  /*!
+   * \brief Function called for every command of a pipeline once its reply was processed.
+   */
+  using ReplyHandler = std::function<void(Command&)>;
+
+  /*!
+   * \brief A blocking operation sending commands pipelined. Up to pipeline_depth commands are sent
+   * before waiting for a reply, replies are matched to their commands by the request ID. The
+   * generator is called whenever a command may be sent, so it can stop based on the replies
+   * handled so far. Throws an exception if the timeout is exceeded.
+   *
+   * \param next_command Returns the next command to send, nullptr if all commands are sent.
+   * \param on_reply Called for every command after its reply was processed, may be empty.
+   * \param pipeline_depth The maximum number of commands waiting for their reply.
+   * \param timeout The timeout on a single send/receive socket operation.
+   */
+  void sendCommandsPipelined(const CommandGenerator& next_command,
+                             const ReplyHandler& on_reply,
+                             std::size_t pipeline_depth = DEFAULT_PIPELINE_DEPTH,
+                             sick::types::time_duration_t timeout = boost::posix_time::seconds(5));
+
   /*!
    * \brief Get the current session ID, if available.
    *
@@ -123,10 +160,29 @@ public:
    */
   void close();
 
+  /*!
+   * \brief Opens a COLA2 session unless a session is open which was active recently enough to not
+   * have run into the heartbeat timeout of the sensor.
+   *
+   * \return true A new session was opened.
+   * \return false The current session is reused.
+   */
+  bool ensureOpen();
+
+  /*!
+   * \brief Drops the connection without closing the session on the sensor, e.g. after an error
+   * left the session in an unknown state. The sensor discards the session on its heartbeat timeout.
+   *
+   */
+  void abort();
+
 private:
   uint16_t m_request_id;
   boost::optional<uint32_t> m_session_id;
   communication::TCPClientPtr m_tcp_client_ptr;
+  // Bytes received but not yet consumed, a read might contain parts of several reply telegrams.
+  std::vector<uint8_t> m_stream_buffer;
+  std::chrono::steady_clock::time_point m_last_activity;
 
 
   /*!
@@ -145,16 +201,14 @@ private:
   bool isOpen() const;
 
   /*!
-   * \brief Assembles a packetBuffer object by merging TCP packets from one or multiple response
-   * telegrams of the sensor.
+   * \brief Assembles a packetBuffer object containing exactly one reply telegram of the sensor by
+   * merging TCP packets. Bytes of following telegrams are kept for the next call.
    *
-   * \param cmd The command to be processed.
    * \param timeout The timeout on a single send/receive socket operation. This is not the overall
    * timeout limit but guarantees the synchronous send/receive operations not to wait forever.
-   * \return sick::datastructure::PacketBuffer The merged reply telegrams of the sensor.
+   * \return sick::datastructure::PacketBuffer The reply telegram of the sensor.
    */
-  sick::datastructure::PacketBuffer receiveAndProcessResponse(Command& cmd,
-                                                              sick::types::time_duration_t timeout);
+  sick::datastructure::PacketBuffer receiveTelegram(sick::types::time_duration_t timeout);
 };
 
 } // namespace cola2
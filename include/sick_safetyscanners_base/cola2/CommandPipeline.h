@@ -0,0 +1,146 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file CommandPipeline.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_COLA2_COMMANDPIPELINE_H
+#define SICK_SAFETYSCANNERS_BASE_COLA2_COMMANDPIPELINE_H
+
+#include "sick_safetyscanners_base/cola2/Cola2Session.h"
+#include "sick_safetyscanners_base/cola2/Command.h"
+#include "sick_safetyscanners_base/Generics.h"
+#include "sick_safetyscanners_base/datastructure/RequestTiming.h"
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sick {
+namespace cola2 {
+
+/*!
+ * \brief Collects several requests, each consisting of one or more commands, and sends them
+ * pipelined over one COLA2 session. The commands of a request are created on demand, so a request
+ * can stop depending on the replies received so far.
+ */
+class CommandPipeline
+{
+public:
+  /*!
+   * \brief Creates the command with the given index of a request, nullptr if the request is done.
+   */
+  using CommandFactory = std::function<std::unique_ptr<Command>(uint16_t index)>;
+
+  /*!
+   * \brief Called once the reply of the command with the given index of a request was processed.
+   */
+  using ReplyHandler = std::function<void(uint16_t index)>;
+
+  /*!
+   * \brief Constructor of the command pipeline.
+   *
+   * \param session The open session the commands are sent over.
+   */
+  explicit CommandPipeline(Cola2Session& session);
+
+  /*!
+   * \brief Adds a request to the pipeline. Requests are started in the order they are added.
+   *
+   * \param name Name of the request used for the timing.
+   * \param factory Creates the commands of the request.
+   * \param on_reply Called for every processed reply of the request, may be empty.
+   */
+  void addRequest(const std::string& name,
+                  const CommandFactory& factory,
+                  const ReplyHandler& on_reply = ReplyHandler());
+
+  /*!
+   * \brief Adds a request consisting of a single command.
+   *
+   * \param name Name of the request used for the timing.
+   * \param args The arguments of the command following the session.
+   */
+  template <class CommandT, typename... Args>
+  void addCommand(const std::string& name, Args&... args)
+  {
+    Cola2Session& session = m_session;
+    addRequest(name, [&session, &args...](uint16_t index) -> std::unique_ptr<Command> {
+      if (index > 0)
+      {
+        return nullptr;
+      }
+      return sick::make_unique<CommandT>(session, args...);
+    });
+  }
+
+  /*!
+   * \brief Sends the commands of all requests added since the last run and waits for all
+   * replies. Throws an exception if a send/receive operation times out.
+   *
+   * \param pipeline_depth The maximum number of commands waiting for their reply.
+   */
+  void run(std::size_t pipeline_depth = Cola2Session::DEFAULT_PIPELINE_DEPTH);
+
+  /*!
+   * \brief Returns the timing of all requests which were run.
+   *
+   * \returns The timings in the order the requests were added.
+   */
+  std::vector<sick::datastructure::RequestTiming> getTimings() const;
+
+private:
+  struct Request
+  {
+    std::string name;
+    CommandFactory factory;
+    ReplyHandler on_reply;
+    std::vector<std::unique_ptr<Command>> commands;
+    bool is_exhausted;
+    std::chrono::steady_clock::time_point first_sent;
+    std::chrono::steady_clock::time_point last_reply;
+  };
+
+  Cola2Session& m_session;
+  std::vector<Request> m_requests;
+  std::size_t m_next_request;
+  bool m_is_started;
+  std::chrono::steady_clock::time_point m_start;
+
+  Command* nextCommand(std::map<const Command*, std::size_t>& owners);
+};
+
+} // namespace cola2
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_COLA2_COMMANDPIPELINE_H
@@ -76,6 +76,11 @@ public:
    */
   bool processReply();
 
+  /*!
+   * \brief Inactivity in seconds after which the sensor discards the session.
+   */
+  static const uint8_t HEARTBEAT_TIMEOUT_SECONDS = 60;
+
 private:
   /*std::vector<uint8_t>
   prepareTelegramAndGetDataPtr(const std::vector<uint8_t>& telegram) const;*/
@@ -0,0 +1,190 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file CaptureFile.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_COMMUNICATION_CAPTUREFILE_H
+#define SICK_SAFETYSCANNERS_BASE_COMMUNICATION_CAPTUREFILE_H
+
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace sick {
+namespace communication {
+
+/*!
+ * \brief Layout of capture files of raw sensor datagrams.
+ *
+ * A capture starts with a 16 byte file header: the magic "SICKCAPT", the format version (uint32)
+ * and a reserved field (uint32). Every datagram follows as a 16 byte record header, containing the
+ * receive timestamp in nanoseconds since the epoch (int64) and the datagram length (uint32) plus a
+ * reserved field (uint32), followed by the datagram padded to a multiple of 8 bytes. All numbers
+ * are little endian. Since every record header is 8 byte aligned, a mapped capture can be read in
+ * place.
+ */
+namespace capture_format {
+const char MAGIC[8]                  = {'S', 'I', 'C', 'K', 'C', 'A', 'P', 'T'};
+const uint32_t VERSION               = 1;
+const std::size_t FILE_HEADER_SIZE   = 16;
+const std::size_t RECORD_HEADER_SIZE = 16;
+const std::size_t ALIGNMENT          = 8;
+} // namespace capture_format
+
+/*!
+ * \brief A single datagram of a capture. The data points into the capture and is only valid as
+ * long as the reader exists.
+ */
+struct CaptureRecord
+{
+  //! Receive timestamp in nanoseconds since the epoch.
+  int64_t timestamp;
+  //! Pointer on the raw datagram.
+  const uint8_t* data;
+  //! Length of the datagram.
+  uint32_t length;
+};
+
+/*!
+ * \brief Writes raw datagrams with their receive timestamps to a capture file.
+ */
+class CaptureWriter
+{
+public:
+  CaptureWriter()                     = delete;
+  CaptureWriter(const CaptureWriter&) = delete;
+  CaptureWriter& operator=(const CaptureWriter&) = delete;
+
+  /*!
+   * \brief Creates the capture file, an existing file is overwritten. Throws a runtime error if
+   * the file cannot be created.
+   *
+   * \param path Path of the capture file.
+   */
+  explicit CaptureWriter(const std::string& path);
+
+  /*!
+   * \brief Appends a datagram to the capture.
+   *
+   * \param buffer The raw datagram.
+   * \param timestamp Receive timestamp in nanoseconds since the epoch.
+   */
+  void write(const sick::datastructure::PacketBuffer& buffer, int64_t timestamp);
+
+  /*!
+   * \brief Writes all buffered datagrams to the file.
+   */
+  void flush();
+
+  /*!
+   * \brief Returns the number of datagrams written.
+   *
+   * \returns The number of datagrams.
+   */
+  uint64_t getNumberOfRecords() const;
+
+  /*!
+   * \brief Returns the current receive time in nanoseconds since the epoch.
+   *
+   * \returns The timestamp.
+   */
+  static int64_t now();
+
+private:
+  std::ofstream m_file;
+  std::vector<uint8_t> m_record_header;
+  uint64_t m_number_of_records;
+};
+
+/*!
+ * \brief Reads a capture file. The file is memory mapped where supported, so records are read in
+ * place without copying the datagrams.
+ */
+class CaptureReader
+{
+public:
+  CaptureReader()                     = delete;
+  CaptureReader(const CaptureReader&) = delete;
+  CaptureReader& operator=(const CaptureReader&) = delete;
+
+  /*!
+   * \brief Opens a capture file. Throws a runtime error if the file cannot be opened or is not a
+   * capture.
+   *
+   * \param path Path of the capture file.
+   */
+  explicit CaptureReader(const std::string& path);
+
+  /*!
+   * \brief Destructor, unmaps the capture.
+   */
+  ~CaptureReader();
+
+  /*!
+   * \brief Reads the next datagram of the capture. A truncated last record, e.g. of a capture
+   * that was still being written, ends the capture.
+   *
+   * \param record Returned datagram.
+   *
+   * \returns False if the end of the capture is reached.
+   */
+  bool next(CaptureRecord& record);
+
+  /*!
+   * \brief Restarts reading at the first datagram.
+   */
+  void rewind();
+
+  /*!
+   * \brief Returns the size of the capture in bytes.
+   *
+   * \returns The size of the capture.
+   */
+  std::size_t getSize() const;
+
+private:
+  const uint8_t* m_data;
+  std::size_t m_size;
+  std::size_t m_position;
+  bool m_is_mapped;
+  std::vector<uint8_t> m_fallback_buffer;
+
+  void unmap();
+};
+
+} // namespace communication
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_COMMUNICATION_CAPTUREFILE_H
@@ -37,7 +37,10 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_COMMUNICATION_ASYNCUDPCLIENT_H
 #define SICK_SAFETYSCANNERS_BASE_COMMUNICATION_ASYNCUDPCLIENT_H
 
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include <boost/asio.hpp>
 
@@ -100,6 +103,27 @@ public:
     beginReceive();
   }
 
+  /*!
+   * \brief Asynchronous function to subscribe to the sensor data stream, draining the socket in
+   * batches.
+   *
+   * On Linux all datagrams queued in the socket are read with a single recvmmsg call into a ring
+   * of preallocated buffers and handed to the callback at once. On other platforms every batch
+   * contains a single datagram.
+   *
+   * 	param Callable
+   * \param callback A callback of variable templated type Callable to support various formats like
+   * std::function.
+   * \param batch_size The maximum number of datagrams read with one system call.
+   */
+  template <typename Callable>
+  void runBatched(Callable&& callback, std::size_t batch_size = DEFAULT_BATCH_SIZE)
+  {
+    m_packet_batch_handler = callback;
+    initBatchReceive(batch_size);
+    beginBatchReceive();
+  }
+
   /*!
    * \brief Stops the currently running asynchronous sensor data stream subscribers.
    *
@@ -131,20 +155,42 @@ public:
 
   /*!
    * \brief A synchronous function to receive data. This operation is blocking unless the timeout
-   * has been exceeded.
+   * has been exceeded. The receive time of the returned buffer is set to the kernel timestamp of
+   * the datagram where available.
    *
    * \param timeout Timeout on receiving operation.
    * \return sick::datastructure::PacketBuffer
    */
   sick::datastructure::PacketBuffer receive(sick::types::time_duration_t timeout);
 
+  /*!
+   * \brief Returns the number of datagrams the kernel dropped because the receive queue of the
+   * socket overflowed (SO_RXQ_OVFL). Only available on Linux while receiving asynchronously,
+   * otherwise zero.
+   *
+   * \return The number of dropped datagrams since the socket was opened.
+   */
+  uint32_t getKernelDropCount() const;
+
+  /*!
+   * \brief Default number of datagrams read with a single system call when receiving in batches.
+   */
+  static const std::size_t DEFAULT_BATCH_SIZE = 32;
+
 private:
+  struct BatchReceiveState;
+
   boost::asio::io_service& m_io_service;
   boost::asio::ip::udp::endpoint m_remote_endpoint;
   boost::asio::ip::udp::socket m_socket;
   types::PacketHandler m_packet_handler;
+  types::PacketBatchHandler m_packet_batch_handler;
   datastructure::PacketBuffer::ArrayBuffer m_recv_buffer;
   boost::asio::deadline_timer m_deadline;
+  // Serializes the receive handlers, so clients can share an io_service run by several threads.
+  boost::asio::io_service::strand m_strand;
+  std::unique_ptr<BatchReceiveState> m_batch_state;
+  std::atomic<uint32_t> m_kernel_drop_count;
 
   /*!
    * \brief A function to check internal deadline constraints on connect, receive and send
@@ -162,12 +208,55 @@ private:
    */
   void handleReceive(boost::system::error_code ec, std::size_t bytes_recv);
 
+  /*!
+   * \brief Internal callback function to receive all queued datagrams together with their kernel
+   * receive timestamps and begin a new receive-cycle.
+   *
+   * \param ec A boost::system error code.
+   */
+  void handleReadable(boost::system::error_code ec);
+
   /*!
    * \brief Internal function to begin the next cycle to receive sensor data.
    *
    */
   void beginReceive();
 
+  /*!
+   * \brief Internal function to enable kernel receive timestamps (SO_TIMESTAMPNS) and the kernel
+   * drop counter (SO_RXQ_OVFL) on Linux.
+   *
+   */
+  void enableControlMessages();
+
+  /*!
+   * \brief Internal function returning the kernel receive timestamp of the last datagram read from
+   * the socket, or the current time if it is not available.
+   *
+   * \return Nanoseconds since the epoch of the system clock.
+   */
+  int64_t getLastReceiveTime();
+
+  /*!
+   * \brief Internal function to allocate the receive ring and enable the kernel drop counter.
+   *
+   * \param batch_size The maximum number of datagrams read with one system call.
+   */
+  void initBatchReceive(std::size_t batch_size);
+
+  /*!
+   * \brief Internal function to wait until the socket becomes readable for the next batch.
+   *
+   */
+  void beginBatchReceive();
+
+  /*!
+   * \brief Internal callback function to drain the socket and pass the batch to the handler.
+   *
+   * \param ec A boost::system error code.
+   */
+  void handleBatchReceive(boost::system::error_code ec);
+
   /*!
    * \brief Helper function to set error_codes if an internal deadline has been exceeded.
    *
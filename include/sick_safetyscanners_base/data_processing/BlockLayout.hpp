@@ -0,0 +1,293 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file BlockLayout.hpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_BLOCKLAYOUT_HPP
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_BLOCKLAYOUT_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+
+namespace sick {
+namespace block_layout {
+
+/*!
+ * \brief Declarative description of fixed size telegram blocks.
+ *
+ * A block is described once as a sick::block_layout::Layout of field descriptors, each naming the
+ * byte offset and the setter of the target. The layout knows its size at compile time, so the
+ * decoder checks the block length once and then reads all fields without further branches. Use
+ * the SICK_LAYOUT_* macros to declare the descriptors.
+ */
+
+using read_write_helper::HOST_IS_LITTLE_ENDIAN;
+
+namespace detail {
+
+constexpr std::size_t maxOf(std::size_t a, std::size_t b)
+{
+  return a > b ? a : b;
+}
+
+constexpr std::size_t maxEnd()
+{
+  return 0;
+}
+
+template <typename... Ends>
+constexpr std::size_t maxEnd(std::size_t first, Ends... rest)
+{
+  return maxOf(first, maxEnd(rest...));
+}
+
+} // namespace detail
+
+/*!
+ * \brief Extracts the target and the value type of a setter like `void Target::set(const T&)`.
+ */
+template <typename Setter>
+struct SetterTraits;
+
+template <typename Target, typename Arg>
+struct SetterTraits<void (Target::*)(Arg)>
+{
+  typedef Target target_type;
+  typedef typename std::decay<Arg>::type value_type;
+};
+
+/*!
+ * \brief Selects the overload of a setter which copies a vector, used in the macros below.
+ *
+ * Only declared, it is used in decltype to name the type of the setter. The setters may have an
+ * overload taking the vector by rvalue, which plain decltype(&setter) cannot choose from.
+ */
+template <typename Target, typename Vector>
+void (Target::*copySetter(void (Target::*setter)(const Vector&)))(const Vector&);
+
+/*!
+ * \brief Integer field at a byte offset. The wire type is the value type of the setter.
+ */
+template <std::size_t Offset, typename Setter, Setter setter>
+struct Field
+{
+  typedef typename SetterTraits<Setter>::target_type target_type;
+  typedef typename SetterTraits<Setter>::value_type value_type;
+  static_assert(std::is_integral<value_type>::value && !std::is_same<value_type, bool>::value,
+                "Field requires an integer setter, use Flag for single bits.");
+
+  static constexpr std::size_t END = Offset + sizeof(value_type);
+
+  static void decode(const uint8_t* block, target_type& target)
+  {
+    (target.*setter)(read_write_helper::loadLittleEndian<value_type>(block + Offset));
+  }
+};
+
+/*!
+ * \brief Single bit of the byte at an offset.
+ */
+template <std::size_t Offset, unsigned Bit, typename Setter, Setter setter>
+struct Flag
+{
+  typedef typename SetterTraits<Setter>::target_type target_type;
+  static_assert(std::is_same<typename SetterTraits<Setter>::value_type, bool>::value,
+                "Flag requires a bool setter.");
+  static_assert(Bit < 8, "Flag bit is out of range.");
+
+  static constexpr std::size_t END = Offset + 1;
+
+  static void decode(const uint8_t* block, target_type& target)
+  {
+    (target.*setter)(((block[Offset] >> Bit) & 0x01) != 0);
+  }
+};
+
+/*!
+ * \brief Run of bits starting at bit 0 of the byte at an offset, passed as a std::vector<bool>.
+ */
+template <std::size_t Offset, std::size_t Count, typename Setter, Setter setter>
+struct Bits
+{
+  typedef typename SetterTraits<Setter>::target_type target_type;
+  static_assert(std::is_same<typename SetterTraits<Setter>::value_type, std::vector<bool> >::value,
+                "Bits requires a std::vector<bool> setter.");
+
+  static constexpr std::size_t END = Offset + (Count + 7) / 8;
+
+  static void decode(const uint8_t* block, target_type& target)
+  {
+    // Thread local scratch space per descriptor, the setter only copies into the target.
+    static thread_local std::vector<bool> bits;
+    bits.resize(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+      bits[i] = ((block[Offset + i / 8] >> (i % 8)) & 0x01) != 0;
+    }
+    (target.*setter)(bits);
+  }
+};
+
+/*!
+ * \brief Consecutive integers starting at an offset, passed as a std::vector.
+ */
+template <std::size_t Offset, std::size_t Count, typename Setter, Setter setter>
+struct Array
+{
+  typedef typename SetterTraits<Setter>::target_type target_type;
+  typedef typename SetterTraits<Setter>::value_type vector_type;
+  typedef typename vector_type::value_type value_type;
+  static_assert(std::is_integral<value_type>::value && !std::is_same<value_type, bool>::value,
+                "Array requires a std::vector setter of integers, use Bits for flags.");
+
+  static constexpr std::size_t END = Offset + Count * sizeof(value_type);
+
+  static void decode(const uint8_t* block, target_type& target)
+  {
+    static thread_local vector_type values;
+    values.resize(Count);
+    if (HOST_IS_LITTLE_ENDIAN)
+    {
+      std::memcpy(values.data(), block + Offset, Count * sizeof(value_type));
+    }
+    else
+    {
+      for (std::size_t i = 0; i < Count; ++i)
+      {
+        values[i] =
+          read_write_helper::loadLittleEndian<value_type>(block + Offset + i * sizeof(value_type));
+      }
+    }
+    (target.*setter)(values);
+  }
+};
+
+/*!
+ * \brief A block made of field descriptors.
+ *
+ * The size of the block is the end of its last field, so a layout can be checked against the
+ * specification with a static_assert.
+ */
+template <typename... Fields>
+struct Layout
+{
+  static constexpr std::size_t SIZE = detail::maxEnd(Fields::END...);
+
+  /*!
+   * \brief Decodes all fields of the block into the target.
+   *
+   * \param block Begin of the block.
+   * \param length Number of valid bytes starting at block.
+   * \param target The instance to set the fields in.
+   *
+   * \returns False if the block is too short, the target is unchanged then.
+   */
+  template <typename Target>
+  static bool decode(const uint8_t* block, std::size_t length, Target& target)
+  {
+    if (length < SIZE)
+    {
+      return false;
+    }
+    decodeUnchecked(block, target);
+    return true;
+  }
+
+  /*!
+   * \brief Decodes all fields of the block into the target, the caller guarantees SIZE bytes.
+   *
+   * \param block Begin of the block.
+   * \param target The instance to set the fields in.
+   */
+  template <typename Target>
+  static void decodeUnchecked(const uint8_t* block, Target& target)
+  {
+    // Expands to one call per field, evaluated in declaration order.
+    int expand[] = {0, (Fields::decode(block, target), 0)...};
+    static_cast<void>(expand);
+  }
+};
+
+/*!
+ * \brief Number of bytes of a block which are covered by the buffer.
+ *
+ * \param buffer_length Length of the complete buffer.
+ * \param block_offset Offset of the block in the buffer.
+ * \param block_size Size of the block as announced in the data header.
+ *
+ * \returns The bytes which may be read from the begin of the block.
+ */
+inline std::size_t
+blockLength(std::size_t buffer_length, std::size_t block_offset, std::size_t block_size)
+{
+  if (block_offset >= buffer_length)
+  {
+    return 0;
+  }
+  std::size_t remaining = buffer_length - block_offset;
+  return block_size < remaining ? block_size : remaining;
+}
+
+} // namespace block_layout
+} // namespace sick
+
+/*!
+ * \brief Declares an integer field, e.g. SICK_LAYOUT_FIELD(4, DataHeader::setSerialNumberOfDevice).
+ */
+#define SICK_LAYOUT_FIELD(offset, setter)                                                          \
+  sick::block_layout::Field<offset, decltype(&setter), &setter>
+
+/*!
+ * \brief Declares a single bit of the byte at offset.
+ */
+#define SICK_LAYOUT_FLAG(offset, bit, setter)                                                      \
+  sick::block_layout::Flag<offset, bit, decltype(&setter), &setter>
+
+/*!
+ * \brief Declares a run of count bits starting at offset.
+ */
+#define SICK_LAYOUT_BITS(offset, count, setter)                                                    \
+  sick::block_layout::                                                                             \
+    Bits<offset, count, decltype(sick::block_layout::copySetter(&setter)), &setter>
+
+/*!
+ * \brief Declares count consecutive integers starting at offset.
+ */
+#define SICK_LAYOUT_ARRAY(offset, count, setter)                                                   \
+  sick::block_layout::                                                                             \
+    Array<offset, count, decltype(sick::block_layout::copySetter(&setter)), &setter>
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_BLOCKLAYOUT_HPP
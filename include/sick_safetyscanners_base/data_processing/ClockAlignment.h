@@ -0,0 +1,104 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ClockAlignment.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_CLOCKALIGNMENT_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_CLOCKALIGNMENT_H
+
+#include <stdint.h>
+
+#include "sick_safetyscanners_base/Types.h"
+#include "sick_safetyscanners_base/datastructure/DataHeader.h"
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Maps the timestamps of a sensor onto the monotonic host clock.
+ *
+ * The offset between both clocks is estimated as the minimum difference between receive time and
+ * sensor timestamp, i.e. the scan with the lowest transport latency. The minimum is taken over a
+ * sliding window of scans to follow the drift of the sensor clock. Scans of different sensors
+ * aligned this way can be compared directly.
+ */
+class ClockAlignment
+{
+public:
+  /*!
+   * \brief Default number of scans after which the offset estimate is refreshed.
+   */
+  static const uint32_t DEFAULT_WINDOW_SIZE = 250;
+
+  /*!
+   * \brief Constructor of the clock alignment.
+   *
+   * \param window_size Number of scans after which the offset estimate is refreshed.
+   */
+  explicit ClockAlignment(uint32_t window_size = DEFAULT_WINDOW_SIZE);
+
+  /*!
+   * \brief Updates the offset estimate and returns the aligned timestamp of a scan.
+   *
+   * \param data_header The data header containing the sensor timestamp.
+   * \param receive_time The host time the scan was received.
+   *
+   * \returns The sensor timestamp on the host clock.
+   */
+  sick::types::time_point_t align(const sick::datastructure::DataHeader& data_header,
+                                  const sick::types::time_point_t& receive_time);
+
+  /*!
+   * \brief Discards the offset estimate, e.g. after the sensor clock was set.
+   */
+  void reset();
+
+  /*!
+   * \brief Converts the timestamp of a data header to microseconds.
+   *
+   * \param data_header The data header containing the sensor timestamp.
+   *
+   * \returns Microseconds since the sensor epoch.
+   */
+  static int64_t getSensorTime(const sick::datastructure::DataHeader& data_header);
+
+private:
+  uint32_t m_window_size;
+  uint32_t m_window_count;
+  bool m_is_valid;
+  int64_t m_offset;
+  int64_t m_window_offset;
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_CLOCKALIGNMENT_H
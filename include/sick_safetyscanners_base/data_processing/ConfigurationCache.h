@@ -0,0 +1,122 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ConfigurationCache.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_CONFIGURATIONCACHE_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_CONFIGURATIONCACHE_H
+
+#include "sick_safetyscanners_base/datastructure/ConfigMetadata.h"
+#include "sick_safetyscanners_base/datastructure/FieldData.h"
+#include "sick_safetyscanners_base/datastructure/MonitoringCaseData.h"
+#include "sick_safetyscanners_base/datastructure/SerialNumber.h"
+
+#include <string>
+#include <vector>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief On-disk cache of the field data and monitoring cases of sensors. Every sensor gets one
+ * compact binary file named after its serial number. An entry is only valid as long as the
+ * checksums and the integrity hash of the configuration metadata of the sensor are unchanged.
+ */
+class ConfigurationCache
+{
+public:
+  /*!
+   * \brief Version of the binary file format, files of other versions are ignored.
+   */
+  static const uint16_t FORMAT_VERSION = 1;
+
+  /*!
+   * \brief Constructor of the configuration cache.
+   *
+   * \param directory The existing directory the cache files are stored in.
+   */
+  explicit ConfigurationCache(const std::string& directory);
+
+  /*!
+   * \brief Loads the configuration of a sensor from the cache.
+   *
+   * \param serial_number The serial number of the sensor.
+   * \param config_metadata The current configuration metadata of the sensor.
+   * \param field_data Returned field data.
+   * \param monitoring_cases Returned monitoring cases.
+   *
+   * \returns If a matching entry was found. The returned data is unchanged otherwise.
+   */
+  bool load(const sick::datastructure::SerialNumber& serial_number,
+            const sick::datastructure::ConfigMetadata& config_metadata,
+            std::vector<sick::datastructure::FieldData>& field_data,
+            std::vector<sick::datastructure::MonitoringCaseData>& monitoring_cases) const;
+
+  /*!
+   * \brief Stores the configuration of a sensor, replacing a previous entry of the sensor. The
+   * file is replaced atomically, so concurrent readers never see a partially written entry.
+   *
+   * \param serial_number The serial number of the sensor.
+   * \param config_metadata The configuration metadata the data belongs to.
+   * \param field_data The field data to store.
+   * \param monitoring_cases The monitoring cases to store.
+   *
+   * \returns If the entry was written successfully.
+   */
+  bool store(const sick::datastructure::SerialNumber& serial_number,
+             const sick::datastructure::ConfigMetadata& config_metadata,
+             const std::vector<sick::datastructure::FieldData>& field_data,
+             const std::vector<sick::datastructure::MonitoringCaseData>& monitoring_cases) const;
+
+  /*!
+   * \brief Returns the path of the cache file of a sensor.
+   *
+   * \param serial_number The serial number of the sensor.
+   *
+   * \returns The path of the cache file.
+   */
+  std::string getFilePath(const sick::datastructure::SerialNumber& serial_number) const;
+
+  /*!
+   * \brief Returns the directory the cache files are stored in.
+   *
+   * \returns The directory of the cache.
+   */
+  std::string getDirectory() const;
+
+private:
+  std::string m_directory;
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_CONFIGURATIONCACHE_H
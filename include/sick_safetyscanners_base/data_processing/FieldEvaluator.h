@@ -0,0 +1,202 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file FieldEvaluator.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_FIELDEVALUATOR_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_FIELDEVALUATOR_H
+
+#include "sick_safetyscanners_base/Generics.h"
+#include "sick_safetyscanners_base/data_processing/PointCloudConverter.h"
+#include "sick_safetyscanners_base/data_processing/SimdKernel.h"
+#include "sick_safetyscanners_base/datastructure/Data.h"
+#include "sick_safetyscanners_base/datastructure/FieldData.h"
+#include "sick_safetyscanners_base/datastructure/MeasurementData.h"
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Result of evaluating one field against one scan.
+ */
+struct FieldEvaluation
+{
+  FieldEvaluation()
+    : is_protective_field(false)
+    , is_warning_field(false)
+    , number_of_intruded_beams(0)
+    , min_clearance(0)
+  {
+  }
+
+  bool is_protective_field;
+  bool is_warning_field;
+  uint32_t number_of_intruded_beams;
+  /// Millimeters between the field contour and the closest measured beam within the angular
+  /// range of the field, negative if the field is intruded. FieldEvaluator::NO_CLEARANCE if no
+  /// beam was measured within the range.
+  int32_t min_clearance;
+  /// Bit i of word i / 64 is set if beam i is within the field.
+  std::vector<uint64_t> intrusion_words;
+
+  /*!
+   * \brief Returns if any beam is within the field.
+   *
+   * \returns If the field is intruded.
+   */
+  bool isIntruded() const { return number_of_intruded_beams != 0; }
+};
+
+/*!
+ * \brief Evaluates the warning and protective fields of the sensor against the live scans.
+ *
+ * The contours of the fields, see sick::SickSafetyscannersBase::requestFieldData(), are resampled
+ * once to thresholds on the beam grid of the scans. Every scan is then compared beam by beam
+ * against these thresholds, with an AVX2 or SSE2 kernel if the CPU supports it. The result is
+ * meant for planning and monitoring, it does not replace the safety rated evaluation of the
+ * sensor.
+ */
+class FieldEvaluator
+{
+public:
+  /*!
+   * \brief Value of FieldEvaluation::min_clearance if no beam was measured within the field.
+   */
+  static const int32_t NO_CLEARANCE;
+
+  /*!
+   * \brief Constructor of the evaluator without fields.
+   */
+  FieldEvaluator();
+
+  /*!
+   * \brief Constructor of the evaluator.
+   *
+   * \param fields The fields as requested from the sensor.
+   */
+  explicit FieldEvaluator(const std::vector<sick::datastructure::FieldData>& fields);
+
+  /*!
+   * \brief Sets the fields to evaluate. Fields which are not valid or not defined are never
+   * intruded.
+   *
+   * \param fields The fields as requested from the sensor.
+   */
+  void setFields(const std::vector<sick::datastructure::FieldData>& fields);
+
+  /*!
+   * \brief Returns the number of fields which are evaluated.
+   *
+   * \returns The number of fields.
+   */
+  std::size_t getNumberOfFields() const;
+
+  /*!
+   * \brief Returns the kernel which compares the beams against the thresholds.
+   *
+   * \returns The kernel.
+   */
+  SimdKernel getKernel() const;
+
+  /*!
+   * \brief Sets the kernel which compares the beams against the thresholds, e.g. to compare the
+   * kernels. The fastest supported kernel is used by default.
+   *
+   * \param kernel The kernel, the scalar loop is used if it is not supported.
+   */
+  void setKernel(SimdKernel kernel);
+
+  /*!
+   * \brief Evaluates all fields against a scan.
+   *
+   * \param data The parsed scan.
+   * \param evaluations One evaluation per field in the order of setFields(), keeps its capacity
+   * across scans.
+   *
+   * \returns False if the scan holds no measurement data, the evaluations are unchanged then.
+   */
+  bool evaluate(const sick::datastructure::Data& data, std::vector<FieldEvaluation>& evaluations);
+
+  /*!
+   * \brief Evaluates all fields against measurement data.
+   *
+   * \param measurement_data The measurement data.
+   * \param multiplication_factor Millimeters per unit of the distances, see
+   * sick::datastructure::DerivedValues::getMultiplicationFactor().
+   * \param evaluations One evaluation per field in the order of setFields(), keeps its capacity
+   * across scans.
+   */
+  void evaluate(const sick::datastructure::MeasurementData& measurement_data,
+                uint16_t multiplication_factor,
+                std::vector<FieldEvaluation>& evaluations);
+
+  /*!
+   * \brief Returns the thresholds of a field on the beam grid of the last evaluated scan.
+   *
+   * \param field Index of the field.
+   *
+   * \returns One threshold per beam in units of the distances, zero outside of the field.
+   */
+  Span<const uint16_t> getThresholds(std::size_t field) const;
+
+private:
+  /*!
+   * \brief The part of a field which is needed for its evaluation.
+   */
+  struct FieldContour
+  {
+    bool is_protective_field;
+    bool is_warning_field;
+    float start_angle;                    ///< Degrees.
+    float angular_beam_resolution;        ///< Degrees.
+    std::vector<uint16_t> beam_distances; ///< Millimeters, empty if the field is not defined.
+  };
+
+  void updateThresholds(const TrigTable::Key& grid, uint16_t multiplication_factor);
+  void resampleField(const FieldContour& field, uint16_t* thresholds) const;
+
+  std::vector<FieldContour> m_fields;
+  SimdKernel m_kernel;
+  bool m_has_grid;
+  TrigTable::Key m_grid;
+  uint16_t m_multiplication_factor;
+  std::vector<uint16_t> m_thresholds;
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_FIELDEVALUATOR_H
@@ -0,0 +1,131 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file IncrementalMeasurementDecoder.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_INCREMENTALMEASUREMENTDECODER_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_INCREMENTALMEASUREMENTDECODER_H
+
+#include "sick_safetyscanners_base/datastructure/Data.h"
+#include "sick_safetyscanners_base/datastructure/MeasurementData.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+#include "sick_safetyscanners_base/datastructure/PacketProgress.h"
+
+#include "sick_safetyscanners_base/data_processing/ParseDataHeader.h"
+#include "sick_safetyscanners_base/data_processing/ParseDerivedValues.h"
+#include "sick_safetyscanners_base/data_processing/ParseMeasurementData.h"
+
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Decodes the beams of a data packet while its fragments are still arriving.
+ *
+ * The decoder is fed the received begin of the data packet, see
+ * sick::data_processing::UDPPacketMerger::setProgressHandler(). Once the data header and the
+ * derived values are received it decodes every beam as soon as its record is, so that only the
+ * beams of the last fragment remain when the data packet is complete. The result is handed to
+ * sick::data_processing::ParseData, which parses the other blocks as usual.
+ */
+class IncrementalMeasurementDecoder
+{
+public:
+  /*!
+   * \brief Constructor of the decoder.
+   */
+  IncrementalMeasurementDecoder();
+
+  /*!
+   * \brief Decodes what the newly received part of a data packet allows.
+   *
+   * Progress of another data packet than the current one discards the current one.
+   *
+   * \param buffer The partially received data packet, of the full length of the data packet.
+   * \param progress The fragment which was added to the data packet.
+   */
+  void update(const sick::datastructure::PacketBuffer& buffer,
+              const sick::datastructure::PacketProgress& progress);
+
+  /*!
+   * \brief Discards the progress of the current data packet.
+   */
+  void reset();
+
+  /*!
+   * \brief Exchanges the measurement data of a completely decoded data packet with a block.
+   *
+   * The previous block is recycled for later data packets if nobody else references it.
+   *
+   * \param buffer The complete data packet.
+   * \param measurement_data The block to swap with the decoded measurement data.
+   *
+   * \returns True if the data packet was decoded completely, the block is unchanged otherwise.
+   */
+  bool takeMeasurementData(const sick::datastructure::PacketBuffer& buffer,
+                           std::shared_ptr<sick::datastructure::MeasurementData>& measurement_data);
+
+private:
+  enum State
+  {
+    IDLE,
+    WAITING_FOR_DATA_HEADER,
+    WAITING_FOR_DERIVED_VALUES,
+    WAITING_FOR_NUMBER_OF_BEAMS,
+    DECODING_BEAMS,
+    COMPLETE,
+    NOT_DECODABLE
+  };
+
+  State m_state;
+  uint32_t m_identification;
+  const uint8_t* m_packet;
+  std::size_t m_beams_offset;
+  uint32_t m_number_of_beams;
+  uint32_t m_decoded_beams;
+  sick::datastructure::Data m_data;
+  std::shared_ptr<sick::datastructure::MeasurementData> m_measurement_data;
+  ParseDataHeader m_data_header_parser;
+  ParseDerivedValues m_derived_values_parser;
+  ParseMeasurementData m_measurement_data_parser;
+
+  void startPacket(uint32_t identification, const uint8_t* packet);
+  void decodeHeaders(const sick::datastructure::PacketBuffer& buffer, uint32_t received_length);
+  void decodeBeams(const uint8_t* packet, uint32_t received_length);
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_INCREMENTALMEASUREMENTDECODER_H
@@ -0,0 +1,107 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file LatencyRecorder.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_LATENCYRECORDER_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_LATENCYRECORDER_H
+
+#include "sick_safetyscanners_base/datastructure/LatencyHistogram.h"
+#include "sick_safetyscanners_base/datastructure/LatencyStatistics.h"
+
+#include <stdint.h>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Aggregates the latencies of the stages every scan passes on the host into histograms.
+ *
+ * All timestamps are nanoseconds on the clock of sick::datastructure::PacketBuffer receive times.
+ * Recording is lock-free, statistics can be queried from any thread.
+ */
+class LatencyRecorder
+{
+public:
+  /*!
+   * \brief The stages of a scan, see sick::datastructure::LatencyStatistics.
+   */
+  enum Stage
+  {
+    SOCKET,
+    REASSEMBLY,
+    PARSING,
+    DELIVERY,
+    CALLBACK,
+    TOTAL,
+    NUMBER_OF_STAGES
+  };
+
+  LatencyRecorder() = default;
+
+  LatencyRecorder(const LatencyRecorder&) = delete;
+  LatencyRecorder& operator=(const LatencyRecorder&) = delete;
+
+  /*!
+   * \brief Records the latency of a stage. Stages with an unknown begin, i.e. zero, are skipped.
+   *
+   * \param stage The stage.
+   * \param begin Timestamp the stage began.
+   * \param end Timestamp the stage ended.
+   */
+  void record(Stage stage, int64_t begin, int64_t end)
+  {
+    if (begin != 0)
+    {
+      m_histograms[stage].record(end - begin);
+    }
+  }
+
+  /*!
+   * \brief Returns the summaries of all stages.
+   *
+   * \returns The latency statistics.
+   */
+  sick::datastructure::LatencyStatistics getStatistics() const;
+
+  /*!
+   * \brief Discards all recorded latencies.
+   */
+  void reset();
+
+private:
+  sick::datastructure::LatencyHistogram m_histograms[NUMBER_OF_STAGES];
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_LATENCYRECORDER_H
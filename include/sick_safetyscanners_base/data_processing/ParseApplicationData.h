@@ -39,7 +39,7 @@
 #include "sick_safetyscanners_base/datastructure/DerivedValues.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
-#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+#include "sick_safetyscanners_base/Logging.h"
 
 #include <vector>
 
@@ -69,84 +69,20 @@ public:
   datastructure::ApplicationData parseUDPSequence(const sick::datastructure::PacketBuffer& buffer,
                                                   datastructure::Data& data) const;
 
+  /*!
+   * \brief Parses the application data into an existing instance.
+   *
+   * Containers of the target keep their capacity, which allows recycling instances across scans.
+   *
+   * \param buffer The incoming packet buffer.
+   * \param data The already parsed data used for checks.
+   * \param application_data The target which is overwritten with the parsed values.
+   */
+  void parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                        datastructure::Data& data,
+                        datastructure::ApplicationData& application_data) const;
+
 private:
-  void setDataInApplicationData(std::vector<uint8_t>::const_iterator data_ptr,
-                                datastructure::ApplicationData& application_data) const;
-  void
-  setApplicationInputsInApplicationData(std::vector<uint8_t>::const_iterator data_ptr,
-                                        datastructure::ApplicationData& application_data) const;
-  void
-  setApplicationOutputsInApplicationData(std::vector<uint8_t>::const_iterator data_ptr,
-                                         datastructure::ApplicationData& application_data) const;
-  void setDataInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                  datastructure::ApplicationInputs& inputs) const;
-  void setDataInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                   datastructure::ApplicationOutputs& outputs) const;
-  void setUnsafeInputsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                          datastructure::ApplicationInputs& inputs) const;
-  void setUnsafeInputsSourcesInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                 datastructure::ApplicationInputs& inputs) const;
-  void setUnsafeInputsFlagsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                               datastructure::ApplicationInputs& inputs) const;
-  void setMonitoringCaseInputsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                  datastructure::ApplicationInputs& inputs) const;
-  void setMonitoringCaseNumbersInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                   datastructure::ApplicationInputs& inputs) const;
-  void setMonitoringCaseFlagsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                 datastructure::ApplicationInputs& inputs) const;
-  void setLinearVelocityInputsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                  datastructure::ApplicationInputs& inputs) const;
-  void setLinearVelocity0InApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                             datastructure::ApplicationInputs& inputs) const;
-  void setLinearVelocity1InApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                             datastructure::ApplicationInputs& inputs) const;
-  void setLinearVelocityFlagsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                 datastructure::ApplicationInputs& inputs) const;
-  void setSleepModeInputInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                            datastructure::ApplicationInputs& inputs) const;
-  void
-  setEvalutaionPathsOutputsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                datastructure::ApplicationOutputs& outputs) const;
-  void setEvaluationPathsOutputsEvalOutInApplicationOutputs(
-    std::vector<uint8_t>::const_iterator data_ptr,
-    datastructure::ApplicationOutputs& outputs) const;
-  void setEvaluationPathsOutputsIsSafeInApplicationOutputs(
-    std::vector<uint8_t>::const_iterator data_ptr,
-    datastructure::ApplicationOutputs& outputs) const;
-  void setEvaluationPathsOutputsValidFlagsInApplicationOutputs(
-    std::vector<uint8_t>::const_iterator data_ptr,
-    datastructure::ApplicationOutputs& outputs) const;
-  void
-  setMonitoringCaseOutputsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                               datastructure::ApplicationOutputs& outputs) const;
-  void
-  setMonitoringCaseNumbersInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                               datastructure::ApplicationOutputs& outputs) const;
-  void setMonitoringCaseFlagsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                  datastructure::ApplicationOutputs& outputs) const;
-  void setSleepModeOutputInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                              datastructure::ApplicationOutputs& outputs) const;
-  void setErrorFlagsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                         datastructure::ApplicationOutputs& outputs) const;
-  void
-  setLinearVelocityOutoutsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                               datastructure::ApplicationOutputs& outputs) const;
-  void setLinearVelocity0InApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                              datastructure::ApplicationOutputs& outputs) const;
-  void setLinearVelocity1InApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                              datastructure::ApplicationOutputs& outputs) const;
-  void setLinearVelocityFlagsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                  datastructure::ApplicationOutputs& outputs) const;
-  void
-  setResultingVelocityOutputsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                  datastructure::ApplicationOutputs& outputs) const;
-  void setResultingVelocityInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                datastructure::ApplicationOutputs& outputs) const;
-  void
-  setResultingVelocityFlagsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
-                                                datastructure::ApplicationOutputs& outputs) const;
-  void setOutputFlagsinApplicationOutput(std::vector<uint8_t>::const_iterator data_ptr,
-                                         datastructure::ApplicationOutputs& outputs) const;
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfApplicationDataIsPublished(const datastructure::Data& data) const;
   bool checkIfDataContainsNeededParsedBlocks(const datastructure::Data& data) const;
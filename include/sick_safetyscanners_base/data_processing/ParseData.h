@@ -39,6 +39,8 @@
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
 #include "sick_safetyscanners_base/Logging.h"
+#include "sick_safetyscanners_base/Types.h"
+#include "sick_safetyscanners_base/data_processing/IncrementalMeasurementDecoder.h"
 #include "sick_safetyscanners_base/data_processing/ParseApplicationData.h"
 #include "sick_safetyscanners_base/data_processing/ParseDataHeader.h"
 #include "sick_safetyscanners_base/data_processing/ParseDerivedValues.h"
@@ -62,6 +64,14 @@ public:
    */
   ParseData();
 
+  /*!
+   * \brief Constructor of the parser.
+   *
+   * \param parse_features Bitset of the blocks to parse immediately, see
+   * sick::SensorDataFeatures. All other blocks are parsed from the retained buffer on first access.
+   */
+  explicit ParseData(sick::types::SensorFeatures parse_features);
+
   /*!
    * \brief Parses the udp data transferred in the packet buffer. It will be parsed into the data
    * reference.
@@ -71,32 +81,93 @@ public:
    * \returns Parsed data
    */
   sick::datastructure::Data parseUDPSequence(const sick::datastructure::PacketBuffer& buffer) const;
+
+  /*!
+   * \brief Parses the udp data transferred in the packet buffer into an existing data instance.
+   * Blocks of the instance which are not referenced elsewhere are overwritten in place, so that
+   * recycled instances, e.g. from a sick::datastructure::DataPool, do not allocate.
+   *
+   * \param buffer The incoming data buffer.
+   * \param data The data instance to parse into.
+   */
+  void parseUDPSequence(const sick::datastructure::PacketBuffer& buffer,
+                        sick::datastructure::Data& data) const;
+
+  /*!
+   * \brief Parses the udp data into an existing data instance, taking over the measurement data
+   * which was decoded while the data packet was reassembled.
+   *
+   * The measurement data is parsed as usual if the decoder did not complete the data packet.
+   *
+   * \param buffer The incoming data buffer.
+   * \param data The data instance to parse into.
+   * \param decoder The decoder which was fed the fragments of the data packet.
+   */
+  void parseUDPSequence(const sick::datastructure::PacketBuffer& buffer,
+                        sick::datastructure::Data& data,
+                        IncrementalMeasurementDecoder& decoder) const;
+
   bool parseTCPSequence(const datastructure::PacketBuffer& buffer,
                         sick::datastructure::Data& data) const;
 
+  /*!
+   * \brief Sets the blocks which are parsed immediately. All other blocks are parsed from the
+   * retained buffer on first access.
+   *
+   * \param parse_features Bitset of the blocks, see sick::SensorDataFeatures.
+   */
+  void setParseFeatures(sick::types::SensorFeatures parse_features);
+
+  /*!
+   * \brief Returns the blocks which are parsed immediately.
+   *
+   * \returns Bitset of the blocks, see sick::SensorDataFeatures.
+   */
+  sick::types::SensorFeatures getParseFeatures() const;
+
+  /*!
+   * \brief Restricts the measurement data to the beams of a region. Beams outside the region are
+   * not decoded, see sick::data_processing::BeamRegion.
+   *
+   * \param region The region of the beams to decode.
+   */
+  void setBeamRegion(const BeamRegion& region);
+
+  /*!
+   * \brief Decodes all beams of the measurement data again.
+   */
+  void clearBeamRegion();
+
+  /*!
+   * \brief Returns if the measurement data is restricted to a region.
+   *
+   * \returns If a region is set.
+   */
+  bool hasBeamRegion() const;
+
+  /*!
+   * \brief Returns the region of the beams which are decoded.
+   *
+   * \returns The region, the default region if none is set.
+   */
+  BeamRegion getBeamRegion() const;
+
 private:
-  std::shared_ptr<sick::data_processing::ParseDataHeader> m_data_header_parser_ptr;
-  std::shared_ptr<sick::data_processing::ParseDerivedValues> m_derived_values_parser_ptr;
-  std::shared_ptr<sick::data_processing::ParseMeasurementData> m_measurement_data_parser_ptr;
-  std::shared_ptr<sick::data_processing::ParseGeneralSystemState> m_general_system_state_parser_ptr;
-  std::shared_ptr<sick::data_processing::ParseIntrusionData> m_intrusion_data_parser_ptr;
-  std::shared_ptr<sick::data_processing::ParseApplicationData> m_application_data_parser_ptr;
+  /*!
+   * \brief Sub-parsers and the beam region. They are shared immutably with the loaders of deferred
+   * blocks, which may run on other threads, so changes replace the whole state.
+   */
+  struct Parsers;
 
+  sick::types::SensorFeatures m_parse_features;
+  std::shared_ptr<const Parsers> m_parsers;
 
   void setDataBlocksInData(const datastructure::PacketBuffer& buffer,
-                           datastructure::Data& data) const;
-  void setDataHeaderInData(const datastructure::PacketBuffer& buffer,
-                           datastructure::Data& data) const;
-  void setDerivedValuesInData(const datastructure::PacketBuffer& buffer,
-                              datastructure::Data& data) const;
-  void setMeasurementDataInData(const datastructure::PacketBuffer& buffer,
-                                datastructure::Data& data) const;
-  void setGeneralSystemStateInData(const datastructure::PacketBuffer& buffer,
-                                   datastructure::Data& data) const;
-  void setIntrusionDataInData(const datastructure::PacketBuffer& buffer,
-                              datastructure::Data& data) const;
-  void setApplicationDataInData(const datastructure::PacketBuffer& buffer,
-                                datastructure::Data& data) const;
+                           datastructure::Data& data,
+                           IncrementalMeasurementDecoder* decoder) const;
+  bool takeDecodedMeasurementData(const datastructure::PacketBuffer& buffer,
+                                  datastructure::Data& data,
+                                  IncrementalMeasurementDecoder& decoder) const;
 };
 
 } // namespace data_processing
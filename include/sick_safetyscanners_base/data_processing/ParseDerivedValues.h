@@ -39,7 +39,7 @@
 #include "sick_safetyscanners_base/datastructure/DerivedValues.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
-#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+#include "sick_safetyscanners_base/Logging.h"
 
 namespace sick {
 namespace data_processing {
@@ -66,21 +66,20 @@ public:
   datastructure::DerivedValues parseUDPSequence(const datastructure::PacketBuffer& buffer,
                                                 datastructure::Data& data) const;
 
+  /*!
+   * \brief Parses the derived values into an existing instance.
+   *
+   * Containers of the target keep their capacity, which allows recycling instances across scans.
+   *
+   * \param buffer The incoming packet buffer.
+   * \param data The already parsed data used for checks.
+   * \param derived_values The target which is overwritten with the parsed values.
+   */
+  void parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                        datastructure::Data& data,
+                        datastructure::DerivedValues& derived_values) const;
+
 private:
-  void setDataInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                              datastructure::DerivedValues& derived_values) const;
-  void setMultiplicationFactorInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                              datastructure::DerivedValues& derived_values) const;
-  void setNumberOfBeamsInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                       datastructure::DerivedValues& derived_values) const;
-  void setScanTimeInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                  datastructure::DerivedValues& derived_values) const;
-  void setStartAngleInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                    datastructure::DerivedValues& derived_values) const;
-  void setAngularBeamResolutionInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                               datastructure::DerivedValues& derived_values) const;
-  void setInterbeamPeriodInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                         datastructure::DerivedValues& derived_values) const;
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfDerivedValuesIsPublished(const datastructure::Data& data) const;
   bool checkIfDataContainsNeededParsedBlocks(const datastructure::Data& data) const;
@@ -72,9 +72,8 @@ public:
                         datastructure::FieldData& field_data) const;
 
 private:
-  uint32_t readArrayLength(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readArrayElement(std::vector<uint8_t>::const_iterator data_ptr,
-                            uint32_t elem_number) const;
+  uint32_t readArrayLength(const uint8_t* data_ptr) const;
+  uint16_t readArrayElement(const uint8_t* data_ptr, uint32_t elem_number) const;
 };
 
 } // namespace data_processing
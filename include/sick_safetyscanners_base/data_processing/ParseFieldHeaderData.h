@@ -69,21 +69,20 @@ public:
                         datastructure::FieldData& field_data) const;
 
 private:
-  bool isValid(std::vector<uint8_t>::const_iterator data_ptr) const;
-  void setFieldType(std::vector<uint8_t>::const_iterator data_ptr,
-                    datastructure::FieldData& field_data) const;
-  uint8_t readFieldType(std::vector<uint8_t>::const_iterator data_ptr) const;
-  std::string readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  bool readIsDefined(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readEvalMethod(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readMultiSampling(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readObjectResolution(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readSetIndex(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readNameLength(std::vector<uint8_t>::const_iterator data_ptr) const;
-  std::string readFieldName(std::vector<uint8_t>::const_iterator data_ptr) const;
+  bool isValid(const uint8_t* data_ptr) const;
+  void setFieldType(const uint8_t* data_ptr, datastructure::FieldData& field_data) const;
+  uint8_t readFieldType(const uint8_t* data_ptr) const;
+  std::string readVersionIndicator(const uint8_t* data_ptr) const;
+  uint8_t readMajorNumber(const uint8_t* data_ptr) const;
+  uint8_t readMinorNumber(const uint8_t* data_ptr) const;
+  uint8_t readReleaseNumber(const uint8_t* data_ptr) const;
+  bool readIsDefined(const uint8_t* data_ptr) const;
+  uint8_t readEvalMethod(const uint8_t* data_ptr) const;
+  uint16_t readMultiSampling(const uint8_t* data_ptr) const;
+  uint16_t readObjectResolution(const uint8_t* data_ptr) const;
+  uint16_t readSetIndex(const uint8_t* data_ptr) const;
+  uint32_t readNameLength(const uint8_t* data_ptr) const;
+  std::string readFieldName(const uint8_t* data_ptr) const;
 };
 
 } // namespace data_processing
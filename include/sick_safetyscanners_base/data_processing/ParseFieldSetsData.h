@@ -69,17 +69,14 @@ public:
                         datastructure::FieldSets& field_sets) const;
 
 private:
-  std::string readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readArrayLength(std::vector<uint8_t>::const_iterator data_ptr) const;
-  std::vector<uint32_t> readNameLength(std::vector<uint8_t>::const_iterator data_ptr,
-                                       uint32_t array_length) const;
-  std::vector<std::string> readFieldName(std::vector<uint8_t>::const_iterator data_ptr,
-                                         uint32_t array_length) const;
-  std::vector<bool> readIsDefined(std::vector<uint8_t>::const_iterator data_ptr,
-                                  uint32_t array_length) const;
+  std::string readVersionIndicator(const uint8_t* data_ptr) const;
+  uint8_t readMajorNumber(const uint8_t* data_ptr) const;
+  uint8_t readMinorNumber(const uint8_t* data_ptr) const;
+  uint8_t readReleaseNumber(const uint8_t* data_ptr) const;
+  uint32_t readArrayLength(const uint8_t* data_ptr) const;
+  std::vector<uint32_t> readNameLength(const uint8_t* data_ptr, uint32_t array_length) const;
+  std::vector<std::string> readFieldName(const uint8_t* data_ptr, uint32_t array_length) const;
+  std::vector<bool> readIsDefined(const uint8_t* data_ptr, uint32_t array_length) const;
 };
 
 } // namespace data_processing
@@ -70,7 +70,7 @@ public:
   bool parseTCPSequence(const datastructure::PacketBuffer& buffer,
                         datastructure::FirmwareVersion& firmware_version) const;
 
-  std::string readFirmwareVersion(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readFirmwareVersion(const uint8_t* data_ptr) const;
 };
 
 } // namespace data_processing
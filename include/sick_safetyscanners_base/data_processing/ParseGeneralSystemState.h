@@ -39,7 +39,7 @@
 #include "sick_safetyscanners_base/datastructure/DerivedValues.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
-#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+#include "sick_safetyscanners_base/Logging.h"
 
 #include <vector>
 
@@ -69,26 +69,20 @@ public:
   parseUDPSequence(const sick::datastructure::PacketBuffer& buffer,
                    datastructure::Data& data) const;
 
+  /*!
+   * \brief Parses the general system state into an existing instance.
+   *
+   * Containers of the target keep their capacity, which allows recycling instances across scans.
+   *
+   * \param buffer The incoming packet buffer.
+   * \param data The already parsed data used for checks.
+   * \param general_system_state The target which is overwritten with the parsed values.
+   */
+  void parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                        datastructure::Data& data,
+                        datastructure::GeneralSystemState& general_system_state) const;
+
 private:
-  void setDataInGeneralSystemState(std::vector<uint8_t>::const_iterator data_ptr,
-                                   datastructure::GeneralSystemState& general_system_state) const;
-  void
-  setStatusBitsInGeneralSystemState(std::vector<uint8_t>::const_iterator data_ptr,
-                                    datastructure::GeneralSystemState& general_system_state) const;
-  void setSafeCutOffPathInGeneralSystemState(
-    std::vector<uint8_t>::const_iterator data_ptr,
-    datastructure::GeneralSystemState& general_system_state) const;
-  void setNonSafeCutOffPathInGeneralSystemState(
-    std::vector<uint8_t>::const_iterator data_ptr,
-    datastructure::GeneralSystemState& general_system_state) const;
-  void setResetRequiredCutOffPathInGeneralSystemState(
-    std::vector<uint8_t>::const_iterator data_ptr,
-    datastructure::GeneralSystemState& general_system_state) const;
-  void setCurrentMonitoringCasesInGeneralSystemState(
-    std::vector<uint8_t>::const_iterator data_ptr,
-    datastructure::GeneralSystemState& general_system_state) const;
-  void setErrorsInGeneralSystemState(std::vector<uint8_t>::const_iterator data_ptr,
-                                     datastructure::GeneralSystemState& general_system_state) const;
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfGeneralSystemStateIsPublished(const datastructure::Data& data) const;
   bool checkIfDataContainsNeededParsedBlocks(const datastructure::Data& data) const;
@@ -67,22 +67,36 @@ public:
    */
   datastructure::IntrusionData parseUDPSequence(const datastructure::PacketBuffer& buffer,
                                                 datastructure::Data& data);
+
+  /*!
+   * \brief Parses the intrusion data into an existing instance.
+   *
+   * Containers of the target keep their capacity, which allows recycling instances across scans.
+   *
+   * \param buffer The incoming packet buffer.
+   * \param data The already parsed data used for checks.
+   * \param intrusion_data The target which is overwritten with the parsed values.
+   */
+  void parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                        datastructure::Data& data,
+                        datastructure::IntrusionData& intrusion_data);
+
   uint16_t getNumScanPoints() const;
   void setNumScanPoints(const uint16_t& num_scan_points);
 
 private:
   uint16_t m_num_scan_points;
 
-  void setDataInIntrusionData(std::vector<uint8_t>::const_iterator data_ptr,
+  bool setDataInIntrusionData(read_write_helper::ByteCursor cursor,
                               datastructure::IntrusionData& intrusion_data) const;
-  void setDataInIntrusionDatums(
-    std::vector<uint8_t>::const_iterator data_ptr,
+  bool setDataInIntrusionDatums(
+    read_write_helper::ByteCursor cursor,
     std::vector<sick::datastructure::IntrusionDatum>& intrusion_datums) const;
   uint16_t setSizeInIntrusionDatum(const uint16_t& offset,
-                                   std::vector<uint8_t>::const_iterator data_ptr,
+                                   const uint8_t* data_ptr,
                                    sick::datastructure::IntrusionDatum& datum) const;
   uint16_t setFlagsInIntrusionDatum(const uint16_t& offset,
-                                    std::vector<uint8_t>::const_iterator data_ptr,
+                                    const uint8_t* data_ptr,
                                     sick::datastructure::IntrusionDatum& datum) const;
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfIntrusionDataIsPublished(const datastructure::Data& data) const;
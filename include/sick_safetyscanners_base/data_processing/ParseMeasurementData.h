@@ -41,19 +41,53 @@
 
 #include "sick_safetyscanners_base/Logging.h"
 #include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+#include "sick_safetyscanners_base/data_processing/SimdKernel.h"
 
+#include <cstddef>
+#include <limits>
 #include <string>
 #include <vector>
 
 namespace sick {
 namespace data_processing {
 
+/*!
+ * \brief Region of interest of the beams of a scan, applied while decoding.
+ *
+ * Beams outside the angle range or skipped by the stride are never decoded. Beams outside the
+ * distance limits stay on the beam grid but are cleared, their distance, reflectivity and status,
+ * including the valid bit, are zero. The default region keeps every beam.
+ */
+struct BeamRegion
+{
+  BeamRegion()
+    : start_angle(std::numeric_limits<float>::lowest())
+    , end_angle(std::numeric_limits<float>::max())
+    , min_distance(0)
+    , max_distance(std::numeric_limits<uint16_t>::max())
+    , stride(1)
+  {
+  }
+
+  float start_angle;     ///< Angle of the first beam to keep in degrees.
+  float end_angle;       ///< Angle of the last beam to keep in degrees.
+  uint16_t min_distance; ///< Shortest distance to keep, in the unit of the measurement data.
+  uint16_t max_distance; ///< Longest distance to keep, in the unit of the measurement data.
+  uint32_t stride;       ///< Keeps every stride-th beam of the angle range, starting at the first.
+};
+
 /*!
  * \brief Parser for the measurement data from a udp sequence.
  */
 class ParseMeasurementData
 {
 public:
+  /*!
+   * \brief Every beam is a little endian record of a 16 bit distance, an 8 bit reflectivity and 8
+   * status bits.
+   */
+  static const std::size_t BEAM_RECORD_SIZE = 4;
+
   /*!
    * \brief Constructor of the parser.
    */
@@ -70,19 +104,121 @@ public:
   datastructure::MeasurementData parseUDPSequence(const datastructure::PacketBuffer& buffer,
                                                   datastructure::Data& data);
 
+  /*!
+   * \brief Parses the measurement data into an existing instance.
+   *
+   * Containers of the target keep their capacity, which allows recycling instances across scans.
+   *
+   * \param buffer The incoming packet buffer.
+   * \param data The already parsed data used for checks.
+   * \param measurement_data The target which is overwritten with the parsed values.
+   */
+  void parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                        datastructure::Data& data,
+                        datastructure::MeasurementData& measurement_data);
+
+  /*!
+   * \brief Parses the beams of a region of the measurement data into an existing instance.
+   *
+   * The start angle and angular resolution of the result describe the beams of the region, a stride
+   * multiplies the resolution.
+   *
+   * \param buffer The incoming packet buffer.
+   * \param data The already parsed data used for checks.
+   * \param region The region of the beams to decode.
+   * \param measurement_data The target which is overwritten with the parsed values.
+   */
+  void parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                        datastructure::Data& data,
+                        const BeamRegion& region,
+                        datastructure::MeasurementData& measurement_data);
+
+  /*!
+   * \brief Parses several regions of the measurement data from one packet buffer.
+   *
+   * \param buffer The incoming packet buffer.
+   * \param data The already parsed data used for checks.
+   * \param regions The regions of the beams to decode.
+   * \param measurement_data The targets, resized to one instance per region. Existing instances are
+   * recycled.
+   */
+  void parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                        datastructure::Data& data,
+                        const std::vector<BeamRegion>& regions,
+                        std::vector<datastructure::MeasurementData>& measurement_data);
+
+  /*!
+   * \brief Prepares the measurement data for decoding its beams in steps with decodeBeams(), e.g.
+   * while the data packet is still reassembled.
+   *
+   * Only the data header, the derived values and the beam count of the measurement data block have
+   * to be received. Once all beams are decoded the target equals the result of parseUDPSequence().
+   *
+   * \param buffer The packet buffer of the full length of the data packet.
+   * \param data The already parsed data used for checks.
+   * \param measurement_data The target, which is sized for all beams of the scan.
+   *
+   * \returns Offset of the first beam record in the buffer, zero if there is no measurement data to
+   * decode. The target is empty then.
+   */
+  std::size_t beginUDPSequence(const datastructure::PacketBuffer& buffer,
+                               datastructure::Data& data,
+                               datastructure::MeasurementData& measurement_data);
+
+  /*!
+   * \brief De-interleaves raw 4 byte beam records into separate distance, reflectivity and status
+   * arrays.
+   *
+   * Uses an AVX2 or SSE2 kernel if the CPU supports it, selected once at runtime, and a scalar
+   * loop otherwise.
+   *
+   * \param beams Pointer to the first beam record.
+   * \param number_of_beams Number of beam records to decode.
+   * \param distances Output array of number_of_beams distances.
+   * \param reflectivities Output array of number_of_beams reflectivities.
+   * \param status_bits Output array of number_of_beams status bytes.
+   */
+  static void decodeBeams(const uint8_t* beams,
+                          uint32_t number_of_beams,
+                          uint16_t* distances,
+                          uint8_t* reflectivities,
+                          uint8_t* status_bits);
+
+  /*!
+   * \brief De-interleaves raw 4 byte beam records with a given kernel, e.g. to compare the kernels.
+   *
+   * \param kernel The kernel, the scalar loop is used if it is not supported.
+   * \param beams Pointer to the first beam record.
+   * \param number_of_beams Number of beam records to decode.
+   * \param distances Output array of number_of_beams distances.
+   * \param reflectivities Output array of number_of_beams reflectivities.
+   * \param status_bits Output array of number_of_beams status bytes.
+   */
+  static void decodeBeams(SimdKernel kernel,
+                          const uint8_t* beams,
+                          uint32_t number_of_beams,
+                          uint16_t* distances,
+                          uint8_t* reflectivities,
+                          uint8_t* status_bits);
+
 private:
-  float m_angle;
-  float m_angle_delta;
-  void setDataInMeasurementData(std::vector<uint8_t>::const_iterator data_ptr,
-                                datastructure::MeasurementData& measurement_data);
-  void setNumberOfBeamsInMeasurementData(std::vector<uint8_t>::const_iterator data_ptr,
-                                         datastructure::MeasurementData& measurement_data) const;
-  void setStartAngleAndDelta(const datastructure::Data& data);
-  void setScanPointsInMeasurementData(std::vector<uint8_t>::const_iterator data_ptr,
-                                      datastructure::MeasurementData& measurement_data);
-  void addScanPointToMeasurementData(uint16_t offset,
-                                     std::vector<uint8_t>::const_iterator data_ptr,
-                                     datastructure::MeasurementData& measurement_data) const;
+  const uint8_t* findBeams(const std::vector<uint8_t>& buffer,
+                           const datastructure::Data& data,
+                           uint32_t& number_of_beams) const;
+  void setScanPointsInMeasurementData(const uint8_t* beams,
+                                      uint32_t number_of_beams,
+                                      const datastructure::Data& data,
+                                      const BeamRegion& region,
+                                      datastructure::MeasurementData& measurement_data) const;
+  void selectBeams(const BeamRegion& region,
+                   float start_angle,
+                   float angular_beam_resolution,
+                   uint32_t number_of_beams,
+                   uint32_t& first_beam,
+                   uint32_t& end_beam) const;
+  void applyDistanceLimits(const BeamRegion& region,
+                           datastructure::MeasurementData& measurement_data) const;
+  void setEmptyMeasurementData(datastructure::MeasurementData& measurement_data) const;
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfMeasurementDataIsPublished(const datastructure::Data& data) const;
   bool checkIfDataContainsNeededParsedBlocks(const datastructure::Data& data) const;
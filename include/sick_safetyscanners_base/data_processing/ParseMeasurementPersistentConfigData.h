@@ -70,18 +70,18 @@ public:
                         datastructure::ConfigData& config_data) const;
 
 private:
-  std::string readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  bool readEnabled(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readInterfaceType(std::vector<uint8_t>::const_iterator data_ptr) const;
-  boost::asio::ip::address_v4 readHostIp(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readHostPort(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readPublishingFreq(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readEndAngle(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readStartAngle(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readFeatures(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readVersionIndicator(const uint8_t* data_ptr) const;
+  uint8_t readMajorNumber(const uint8_t* data_ptr) const;
+  uint8_t readMinorNumber(const uint8_t* data_ptr) const;
+  uint8_t readReleaseNumber(const uint8_t* data_ptr) const;
+  bool readEnabled(const uint8_t* data_ptr) const;
+  uint8_t readInterfaceType(const uint8_t* data_ptr) const;
+  boost::asio::ip::address_v4 readHostIp(const uint8_t* data_ptr) const;
+  uint16_t readHostPort(const uint8_t* data_ptr) const;
+  uint16_t readPublishingFreq(const uint8_t* data_ptr) const;
+  uint32_t readEndAngle(const uint8_t* data_ptr) const;
+  uint32_t readStartAngle(const uint8_t* data_ptr) const;
+  uint16_t readFeatures(const uint8_t* data_ptr) const;
 };
 
 } // namespace data_processing
@@ -70,7 +70,7 @@ public:
   bool parseTCPSequence(const datastructure::PacketBuffer& buffer,
                         datastructure::OrderNumber& order_number) const;
 
-  std::string readOrderNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readOrderNumber(const uint8_t* data_ptr) const;
 };
 
 } // namespace data_processing
@@ -70,7 +70,7 @@ public:
   bool parseTCPSequence(const datastructure::PacketBuffer& buffer,
                         datastructure::ProjectName& project_name) const;
 
-  std::string readProjectName(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readProjectName(const uint8_t* data_ptr) const;
 };
 
 } // namespace data_processing
@@ -70,7 +70,7 @@ public:
                         datastructure::RequiredUserAction& required_user_action) const;
 
 private:
-  bool readRequiredUserAction(std::vector<uint8_t>::const_iterator data_ptr,
+  bool readRequiredUserAction(const uint8_t* data_ptr,
                               datastructure::RequiredUserAction& required_user_action) const;
 };
 
@@ -69,19 +69,19 @@ public:
                         datastructure::StatusOverview& status_overview) const;
 
 private:
-  std::string readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readDeviceState(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readConfigState(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readApplicationState(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readPowerOnCount(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readCurrentTime(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readCurrentDate(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readErrorInfoCode(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readErrorInfoTime(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readErrorInfoDate(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readVersionIndicator(const uint8_t* data_ptr) const;
+  uint8_t readMajorNumber(const uint8_t* data_ptr) const;
+  uint8_t readMinorNumber(const uint8_t* data_ptr) const;
+  uint8_t readReleaseNumber(const uint8_t* data_ptr) const;
+  uint8_t readDeviceState(const uint8_t* data_ptr) const;
+  uint8_t readConfigState(const uint8_t* data_ptr) const;
+  uint8_t readApplicationState(const uint8_t* data_ptr) const;
+  uint32_t readPowerOnCount(const uint8_t* data_ptr) const;
+  uint32_t readCurrentTime(const uint8_t* data_ptr) const;
+  uint16_t readCurrentDate(const uint8_t* data_ptr) const;
+  uint32_t readErrorInfoCode(const uint8_t* data_ptr) const;
+  uint32_t readErrorInfoTime(const uint8_t* data_ptr) const;
+  uint16_t readErrorInfoDate(const uint8_t* data_ptr) const;
 };
 
 } // namespace data_processing
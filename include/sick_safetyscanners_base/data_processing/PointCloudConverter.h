@@ -0,0 +1,270 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file PointCloudConverter.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_POINTCLOUDCONVERTER_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_POINTCLOUDCONVERTER_H
+
+#include "sick_safetyscanners_base/data_processing/SimdKernel.h"
+#include "sick_safetyscanners_base/datastructure/Data.h"
+#include "sick_safetyscanners_base/datastructure/DerivedValues.h"
+#include "sick_safetyscanners_base/datastructure/MeasurementData.h"
+
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief A point of a cartesian point cloud, packed into 16 bytes.
+ */
+struct CartesianPoint
+{
+  float x;         ///< Meters.
+  float y;         ///< Meters.
+  float z;         ///< Meters, always zero for the scan plane.
+  float intensity; ///< Reflectivity of the beam.
+};
+
+/*!
+ * \brief Rigid transform within the scan plane from the sensor frame into a target frame.
+ */
+struct PlanarTransform
+{
+  PlanarTransform()
+    : x(0.0f)
+    , y(0.0f)
+    , yaw(0.0f)
+  {
+  }
+
+  PlanarTransform(float x_, float y_, float yaw_)
+    : x(x_)
+    , y(y_)
+    , yaw(yaw_)
+  {
+  }
+
+  float x;   ///< Translation in meters.
+  float y;   ///< Translation in meters.
+  float yaw; ///< Rotation in radians.
+};
+
+/*!
+ * \brief Cosine and sine of every beam angle of one scan configuration.
+ *
+ * Tables are immutable and shared through get() by all converters which see the same
+ * configuration, e.g. several sensors with identical derived values.
+ */
+class TrigTable
+{
+public:
+  /*!
+   * \brief The configuration a table is computed for.
+   */
+  struct Key
+  {
+    float start_angle;             ///< Degrees.
+    float angular_beam_resolution; ///< Degrees.
+    uint32_t number_of_beams;
+
+    bool operator==(const Key& other) const;
+    bool operator<(const Key& other) const;
+  };
+
+  /*!
+   * \brief Computes the table of a configuration. Prefer get() to share tables.
+   *
+   * \param key The configuration.
+   */
+  explicit TrigTable(const Key& key);
+
+  /*!
+   * \brief Returns the table of a configuration, computing it only if no other user holds it.
+   *
+   * \param key The configuration.
+   *
+   * \returns The shared table.
+   */
+  static std::shared_ptr<const TrigTable> get(const Key& key);
+
+  /*!
+   * \brief Returns the key of the configuration as in the derived values.
+   *
+   * \param derived_values The derived values of a scan.
+   * \returns The key.
+   */
+  static Key makeKey(const sick::datastructure::DerivedValues& derived_values);
+
+  /*!
+   * \brief Returns the key of the configuration the measurement data was parsed with.
+   *
+   * \param measurement_data The measurement data of a scan.
+   * \returns The key.
+   */
+  static Key makeKey(const sick::datastructure::MeasurementData& measurement_data);
+
+  /*!
+   * \brief Returns the configuration of the table.
+   *
+   * \returns The key.
+   */
+  const Key& getKey() const;
+
+  /*!
+   * \brief Returns the cosines of the beam angles.
+   *
+   * \returns Pointer to number_of_beams values.
+   */
+  const float* getCosines() const;
+
+  /*!
+   * \brief Returns the sines of the beam angles.
+   *
+   * \returns Pointer to number_of_beams values.
+   */
+  const float* getSines() const;
+
+private:
+  Key m_key;
+  std::vector<float> m_cosines;
+  std::vector<float> m_sines;
+};
+
+/*!
+ * \brief Converts the polar measurement data of scans into cartesian points.
+ *
+ * The beams are scaled to meters, rotated by the cached beam angles and transformed into the
+ * target frame in a single pass, which writes straight into a buffer of the caller. An AVX2 or SSE2
+ * kernel is used if the CPU supports it, selected once at runtime.
+ */
+class PointCloudConverter
+{
+public:
+  /*!
+   * \brief Constructor of the converter, the transform is the identity.
+   */
+  PointCloudConverter();
+
+  /*!
+   * \brief Constructor of the converter.
+   *
+   * \param transform The transform from the sensor into the target frame.
+   */
+  explicit PointCloudConverter(const PlanarTransform& transform);
+
+  /*!
+   * \brief Returns the transform from the sensor into the target frame.
+   *
+   * \returns The transform.
+   */
+  const PlanarTransform& getTransform() const;
+
+  /*!
+   * \brief Sets the transform from the sensor into the target frame.
+   *
+   * \param transform The transform.
+   */
+  void setTransform(const PlanarTransform& transform);
+
+  /*!
+   * \brief Returns the kernel which converts the points.
+   *
+   * \returns The kernel.
+   */
+  SimdKernel getKernel() const;
+
+  /*!
+   * \brief Sets the kernel which converts the points, e.g. to compare the kernels. The fastest
+   * supported kernel is used by default.
+   *
+   * \param kernel The kernel, the scalar loop is used if it is not supported.
+   */
+  void setKernel(SimdKernel kernel);
+
+  /*!
+   * \brief Converts the measurement data of a scan.
+   *
+   * The distances are scaled by the multiplication factor of the derived values.
+   *
+   * \param data The parsed scan.
+   * \param points Buffer to write the points to.
+   * \param capacity Number of points which fit into the buffer.
+   *
+   * \returns The number of points written, at most capacity. Zero if the scan holds no
+   * measurement data.
+   */
+  std::size_t convert(const sick::datastructure::Data& data,
+                      CartesianPoint* points,
+                      std::size_t capacity);
+
+  /*!
+   * \brief Converts measurement data.
+   *
+   * \param measurement_data The measurement data.
+   * \param meters_per_unit Scale from the raw distances to meters.
+   * \param points Buffer to write the points to.
+   * \param capacity Number of points which fit into the buffer.
+   *
+   * \returns The number of points written, at most capacity.
+   */
+  std::size_t convert(const sick::datastructure::MeasurementData& measurement_data,
+                      float meters_per_unit,
+                      CartesianPoint* points,
+                      std::size_t capacity);
+
+  /*!
+   * \brief Converts measurement data into a vector, which is resized to the number of beams.
+   *
+   * \param measurement_data The measurement data.
+   * \param meters_per_unit Scale from the raw distances to meters.
+   * \param points The target, keeps its capacity across scans.
+   */
+  void convert(const sick::datastructure::MeasurementData& measurement_data,
+               float meters_per_unit,
+               std::vector<CartesianPoint>& points);
+
+private:
+  const TrigTable& getTrigTable(const TrigTable::Key& key);
+
+  PlanarTransform m_transform;
+  SimdKernel m_kernel;
+  std::shared_ptr<const TrigTable> m_trig_table;
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_POINTCLOUDCONVERTER_H
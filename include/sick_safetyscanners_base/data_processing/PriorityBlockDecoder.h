@@ -0,0 +1,157 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file PriorityBlockDecoder.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_PRIORITYBLOCKDECODER_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_PRIORITYBLOCKDECODER_H
+
+#include "sick_safetyscanners_base/Types.h"
+#include "sick_safetyscanners_base/datastructure/Data.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+#include "sick_safetyscanners_base/datastructure/PacketProgress.h"
+
+#include "sick_safetyscanners_base/data_processing/ParseApplicationData.h"
+#include "sick_safetyscanners_base/data_processing/ParseDataHeader.h"
+#include "sick_safetyscanners_base/data_processing/ParseDerivedValues.h"
+#include "sick_safetyscanners_base/data_processing/ParseGeneralSystemState.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Decodes small blocks of a data packet as soon as their fragments arrived, before the
+ * data packet is complete.
+ *
+ * Tracks the fragments of the current data packet, see
+ * sick::data_processing::UDPPacketMerger::setProgressHandler(). Once the data header and every
+ * requested block which the header publishes are received, the blocks are parsed and the data is
+ * ready. It is ready only once per data packet.
+ */
+class PriorityBlockDecoder
+{
+public:
+  /*!
+   * \brief Constructor of the decoder, no blocks are requested.
+   */
+  PriorityBlockDecoder();
+
+  /*!
+   * \brief Sets the blocks to decode early. Supported are the general system state, the
+   * application data and the derived values, other blocks are ignored.
+   *
+   * \param blocks Bitset of the blocks, see sick::SensorDataFeatures. Zero disables the decoder.
+   */
+  void setBlocks(sick::types::SensorFeatures blocks);
+
+  /*!
+   * \brief Returns the blocks to decode early.
+   *
+   * \returns Bitset of the blocks, see sick::SensorDataFeatures.
+   */
+  sick::types::SensorFeatures getBlocks() const;
+
+  /*!
+   * \brief Adds a fragment of a data packet and decodes the blocks once they are received.
+   *
+   * Fragments of several data packets may interleave. Packets are tracked while they are within
+   * the identification window of the packet merger behind the newest one, which is passed with
+   * the progress.
+   *
+   * \param buffer The partially received data packet, of the full length of the data packet.
+   * \param progress The fragment which was added to the data packet.
+   */
+  void update(const sick::datastructure::PacketBuffer& buffer,
+              const sick::datastructure::PacketProgress& progress);
+
+  /*!
+   * \brief Returns if the blocks of a data packet are decoded and not yet taken.
+   *
+   * \returns If the data is ready.
+   */
+  bool isReady() const;
+
+  /*!
+   * \brief Returns the data of the data packet whose blocks were decoded last and marks it as
+   * taken.
+   *
+   * Only the data header and the requested blocks are set. Blocks are overwritten by later data
+   * packets unless they are referenced elsewhere, copy the data to keep it.
+   *
+   * \returns The decoded data.
+   */
+  const sick::datastructure::Data& takeData();
+
+private:
+  struct Fragment
+  {
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  /*!
+   * \brief Received fragments of a single data packet.
+   */
+  struct PacketState
+  {
+    bool in_use;
+    uint32_t identification;
+    bool has_data_header;
+    bool is_decoded;
+    sick::datastructure::DataHeader data_header;
+    std::vector<Fragment> fragments;
+  };
+
+  sick::types::SensorFeatures m_blocks;
+  bool m_has_newest_identification;
+  uint32_t m_newest_identification;
+  std::vector<PacketState> m_packets;
+  bool m_is_ready;
+  sick::datastructure::Data m_data;
+  ParseDataHeader m_data_header_parser;
+  ParseDerivedValues m_derived_values_parser;
+  ParseGeneralSystemState m_general_system_state_parser;
+  ParseApplicationData m_application_data_parser;
+
+  PacketState& getPacket(uint32_t identification, uint32_t window);
+  bool isReceived(const PacketState& packet, uint32_t offset, uint32_t length) const;
+  bool areBlocksReceived(const PacketState& packet) const;
+  void decodeBlocks(const sick::datastructure::PacketBuffer& buffer,
+                    const sick::datastructure::DataHeader& data_header);
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_PRIORITYBLOCKDECODER_H
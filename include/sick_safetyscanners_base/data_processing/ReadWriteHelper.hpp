@@ -35,341 +35,746 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_READWRITEHELPER_HPP
 #define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_READWRITEHELPER_HPP
 
+#include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <stdint.h>
+#include <type_traits>
+#include <vector>
 
 namespace sick {
 namespace read_write_helper {
 
 /*!
  * \brief Helper Functions read and write data at a certain place in a buffer.
+ *
+ * The functions work on raw pointers, so parsers can decode from any buffer source. Values are
+ * loaded with memcpy, which compiles to a single unaligned load, and the byte order is swapped
+ * only if the host differs from the wire format. The overloads taking vector iterators are kept
+ * for existing callers and forward to the pointer versions.
  */
 
 /*!
- * \brief Writes an unsigned 8-bit integer to a buffer at offset.
- *
- * \param buf The buffer to write to.
- * \param v Value which will be written.
+ * \brief True if the host stores integers in little endian byte order.
  */
-inline void writeUint8(std::vector<uint8_t>::iterator it, const uint8_t v)
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) &&                                    \
+  (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+constexpr bool HOST_IS_LITTLE_ENDIAN = false;
+#else
+constexpr bool HOST_IS_LITTLE_ENDIAN = true;
+#endif
+
+namespace detail {
+
+inline uint8_t byteSwap(uint8_t value)
+{
+  return value;
+}
+
+inline uint16_t byteSwap(uint16_t value)
+{
+  return static_cast<uint16_t>((value >> 8) | (value << 8));
+}
+
+inline uint32_t byteSwap(uint32_t value)
 {
-  *(it + 0) = v;
+  return ((value & 0x000000FFu) << 24) | ((value & 0x0000FF00u) << 8) |
+         ((value & 0x00FF0000u) >> 8) | ((value & 0xFF000000u) >> 24);
 }
 
+inline uint64_t byteSwap(uint64_t value)
+{
+  return (static_cast<uint64_t>(byteSwap(static_cast<uint32_t>(value))) << 32) |
+         byteSwap(static_cast<uint32_t>(value >> 32));
+}
+
+} // namespace detail
+
 /*!
- * \brief Writes an unsigned 8-bit integer to a buffer at offset in big endian encoding.
+ * \brief Loads a little endian integer from an arbitrarily aligned address.
  *
- * \param buf The buffer to write to.
- * \param v Value which will be written.
+ * \param ptr Address of the first byte.
+ *
+ * \returns The value of the read integer.
+ */
+template <typename T>
+inline T loadLittleEndian(const uint8_t* ptr)
+{
+  typedef typename std::make_unsigned<T>::type Unsigned;
+  Unsigned value;
+  std::memcpy(&value, ptr, sizeof(value));
+  if (!HOST_IS_LITTLE_ENDIAN)
+  {
+    value = detail::byteSwap(value);
+  }
+  return static_cast<T>(value);
+}
 
+/*!
+ * \brief Loads a big endian integer from an arbitrarily aligned address.
+ *
+ * \param ptr Address of the first byte.
+ *
+ * \returns The value of the read integer.
  */
-inline void writeUint8BigEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+template <typename T>
+inline T loadBigEndian(const uint8_t* ptr)
 {
-  writeUint8(it, v);
+  typedef typename std::make_unsigned<T>::type Unsigned;
+  Unsigned value;
+  std::memcpy(&value, ptr, sizeof(value));
+  if (HOST_IS_LITTLE_ENDIAN)
+  {
+    value = detail::byteSwap(value);
+  }
+  return static_cast<T>(value);
 }
 
 /*!
- * \brief Writes an unsigned 8-bit integer to a buffer at offset in little endian encoding.
+ * \brief Stores an integer in little endian encoding to an arbitrarily aligned address.
  *
- * \param buf The buffer to write to.
+ * \param ptr Address of the first byte.
  * \param v Value which will be written.
-
  */
-inline void writeUint8LittleEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+template <typename T>
+inline void storeLittleEndian(uint8_t* ptr, const T v)
 {
-  writeUint8(it, v);
+  typedef typename std::make_unsigned<T>::type Unsigned;
+  Unsigned value = static_cast<Unsigned>(v);
+  if (!HOST_IS_LITTLE_ENDIAN)
+  {
+    value = detail::byteSwap(value);
+  }
+  std::memcpy(ptr, &value, sizeof(value));
 }
 
 /*!
- * \brief Writes a signed 8-bit integer to a buffer at offset.
+ * \brief Stores an integer in big endian encoding to an arbitrarily aligned address.
  *
- * \param buf The buffer to write to.
+ * \param ptr Address of the first byte.
  * \param v Value which will be written.
-
  */
-inline void writeInt8(std::vector<uint8_t>::iterator it, const uint8_t v)
+template <typename T>
+inline void storeBigEndian(uint8_t* ptr, const T v)
 {
-  writeUint8(it, v);
+  typedef typename std::make_unsigned<T>::type Unsigned;
+  Unsigned value = static_cast<Unsigned>(v);
+  if (HOST_IS_LITTLE_ENDIAN)
+  {
+    value = detail::byteSwap(value);
+  }
+  std::memcpy(ptr, &value, sizeof(value));
 }
 
 /*!
- * \brief Writes a signed 8-bit integer to a buffer at offset in big endian encoding.
+ * \brief Writes an unsigned 8-bit integer to a buffer.
  *
- * \param buf The buffer to write to.
+ * \param ptr Address to write to.
  * \param v Value which will be written.
-
  */
-inline void writeInt8BigEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+inline void writeUint8(uint8_t* ptr, const uint8_t v)
 {
-  writeInt8(it, v);
+  storeLittleEndian<uint8_t>(ptr, v);
 }
 
 /*!
- * \brief Writes a signed 8-bit integer to a buffer at offset in little endian encoding.
+ * \brief Writes an unsigned 8-bit integer to a buffer in big endian encoding.
  *
- * \param buf The buffer to write to.
+ * \param ptr Address to write to.
  * \param v Value which will be written.
-
  */
-inline void writeInt8LittleEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+inline void writeUint8BigEndian(uint8_t* ptr, const uint8_t v)
 {
-  writeInt8(it, v);
+  storeBigEndian<uint8_t>(ptr, v);
 }
 
 /*!
- * \brief Writes an unsigned 16-bit integer to a buffer at offset in big endian encoding.
+ * \brief Writes an unsigned 8-bit integer to a buffer in little endian encoding.
  *
- * \param buf The buffer to write to.
+ * \param ptr Address to write to.
  * \param v Value which will be written.
-
  */
-inline void writeUint16BigEndian(std::vector<uint8_t>::iterator it, const uint16_t v)
+inline void writeUint8LittleEndian(uint8_t* ptr, const uint8_t v)
 {
-  *(it + 0) = (v & 0xff00) >> 8;
-  *(it + 1) = v & 0xff;
+  storeLittleEndian<uint8_t>(ptr, v);
 }
 
 /*!
- * \brief Writes an unsigned 16-bit integer to a buffer at offset in little endian encoding.
+ * \brief Writes a signed 8-bit integer to a buffer.
  *
- * \param buf The buffer to write to.
+ * \param ptr Address to write to.
  * \param v Value which will be written.
-
  */
-inline void writeUint16LittleEndian(std::vector<uint8_t>::iterator it, const uint16_t v)
+inline void writeInt8(uint8_t* ptr, const uint8_t v)
 {
-  *(it + 0) = v & 0xff;
-  *(it + 1) = (v & 0xff00) >> 8;
+  storeLittleEndian<uint8_t>(ptr, v);
 }
 
+/*!
+ * \brief Writes a signed 8-bit integer to a buffer in big endian encoding.
+ *
+ * \param ptr Address to write to.
+ * \param v Value which will be written.
+ */
+inline void writeInt8BigEndian(uint8_t* ptr, const uint8_t v)
+{
+  storeBigEndian<uint8_t>(ptr, v);
+}
 
 /*!
- * \brief Writes an unsigned 32-bit integer to a buffer at offset in big endian encoding.
+ * \brief Writes a signed 8-bit integer to a buffer in little endian encoding.
  *
- * \param buf The buffer to write to.
+ * \param ptr Address to write to.
  * \param v Value which will be written.
+ */
+inline void writeInt8LittleEndian(uint8_t* ptr, const uint8_t v)
+{
+  storeLittleEndian<uint8_t>(ptr, v);
+}
 
+/*!
+ * \brief Writes an unsigned 16-bit integer to a buffer in big endian encoding.
+ *
+ * \param ptr Address to write to.
+ * \param v Value which will be written.
  */
-inline void writeUint32BigEndian(std::vector<uint8_t>::iterator it, const uint32_t v)
+inline void writeUint16BigEndian(uint8_t* ptr, const uint16_t v)
 {
-  *(it + 0) = (v & 0xff000000) >> 24;
-  *(it + 1) = (v & 0xff0000) >> 16;
-  *(it + 2) = (v & 0xff00) >> 8;
-  *(it + 3) = v & 0xff;
+  storeBigEndian<uint16_t>(ptr, v);
 }
 
 /*!
- * \brief Writes an unsigned 32-bit integer to a buffer at offset in little endian encoding.
+ * \brief Writes an unsigned 16-bit integer to a buffer in little endian encoding.
  *
- * \param buf The buffer to write to.
+ * \param ptr Address to write to.
  * \param v Value which will be written.
+ */
+inline void writeUint16LittleEndian(uint8_t* ptr, const uint16_t v)
+{
+  storeLittleEndian<uint16_t>(ptr, v);
+}
 
+/*!
+ * \brief Writes an unsigned 32-bit integer to a buffer in big endian encoding.
+ *
+ * \param ptr Address to write to.
+ * \param v Value which will be written.
  */
-inline void writeUint32LittleEndian(std::vector<uint8_t>::iterator it, const uint32_t v)
+inline void writeUint32BigEndian(uint8_t* ptr, const uint32_t v)
 {
-  *(it + 3) = (v & 0xff000000) >> 24;
-  *(it + 2) = (v & 0xff0000) >> 16;
-  *(it + 1) = (v & 0xff00) >> 8;
-  *(it + 0) = v & 0xff;
+  storeBigEndian<uint32_t>(ptr, v);
 }
 
 /*!
- * \brief Writes a signed 32-bit integer to a buffer at offset in little endian encoding.
+ * \brief Writes an unsigned 32-bit integer to a buffer in little endian encoding.
  *
- * \param buf The buffer to write to.
+ * \param ptr Address to write to.
  * \param v Value which will be written.
+ */
+inline void writeUint32LittleEndian(uint8_t* ptr, const uint32_t v)
+{
+  storeLittleEndian<uint32_t>(ptr, v);
+}
 
+/*!
+ * \brief Writes a signed 32-bit integer to a buffer in little endian encoding.
+ *
+ * \param ptr Address to write to.
+ * \param v Value which will be written.
  */
-inline void writeInt32LittleEndian(std::vector<uint8_t>::iterator it, const int32_t v)
+inline void writeInt32LittleEndian(uint8_t* ptr, const int32_t v)
 {
-  *(it + 3) = (v & 0xff000000) >> 24;
-  *(it + 2) = (v & 0xff0000) >> 16;
-  *(it + 1) = (v & 0xff00) >> 8;
-  *(it + 0) = v & 0xff;
+  storeLittleEndian<int32_t>(ptr, v);
 }
 
 /*!
- * \brief Read an unsigned 8-bit integer at offset.
+ * \brief Read an unsigned 8-bit integer.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint8_t readUint8(std::vector<uint8_t>::const_iterator it)
+inline uint8_t readUint8(const uint8_t* ptr)
 {
-  return *(it + 0);
+  return loadLittleEndian<uint8_t>(ptr);
 }
 
 /*!
- * \brief Read an unsigned 8-bit integer at offset in big endian encoding.
+ * \brief Read an unsigned 8-bit integer in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint8_t readUint8BigEndian(std::vector<uint8_t>::const_iterator it)
+inline uint8_t readUint8BigEndian(const uint8_t* ptr)
 {
-  return readUint8(it);
+  return loadBigEndian<uint8_t>(ptr);
 }
 
 /*!
- * \brief Read an unsigned 8-bit integer at offset in big little encoding.
+ * \brief Read an unsigned 8-bit integer in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint8_t readUint8LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline uint8_t readUint8LittleEndian(const uint8_t* ptr)
 {
-  return readUint8(it);
+  return loadLittleEndian<uint8_t>(ptr);
 }
 
 /*!
- * \brief Read a signed 8-bit integer at offset.
+ * \brief Read a signed 8-bit integer.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline int8_t readInt8(std::vector<uint8_t>::const_iterator it)
+inline int8_t readInt8(const uint8_t* ptr)
 {
-  return readUint8(it);
+  return loadLittleEndian<int8_t>(ptr);
 }
 
 /*!
- * \brief Read a signed 8-bit integer at offset in big endian encoding.
+ * \brief Read a signed 8-bit integer in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline int8_t readInt8BigEndian(std::vector<uint8_t>::const_iterator it)
+inline int8_t readInt8BigEndian(const uint8_t* ptr)
 {
-  return readInt8(it);
+  return loadBigEndian<int8_t>(ptr);
 }
 
 /*!
- * \brief Read a signed 8-bit integer at offset in little endian encoding.
+ * \brief Read a signed 8-bit integer in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline int8_t readInt8LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline int8_t readInt8LittleEndian(const uint8_t* ptr)
 {
-  return readInt8(it);
+  return loadLittleEndian<int8_t>(ptr);
 }
 
 /*!
- * \brief Read an unsigned 16-bit integer at offset in big endian encoding.
+ * \brief Read an unsigned 16-bit integer in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint16_t readUint16BigEndian(std::vector<uint8_t>::const_iterator it)
+inline uint16_t readUint16BigEndian(const uint8_t* ptr)
 {
-  return (*(it + 0) << 8) + *(it + 1);
+  return loadBigEndian<uint16_t>(ptr);
 }
 
 /*!
- * \brief Read an unsigned 16-bit integer at offset in little endian encoding.
+ * \brief Read an unsigned 16-bit integer in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint16_t readUint16LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline uint16_t readUint16LittleEndian(const uint8_t* ptr)
 {
-  return (*(it + 1) << 8) + *(it + 0);
+  return loadLittleEndian<uint16_t>(ptr);
 }
 
 /*!
- * \brief Read a signed 16-bit integer at offset in big endian encoding.
+ * \brief Read a signed 16-bit integer in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline int16_t readInt16BigEndian(std::vector<uint8_t>::const_iterator it)
+inline int16_t readInt16BigEndian(const uint8_t* ptr)
 {
-  return readUint16BigEndian(it);
+  return loadBigEndian<int16_t>(ptr);
 }
 
 /*!
- * \brief Read a signed 16-bit integer at offset in little endian encoding.
+ * \brief Read a signed 16-bit integer in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline int16_t readInt16LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline int16_t readInt16LittleEndian(const uint8_t* ptr)
 {
-  return readUint16LittleEndian(it);
+  return loadLittleEndian<int16_t>(ptr);
 }
 
 /*!
- * \brief Read an unsigned 32-bit integer at offset in big endian encoding.
+ * \brief Read an unsigned 32-bit integer in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint32_t readUint32BigEndian(std::vector<uint8_t>::const_iterator it)
+inline uint32_t readUint32BigEndian(const uint8_t* ptr)
 {
-  return (*(it + 0) << 24) + (*(it + 1) << 16) + (*(it + 2) << 8) + *(it + 3);
+  return loadBigEndian<uint32_t>(ptr);
 }
 
 /*!
- * \brief Read an unsigned 32-bit integer at offset in little endian encoding.
+ * \brief Read an unsigned 32-bit integer in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint32_t readUint32LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline uint32_t readUint32LittleEndian(const uint8_t* ptr)
 {
-  return (*(it + 3) << 24) + (*(it + 2) << 16) + (*(it + 1) << 8) + *(it + 0);
+  return loadLittleEndian<uint32_t>(ptr);
 }
 
 /*!
- * \brief Read an unsigned 32-bit integer at offset in big endian encoding.
+ * \brief Read a signed 32-bit integer in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
-inline int32_t readInt32BigEndian(std::vector<uint8_t>::const_iterator it)
+inline int32_t readInt32BigEndian(const uint8_t* ptr)
 {
-  return readUint32BigEndian(it);
+  return loadBigEndian<int32_t>(ptr);
 }
 
-
 /*!
- * \brief Read an unsigned 32-bit integer at offset in little endian encoding.
+ * \brief Read a signed 32-bit integer in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param ptr Address to read from.
  *
  * \returns The value of the read integer.
  */
+inline int32_t readInt32LittleEndian(const uint8_t* ptr)
+{
+  return loadLittleEndian<int32_t>(ptr);
+}
+
+/*!
+ * \brief Iterator overloads of the functions above.
+ */
+inline void writeUint8(std::vector<uint8_t>::iterator it, const uint8_t v)
+{
+  writeUint8(&(*it), v);
+}
+
+inline void writeUint8BigEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+{
+  writeUint8BigEndian(&(*it), v);
+}
+
+inline void writeUint8LittleEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+{
+  writeUint8LittleEndian(&(*it), v);
+}
+
+inline void writeInt8(std::vector<uint8_t>::iterator it, const uint8_t v)
+{
+  writeInt8(&(*it), v);
+}
+
+inline void writeInt8BigEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+{
+  writeInt8BigEndian(&(*it), v);
+}
+
+inline void writeInt8LittleEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+{
+  writeInt8LittleEndian(&(*it), v);
+}
+
+inline void writeUint16BigEndian(std::vector<uint8_t>::iterator it, const uint16_t v)
+{
+  writeUint16BigEndian(&(*it), v);
+}
+
+inline void writeUint16LittleEndian(std::vector<uint8_t>::iterator it, const uint16_t v)
+{
+  writeUint16LittleEndian(&(*it), v);
+}
+
+inline void writeUint32BigEndian(std::vector<uint8_t>::iterator it, const uint32_t v)
+{
+  writeUint32BigEndian(&(*it), v);
+}
+
+inline void writeUint32LittleEndian(std::vector<uint8_t>::iterator it, const uint32_t v)
+{
+  writeUint32LittleEndian(&(*it), v);
+}
+
+inline void writeInt32LittleEndian(std::vector<uint8_t>::iterator it, const int32_t v)
+{
+  writeInt32LittleEndian(&(*it), v);
+}
+
+inline uint8_t readUint8(std::vector<uint8_t>::const_iterator it)
+{
+  return readUint8(&(*it));
+}
+
+inline uint8_t readUint8BigEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readUint8BigEndian(&(*it));
+}
+
+inline uint8_t readUint8LittleEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readUint8LittleEndian(&(*it));
+}
+
+inline int8_t readInt8(std::vector<uint8_t>::const_iterator it)
+{
+  return readInt8(&(*it));
+}
+
+inline int8_t readInt8BigEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readInt8BigEndian(&(*it));
+}
+
+inline int8_t readInt8LittleEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readInt8LittleEndian(&(*it));
+}
+
+inline uint16_t readUint16BigEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readUint16BigEndian(&(*it));
+}
+
+inline uint16_t readUint16LittleEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readUint16LittleEndian(&(*it));
+}
+
+inline int16_t readInt16BigEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readInt16BigEndian(&(*it));
+}
+
+inline int16_t readInt16LittleEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readInt16LittleEndian(&(*it));
+}
+
+inline uint32_t readUint32BigEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readUint32BigEndian(&(*it));
+}
+
+inline uint32_t readUint32LittleEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readUint32LittleEndian(&(*it));
+}
+
+inline int32_t readInt32BigEndian(std::vector<uint8_t>::const_iterator it)
+{
+  return readInt32BigEndian(&(*it));
+}
+
 inline int32_t readInt32LittleEndian(std::vector<uint8_t>::const_iterator it)
 {
-  return readUint32LittleEndian(it);
+  return readInt32LittleEndian(&(*it));
 }
 
+/*!
+ * \brief Read position in a borrowed byte buffer.
+ *
+ * The length of a block is validated once with require(), the following reads are unchecked
+ * and only assert in debug builds. The cursor does not own the bytes, the caller keeps the
+ * buffer alive while reading.
+ */
+class ByteCursor
+{
+public:
+  /*!
+   * \brief Constructs an empty cursor.
+   */
+  ByteCursor()
+    : m_begin(nullptr)
+    , m_end(nullptr)
+    , m_position(nullptr)
+  {
+  }
+
+  /*!
+   * \brief Constructs a cursor at the begin of a buffer.
+   *
+   * \param data Begin of the buffer.
+   * \param length Number of valid bytes starting at data.
+   */
+  ByteCursor(const uint8_t* data, std::size_t length)
+    : m_begin(data)
+    , m_end(data + length)
+    , m_position(data)
+  {
+  }
+
+  /*!
+   * \brief Constructs a cursor at the begin of a vector.
+   *
+   * \param buffer The vector to read from.
+   */
+  explicit ByteCursor(const std::vector<uint8_t>& buffer)
+    : ByteCursor(buffer.data(), buffer.size())
+  {
+  }
+
+  /*!
+   * \brief Returns a cursor over a block of this buffer, clipped to the end of the buffer.
+   *
+   * \param offset Offset of the block from the begin of the buffer.
+   * \param length Announced length of the block.
+   *
+   * \returns The cursor at the begin of the block. Use require() to check its length.
+   */
+  ByteCursor block(std::size_t offset, std::size_t length) const
+  {
+    std::size_t size = getSize();
+    if (offset >= size)
+    {
+      return ByteCursor(m_end, 0);
+    }
+    return ByteCursor(m_begin + offset, length < size - offset ? length : size - offset);
+  }
+
+  /*!
+   * \brief Checks that at least length bytes follow the current position.
+   *
+   * \param length Number of bytes which will be read.
+   *
+   * \returns True if the bytes are available.
+   */
+  bool require(std::size_t length) const { return getRemaining() >= length; }
+
+  /*!
+   * \brief Moves the position to an offset from the begin of the buffer.
+   *
+   * \param offset The new position.
+   *
+   * \returns False if the offset is behind the end, the position is unchanged then.
+   */
+  bool seek(std::size_t offset)
+  {
+    if (offset > getSize())
+    {
+      return false;
+    }
+    m_position = m_begin + offset;
+    return true;
+  }
+
+  /*!
+   * \brief Advances the position.
+   *
+   * \param length Number of bytes to skip.
+   *
+   * \returns False if fewer bytes remain, the position is unchanged then.
+   */
+  bool skip(std::size_t length)
+  {
+    if (!require(length))
+    {
+      return false;
+    }
+    m_position += length;
+    return true;
+  }
+
+  /*!
+   * \brief Reads a little endian integer at the position and advances behind it.
+   *
+   * \returns The value of the read integer.
+   */
+  template <typename T>
+  T readLittleEndian()
+  {
+    T value = peekLittleEndian<T>(0);
+    m_position += sizeof(T);
+    return value;
+  }
+
+  /*!
+   * \brief Reads a big endian integer at the position and advances behind it.
+   *
+   * \returns The value of the read integer.
+   */
+  template <typename T>
+  T readBigEndian()
+  {
+    T value = peekBigEndian<T>(0);
+    m_position += sizeof(T);
+    return value;
+  }
+
+  /*!
+   * \brief Reads a little endian integer at an offset from the position without advancing.
+   *
+   * \param offset Offset from the current position.
+   *
+   * \returns The value of the read integer.
+   */
+  template <typename T>
+  T peekLittleEndian(std::size_t offset) const
+  {
+    assert(require(offset + sizeof(T)));
+    return loadLittleEndian<T>(m_position + offset);
+  }
+
+  /*!
+   * \brief Reads a big endian integer at an offset from the position without advancing.
+   *
+   * \param offset Offset from the current position.
+   *
+   * \returns The value of the read integer.
+   */
+  template <typename T>
+  T peekBigEndian(std::size_t offset) const
+  {
+    assert(require(offset + sizeof(T)));
+    return loadBigEndian<T>(m_position + offset);
+  }
+
+  /*!
+   * \brief Returns the address of the current position.
+   *
+   * \returns The address of the current position.
+   */
+  const uint8_t* getData() const { return m_position; }
+
+  /*!
+   * \brief Returns the offset of the current position from the begin of the buffer.
+   *
+   * \returns The offset of the current position.
+   */
+  std::size_t getPosition() const { return static_cast<std::size_t>(m_position - m_begin); }
+
+  /*!
+   * \brief Returns the number of bytes behind the current position.
+   *
+   * \returns The number of remaining bytes.
+   */
+  std::size_t getRemaining() const { return static_cast<std::size_t>(m_end - m_position); }
+
+  /*!
+   * \brief Returns the length of the buffer.
+   *
+   * \returns The length of the buffer.
+   */
+  std::size_t getSize() const { return static_cast<std::size_t>(m_end - m_begin); }
+
+private:
+  const uint8_t* m_begin;
+  const uint8_t* m_end;
+  const uint8_t* m_position;
+};
+
 } // namespace read_write_helper
 } // namespace sick
 
@@ -0,0 +1,91 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file SequenceTracker.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_SEQUENCETRACKER_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_SEQUENCETRACKER_H
+
+#include "sick_safetyscanners_base/datastructure/DataHeader.h"
+
+#include <atomic>
+#include <stdint.h>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Counts the scan and sequence numbers skipped between consecutive scans of a sensor.
+ *
+ * Numbers going backwards or jumping far ahead are taken as a restart of the sensor and are not
+ * counted as gaps. The counters can be read from any thread.
+ */
+class SequenceTracker
+{
+public:
+  /*!
+   * \brief Constructor of the tracker.
+   */
+  SequenceTracker();
+
+  /*!
+   * \brief Compares the numbers of a scan with the ones of the previous scan.
+   *
+   * \param data_header The data header of the scan.
+   */
+  void update(const sick::datastructure::DataHeader& data_header);
+
+  /*!
+   * \brief Returns the number of scan numbers skipped so far.
+   *
+   * \returns The number of skipped scan numbers.
+   */
+  uint64_t getMissedScans() const;
+
+  /*!
+   * \brief Returns the number of sequence numbers skipped so far.
+   *
+   * \returns The number of skipped sequence numbers.
+   */
+  uint64_t getMissedSequenceNumbers() const;
+
+private:
+  bool m_has_previous;
+  uint32_t m_previous_scan_number;
+  uint32_t m_previous_sequence_number;
+  std::atomic<uint64_t> m_missed_scans;
+  std::atomic<uint64_t> m_missed_sequence_numbers;
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_SEQUENCETRACKER_H
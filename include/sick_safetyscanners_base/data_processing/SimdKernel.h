@@ -0,0 +1,71 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file SimdKernel.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_SIMDKERNEL_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_SIMDKERNEL_H
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Instruction set of the vectorized kernels of the beam decoder, the point cloud converter
+ * and the field evaluator.
+ */
+enum class SimdKernel
+{
+  SCALAR,
+  SSE2,
+  AVX2
+};
+
+/*!
+ * \brief Returns if a kernel is compiled in and supported by the CPU.
+ *
+ * \param kernel The kernel.
+ *
+ * \returns If the kernel can be used.
+ */
+bool isSimdKernelSupported(SimdKernel kernel);
+
+/*!
+ * \brief Returns the fastest kernel which is supported, detected once at runtime.
+ *
+ * \returns The kernel.
+ */
+SimdKernel getBestSimdKernel();
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_SIMDKERNEL_H
@@ -35,19 +35,35 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_UDPPACKETMERGER_H
 #define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_UDPPACKETMERGER_H
 
+#include "sick_safetyscanners_base/Types.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
-#include "sick_safetyscanners_base/datastructure/ParsedPacketBuffer.h"
+#include "sick_safetyscanners_base/datastructure/StreamCounters.h"
 
 #include "sick_safetyscanners_base/data_processing/ParseDatagramHeader.h"
 
-#include <algorithm>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace sick {
 namespace data_processing {
 
 /*!
  * \brief Merges udp packets together to a complete data packet.
+ *
+ * The payload of every datagram is copied directly to its fragment offset in a preallocated slab
+ * of the total length of the data packet. Completion is tracked by counting the received bytes.
+ * Slabs are recycled as soon as no deployed packet buffer references them anymore, so merging does
+ * not allocate once the merger reached its steady state. The number of slabs is bounded by the
+ * identification window plus MAX_PINNED_SLABS, a slab still pinned by a consumer beyond that bound
+ * leaves its buffer to the consumer and is given a new one.
+ *
+ * Packets whose fragments were lost never complete. They are evicted once their identification
+ * falls out of a window behind the newest identification, or once their first datagram is older
+ * than a maximum age, so that a lossy link does not grow the memory of the merger.
+ *
+ * Fragments behind the window are skipped as late. A new packet starting behind the window, or a
+ * short run of late fragments, is taken as a restart of the sensor and the window follows it.
  */
 class UDPPacketMerger
 {
@@ -74,30 +90,106 @@ public:
   bool addUDPPacket(const sick::datastructure::PacketBuffer& buffer);
 
   /*!
-   * \brief Get the latest complete data packet.
+   * \brief Get the latest complete data packet. Its receive time is the one of the first datagram
+   * received for it.
    *
    * \returns The latest complete data packet.
    */
   sick::datastructure::PacketBuffer getDeployedPacketBuffer();
 
+  /*!
+   * \brief Sets when partial packets are evicted.
+   *
+   * \param identification_window Number of identifications a partial packet may fall behind the
+   * newest one, fragments of older packets are skipped.
+   * \param max_age Maximum time between the first datagram of a partial packet and the latest
+   * datagram. Only applies to datagrams with a receive time.
+   */
+  void setEvictionPolicy(uint32_t identification_window, sick::types::time_duration_t max_age);
+
+  /*!
+   * \brief Sets a handler which is called whenever a fragment was added to a data packet.
+   *
+   * Fragments are copied in place, so the handler sees every received fragment in the buffer of the
+   * full data packet. It is called from addUDPPacket() with the merger locked and before the data
+   * packet is deployed, it must not keep the buffer or call into the merger.
+   *
+   * \param handler The handler, an empty function disables it.
+   */
+  void setProgressHandler(const sick::types::PacketProgressHandler& handler);
+
+  /*!
+   * \brief Returns the counters of the merger. The sequence counters are not tracked by the merger
+   * and always zero.
+   *
+   * \returns The counters.
+   */
+  sick::datastructure::StreamCounters getCounters() const;
+
+  /*!
+   * \brief Default number of identifications a partial packet may fall behind the newest one.
+   */
+  static const uint32_t DEFAULT_IDENTIFICATION_WINDOW = 8;
+
+  /*!
+   * \brief Default maximum age of a partial packet in milliseconds.
+   */
+  static const int64_t DEFAULT_MAX_AGE_MS = 500;
+
+  /*!
+   * \brief Number of slabs kept in addition to the identification window for deployed packets
+   * which are still referenced by consumers.
+   */
+  static const uint32_t MAX_PINNED_SLABS = 8;
+
 private:
+  /*!
+   * \brief Reassembly state of a single data packet.
+   */
+  struct ReassemblySlab
+  {
+    bool in_use;
+    uint32_t identification;
+    uint32_t total_length;
+    uint32_t received_length;
+    uint32_t max_fragment_length;
+    uint32_t highest_offset;
+    uint32_t contiguous_length;
+    bool is_completed;
+    int64_t first_receive_time;
+    std::vector<uint32_t> fragment_offsets;
+    std::vector<uint32_t> fragment_lengths;
+    std::shared_ptr<std::vector<uint8_t>> buffer;
+  };
+
   bool m_is_complete;
   sick::datastructure::PacketBuffer m_deployed_packet_buffer;
 
-  std::map<uint32_t, sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector>
-    m_parsed_packet_buffer_map;
-  std::mutex m_buffer_mutex;
-
-  bool addToMap(const sick::datastructure::PacketBuffer& buffer,
-                const sick::datastructure::DatagramHeader& header);
-  bool deployPacketIfComplete(datastructure::DatagramHeader& header);
-  bool checkIfComplete(sick::datastructure::DatagramHeader& header);
-  uint32_t calcualteCurrentLengthOfParsedPacketBuffer(
-    const sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector& vec);
-  sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector
-  getSortedParsedPacketBufferForIdentification(const sick::datastructure::DatagramHeader& header);
-  std::vector<uint8_t> removeHeaderFromParsedPacketBuffer(
-    const sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector& vec);
+  std::vector<ReassemblySlab> m_slabs;
+  mutable std::mutex m_buffer_mutex;
+
+  uint32_t m_identification_window;
+  int64_t m_max_age;
+  bool m_has_newest_identification;
+  uint32_t m_newest_identification;
+  uint32_t m_late_fragments_in_row;
+  sick::datastructure::StreamCounters m_counters;
+  sick::types::PacketProgressHandler m_progress_handler;
+
+  bool isLate(const sick::datastructure::DatagramHeader& header);
+  bool isDeployed(uint32_t identification) const;
+  std::size_t getMaxSlabs() const;
+  void evictSlabs(int64_t receive_time);
+  void evictSlab(ReassemblySlab& slab);
+  ReassemblySlab* findSlab(const sick::datastructure::DatagramHeader& header);
+  ReassemblySlab* acquireSlab(const sick::datastructure::DatagramHeader& header,
+                              int64_t receive_time);
+  bool addToSlab(const sick::datastructure::PacketBuffer& buffer,
+                 const sick::datastructure::DatagramHeader& header,
+                 ReassemblySlab& slab);
+  void advanceContiguousLength(ReassemblySlab& slab);
+  void reportProgress(const ReassemblySlab& slab) const;
+  bool deployPacketIfComplete(ReassemblySlab& slab);
 };
 
 } // namespace data_processing
@@ -60,7 +60,7 @@ public:
    *
    * \returns The unsafe input sources.
    */
-  std::vector<bool> getUnsafeInputsInputSourcesVector() const;
+  const std::vector<bool>& getUnsafeInputsInputSourcesVector() const;
   void
     /*!
      * \brief Sets the unsafe input sources.
@@ -69,6 +69,14 @@ public:
      */
   setUnsafeInputsInputSourcesVector(const std::vector<bool>& unsafe_inputs_input_sources_vector);
 
+  /*!
+   * \brief Sets the unsafe input sources.
+   * Takes over the memory of the vector.
+   *
+   * \param unsafe_inputs_input_sources_vector The unsafe input sources.
+   */
+  void setUnsafeInputsInputSourcesVector(std::vector<bool>&& unsafe_inputs_input_sources_vector);
+
   /*!
    * \brief Gets the flags for the unsafe input sources.
    *
@@ -78,7 +86,7 @@ public:
    *
    * \returns The unsafe input sources flags.
    */
-  std::vector<bool> getUnsafeInputsFlagsVector() const;
+  const std::vector<bool>& getUnsafeInputsFlagsVector() const;
   /*!
    * \brief Sets the unsafe input sources flags.
    *
@@ -86,12 +94,20 @@ public:
    */
   void setUnsafeInputsFlagsVector(const std::vector<bool>& unsafe_inputs_flags_vector);
 
+  /*!
+   * \brief Sets the unsafe input sources flags.
+   * Takes over the memory of the vector.
+   *
+   * \param unsafe_inputs_flags_vector The unsafe input sources flags.
+   */
+  void setUnsafeInputsFlagsVector(std::vector<bool>&& unsafe_inputs_flags_vector);
+
   /*!
    * \brief Gets the monitoring case numbers.
    *
    * \returns The monitoring case vector.
    */
-  std::vector<uint16_t> getMonitoringCasevector() const;
+  const std::vector<uint16_t>& getMonitoringCasevector() const;
   /*!
    * \brief Sets the monitoring case vector.
    *
@@ -99,12 +115,20 @@ public:
    */
   void setMonitoringCaseVector(const std::vector<uint16_t>& monitoring_case_vector);
 
+  /*!
+   * \brief Sets the monitoring case vector.
+   * Takes over the memory of the vector.
+   *
+   * \param monitoring_case_vector The monitoring case vector.
+   */
+  void setMonitoringCaseVector(std::vector<uint16_t>&& monitoring_case_vector);
+
   /*!
    * \brief Gets the monitoring case flags.
    *
    * \returns The monitoring case flags.
    */
-  std::vector<bool> getMonitoringCaseFlagsVector() const;
+  const std::vector<bool>& getMonitoringCaseFlagsVector() const;
   /*!
    * \brief Sets the monitoring case flags.
    *
@@ -112,6 +136,14 @@ public:
    */
   void setMonitoringCaseFlagsVector(const std::vector<bool>& monitoring_case_flags_vector);
 
+  /*!
+   * \brief Sets the monitoring case flags.
+   * Takes over the memory of the vector.
+   *
+   * \param monitoring_case_flags_vector The monitoring case flags.
+   */
+  void setMonitoringCaseFlagsVector(std::vector<bool>&& monitoring_case_flags_vector);
+
   /*!
    * \brief Gets the first linear velocity input.
    *
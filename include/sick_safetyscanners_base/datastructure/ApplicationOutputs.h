@@ -58,7 +58,7 @@ public:
    *
    * \returns The state of the non safe cut-off paths.
    */
-  std::vector<bool> getEvalOutVector() const;
+  const std::vector<bool>& getEvalOutVector() const;
   /*!
    * \brief Set the state of the non safe cut-off paths.
    *
@@ -66,12 +66,20 @@ public:
    */
   void setEvalOutVector(const std::vector<bool>& eval_out_vector);
 
+  /*!
+   * \brief Set the state of the non safe cut-off paths.
+   * Takes over the memory of the vector.
+   *
+   * \param eval_out_vector The state of the non safe cut-off paths.
+   */
+  void setEvalOutVector(std::vector<bool>&& eval_out_vector);
+
   /*!
    * \brief Gets if a cut-off path from the output paths is safe.
    *
    * \returns If a cut-off path is safe.
    */
-  std::vector<bool> getEvalOutIsSafeVector() const;
+  const std::vector<bool>& getEvalOutIsSafeVector() const;
   /*!
    * \brief Sets if an cut-off path is safe.
    *
@@ -79,12 +87,20 @@ public:
    */
   void setEvalOutIsSafeVector(const std::vector<bool>& eval_out_is_safe_vector);
 
+  /*!
+   * \brief Sets if an cut-off path is safe.
+   * Takes over the memory of the vector.
+   *
+   * \param eval_out_is_safe_vector If a cut off path is safe.
+   */
+  void setEvalOutIsSafeVector(std::vector<bool>&& eval_out_is_safe_vector);
+
   /*!
    * \brief If the output path is valid.
    *
    * \returns If the output path is valid.
    */
-  std::vector<bool> getEvalOutIsValidVector() const;
+  const std::vector<bool>& getEvalOutIsValidVector() const;
   /*!
    * \brief Sets if an output path is valid.
    *
@@ -92,12 +108,20 @@ public:
    */
   void setEvalOutIsValidVector(const std::vector<bool>& eval_out_is_valid_vector);
 
+  /*!
+   * \brief Sets if an output path is valid.
+   * Takes over the memory of the vector.
+   *
+   * \param eval_out_is_valid_vector If an output path is valid.
+   */
+  void setEvalOutIsValidVector(std::vector<bool>&& eval_out_is_valid_vector);
+
   /*!
    * \brief Gets the currently active monitoring case numbers.
    *
    * \returns The monitoring case numbers.
    */
-  std::vector<uint16_t> getMonitoringCaseVector() const;
+  const std::vector<uint16_t>& getMonitoringCaseVector() const;
   /*!
    * \brief Sets the currently active monitoring case numbers.
    *
@@ -105,12 +129,20 @@ public:
    */
   void setMonitoringCaseVector(const std::vector<uint16_t>& monitoring_case_vector);
 
+  /*!
+   * \brief Sets the currently active monitoring case numbers.
+   * Takes over the memory of the vector.
+   *
+   * \param monitoring_case_vector The monitoring case numbers.
+   */
+  void setMonitoringCaseVector(std::vector<uint16_t>&& monitoring_case_vector);
+
   /*!
    * \brief Gets if the corresponding monitoring case number is valid.
    *
    * \returns If the monitoring case number is valid.
    */
-  std::vector<bool> getMonitoringCaseFlagsVector() const;
+  const std::vector<bool>& getMonitoringCaseFlagsVector() const;
   /*!
    * \brief Set is the corresponding monitoring case number is valid.
    *
@@ -118,6 +150,14 @@ public:
    */
   void setMonitoringCaseFlagsVector(const std::vector<bool>& monitoring_case_flags_vector);
 
+  /*!
+   * \brief Set is the corresponding monitoring case number is valid.
+   * Takes over the memory of the vector.
+   *
+   * \param monitoring_case_flags_vector If the monitoring case number is valid.
+   */
+  void setMonitoringCaseFlagsVector(std::vector<bool>&& monitoring_case_flags_vector);
+
   /*!
    * \brief Gets the state of the sleep mode.
    *
@@ -293,7 +333,7 @@ public:
    *
    * \returns  The resulting velocity for each monitoring case table.
    */
-  std::vector<int16_t> getResultingVelocityVector() const;
+  const std::vector<int16_t>& getResultingVelocityVector() const;
   /*!
    * \brief Sets the resulting velocity for each monitoring case table.
    *
@@ -301,12 +341,20 @@ public:
    */
   void setResultingVelocityVector(const std::vector<int16_t>& resulting_velocity_vector);
 
+  /*!
+   * \brief Sets the resulting velocity for each monitoring case table.
+   * Takes over the memory of the vector.
+   *
+   * \param resulting_velocity_vector The resulting velocity for each monitoring case table.
+   */
+  void setResultingVelocityVector(std::vector<int16_t>&& resulting_velocity_vector);
+
   /*!
    * \brief Gets if the resulting velocities are valid.
    *
    * \returns  If the resulting velocities are valid.
    */
-  std::vector<bool> getResultingVelocityIsValidVector() const;
+  const std::vector<bool>& getResultingVelocityIsValidVector() const;
   void
     /*!
      * \brief Sets if the resulting velocities are valid.
@@ -315,6 +363,14 @@ public:
      */
   setResultingVelocityIsValidVector(const std::vector<bool>& resulting_velocity_is_valid_vector);
 
+  /*!
+   * \brief Sets if the resulting velocities are valid.
+   * Takes over the memory of the vector.
+   *
+   * \param resulting_velocity_is_valid_vector If the resulting velocities are valid.
+   */
+  void setResultingVelocityIsValidVector(std::vector<bool>&& resulting_velocity_is_valid_vector);
+
   /*!
    * \brief Gets if the sleep mode is valid.
    *
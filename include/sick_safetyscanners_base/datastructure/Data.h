@@ -35,7 +35,9 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATA_H
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATA_H
 
+#include <functional>
 #include <memory>
+#include <mutex>
 
 #include "sick_safetyscanners_base/datastructure/ApplicationData.h"
 #include "sick_safetyscanners_base/datastructure/ApplicationInputs.h"
@@ -60,6 +62,38 @@ public:
    */
   Data();
 
+  /*!
+   * \brief Copies the data, the blocks are shared with the other instance.
+   *
+   * \param other The data to copy.
+   */
+  Data(const Data& other) = default;
+
+  /*!
+   * \brief Moves the data, the other instance is left without blocks.
+   *
+   * \param other The data to move from.
+   */
+  Data(Data&& other) = default;
+
+  /*!
+   * \brief Copies the data, the blocks are shared with the other instance.
+   *
+   * \param other The data to copy.
+   *
+   * \returns This instance.
+   */
+  Data& operator=(const Data& other) = default;
+
+  /*!
+   * \brief Moves the data, the other instance is left without blocks.
+   *
+   * \param other The data to move from.
+   *
+   * \returns This instance.
+   */
+  Data& operator=(Data&& other) = default;
+
   /*!
    * \brief Gets the data header.
    *
@@ -139,13 +173,54 @@ public:
    */
   void setApplicationDataPtr(const std::shared_ptr<ApplicationData>& application_data_ptr);
 
+  /*!
+   * \brief Gets the time the first datagram of the scan was received.
+   *
+   * \returns Nanoseconds since the epoch as in sick::datastructure::PacketBuffer, zero if unknown.
+   */
+  int64_t getReceiveTime() const;
+  /*!
+   * \brief Sets the time the first datagram of the scan was received.
+   *
+   * \param receive_time Nanoseconds since the epoch, zero if unknown.
+   */
+  void setReceiveTime(int64_t receive_time);
+
+  /*!
+   * \brief Function parsing a single data block into the data on first access.
+   */
+  using BlockLoader = std::function<void(uint16_t block, Data& data)>;
+
+  /*!
+   * \brief Defers parsing of data blocks until they are accessed for the first time.
+   *
+   * \param blocks Bitset of the blocks to defer, see sick::SensorDataFeatures.
+   * \param loader Function parsing a single block into the data.
+   */
+  void setLazyBlocks(uint16_t blocks, const BlockLoader& loader);
+
+  /*!
+   * \brief Returns the blocks which are not parsed yet.
+   *
+   * \returns Bitset of the deferred blocks, see sick::SensorDataFeatures.
+   */
+  uint16_t getLazyBlocks() const;
+
 private:
   std::shared_ptr<DataHeader> m_data_header_ptr;
-  std::shared_ptr<GeneralSystemState> m_general_system_state_ptr;
-  std::shared_ptr<DerivedValues> m_derived_values_ptr;
-  std::shared_ptr<MeasurementData> m_measurement_data_ptr;
-  std::shared_ptr<IntrusionData> m_intrusion_data_ptr;
-  std::shared_ptr<ApplicationData> m_application_data_ptr;
+  // Blocks are mutable so that deferred blocks can be parsed on access through a const instance.
+  mutable std::shared_ptr<GeneralSystemState> m_general_system_state_ptr;
+  mutable std::shared_ptr<DerivedValues> m_derived_values_ptr;
+  mutable std::shared_ptr<MeasurementData> m_measurement_data_ptr;
+  mutable std::shared_ptr<IntrusionData> m_intrusion_data_ptr;
+  mutable std::shared_ptr<ApplicationData> m_application_data_ptr;
+
+  int64_t m_receive_time;
+  mutable uint16_t m_lazy_blocks;
+  BlockLoader m_block_loader;
+  std::shared_ptr<std::recursive_mutex> m_lazy_mutex;
+
+  void loadBlock(uint16_t block) const;
 };
 
 } // namespace datastructure
@@ -46,6 +46,8 @@ namespace datastructure {
 class DataHeader
 {
 public:
+  static const uint32_t HEADER_SIZE = 52;
+
   /*!
    * \brief Constructor of an empty data header.
    */
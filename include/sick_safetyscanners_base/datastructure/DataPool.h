@@ -0,0 +1,126 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataPool.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATAPOOL_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATAPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "sick_safetyscanners_base/datastructure/Data.h"
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Pool of recycled data instances.
+ *
+ * A handed out instance is checked out until the last reference to it is dropped, which returns it
+ * to the pool. Parsing into a recycled instance reuses its data blocks and their containers, as
+ * long as the blocks are not referenced from elsewhere, so that a steady stream of scans does not
+ * allocate. The reference counts of a handed out instance are kept in storage of its pool entry as
+ * well.
+ */
+class DataPool
+{
+public:
+  /*!
+   * \brief Default number of instances kept in the pool.
+   */
+  static const std::size_t DEFAULT_MAX_SIZE = 4;
+
+  /*!
+   * \brief Constructor of the data pool.
+   *
+   * \param max_size Maximum number of instances kept in the pool.
+   */
+  explicit DataPool(std::size_t max_size = DEFAULT_MAX_SIZE);
+
+  /*!
+   * \brief Returns an unused instance of the pool. If all pooled instances are in use and the pool
+   * is full, a new instance is returned which is not recycled.
+   *
+   * \returns The data instance, its content is undefined until it is parsed into.
+   */
+  std::shared_ptr<Data> acquire();
+
+  /*!
+   * \brief Drops the reference of the caller once the instance has been processed. The instance
+   * returns to the pool as soon as no one else holds it, its references into the raw packet buffer,
+   * e.g. from deferred blocks, are dropped then.
+   *
+   * \param data The instance to release, reset afterwards.
+   */
+  void release(std::shared_ptr<Data>& data);
+
+  /*!
+   * \brief Returns the number of instances currently held by the pool.
+   *
+   * \returns The number of pooled instances.
+   */
+  std::size_t getSize() const;
+
+  /*!
+   * \brief Returns the maximum number of instances held by the pool.
+   *
+   * \returns The maximum number of pooled instances.
+   */
+  std::size_t getMaxSize() const;
+
+  /*!
+   * \brief Sets the maximum number of instances held by the pool. Instances beyond the new maximum
+   * are dropped from the pool once they are released.
+   *
+   * \param max_size Maximum number of pooled instances.
+   */
+  void setMaxSize(std::size_t max_size);
+
+private:
+  struct Slot;
+  struct Returner;
+  template <typename T>
+  struct SlotAllocator;
+
+  std::size_t m_max_size;
+  std::vector<std::shared_ptr<Slot>> m_slots;
+  mutable std::mutex m_mutex;
+
+  std::shared_ptr<Data> checkOut(const std::shared_ptr<Slot>& slot);
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATAPOOL_H
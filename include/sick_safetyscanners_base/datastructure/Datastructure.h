@@ -6,6 +6,7 @@
 #include "ConfigData.h"
 #include "ConfigMetadata.h"
 #include "Data.h"
+#include "DataPool.h"
 #include "DataHeader.h"
 #include "DatagramHeader.h"
 #include "DerivedValues.h"
@@ -17,16 +18,22 @@
 #include "GeneralSystemState.h"
 #include "IntrusionData.h"
 #include "IntrusionDatum.h"
+#include "LatencyHistogram.h"
+#include "LatencyStatistics.h"
 #include "LatestTelegram.h"
+#include "LockFreeRing.h"
 #include "MeasurementData.h"
 #include "MonitoringCaseData.h"
 #include "OrderNumber.h"
 #include "PacketBuffer.h"
 #include "ParsedPacketBuffer.h"
 #include "ProjectName.h"
+#include "RequestTiming.h"
 #include "RequiredUserAction.h"
 #include "ScanPoint.h"
+#include "SensorSnapshot.h"
 #include "SerialNumber.h"
 #include "StatusOverview.h"
+#include "StreamCounters.h"
 #include "TypeCode.h"
 #include "UserName.h"
\ No newline at end of file
@@ -248,7 +248,7 @@ public:
    *
    * \returns Vector with beam distances.
    */
-  std::vector<uint16_t> getBeamDistances() const;
+  const std::vector<uint16_t>& getBeamDistances() const;
 
   /*!
    * \brief Sets vector with beam distances for field.
@@ -257,6 +257,14 @@ public:
    */
   void setBeamDistances(const std::vector<uint16_t>& beam_distances);
 
+  /*!
+   * \brief Sets vector with beam distances for field.
+   * Takes over the memory of the vector.
+   *
+   * \param beam_distances New beam distances for field.
+   */
+  void setBeamDistances(std::vector<uint16_t>&& beam_distances);
+
   /*!
    * \brief Get the start angle of the scan.
    * \return Start angle of the scan.
@@ -108,19 +108,27 @@ public:
    *
    * \returns The length of the field name.
    */
-  std::vector<uint32_t> getNameLength() const;
+  const std::vector<uint32_t>& getNameLength() const;
   /*!
    * \brief Sets the length of the field name.
    *
    * \param name_length The length of the field name.
    */
   void setNameLength(const std::vector<uint32_t>& name_length);
+
+  /*!
+   * \brief Sets the length of the field name.
+   * Takes over the memory of the vector.
+   *
+   * \param name_length The length of the field name.
+   */
+  void setNameLength(std::vector<uint32_t>&& name_length);
   /*!
    * \brief Gets the field name for the scanner.
    *
    * \returns The field name for the scanner.
    */
-  std::vector<std::string> getFieldName() const;
+  const std::vector<std::string>& getFieldName() const;
   /*!
    * \brief Sets the field name for the scanner.
    *
@@ -128,12 +136,20 @@ public:
    */
   void setFieldName(const std::vector<std::string>& field_name);
 
+  /*!
+   * \brief Sets the field name for the scanner.
+   * Takes over the memory of the vector.
+   *
+   * \param field_name The field name for the scanner.
+   */
+  void setFieldName(std::vector<std::string>&& field_name);
+
   /*!
    * \brief Gets if the fields are defined.
    *
    * \returns if the fields are defined.
    */
-  std::vector<bool> getIsDefined() const;
+  const std::vector<bool>& getIsDefined() const;
   /*!
    * \brief Sets if the fields are defined.
    *
@@ -141,6 +157,14 @@ public:
    */
   void setIsDefined(const std::vector<bool>& is_defined);
 
+  /*!
+   * \brief Sets if the fields are defined.
+   * Takes over the memory of the vector.
+   *
+   * \param is_defined if the fields are defined.
+   */
+  void setIsDefined(std::vector<bool>&& is_defined);
+
 private:
   std::string m_version_c_version;
   uint8_t m_version_major_version_number;
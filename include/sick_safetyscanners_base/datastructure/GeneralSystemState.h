@@ -129,7 +129,7 @@ public:
    * \brief Returns the state for all safe cut off paths.
    * \return Vector containing the state of all safe cut off paths.
    */
-  std::vector<bool> getSafeCutOffPathVector() const;
+  const std::vector<bool>& getSafeCutOffPathVector() const;
 
   /*!
    * \brief Sets the state of all safe cut-off paths.
@@ -137,11 +137,18 @@ public:
    */
   void setSafeCutOffPathvector(const std::vector<bool>& safe_cut_off_path_vector);
 
+  /*!
+   * \brief Sets the state of all safe cut-off paths.
+   * Takes over the memory of the vector.
+   * \param safe_cut_off_path_vector Vector for the state of all safe cut-off paths.
+   */
+  void setSafeCutOffPathvector(std::vector<bool>&& safe_cut_off_path_vector);
+
   /*!
    * \brief Returns the state of all non-safe cut-off paths.
    * \return  Vector containing the state of all non-safe cut-off paths
    */
-  std::vector<bool> getNonSafeCutOffPathVector() const;
+  const std::vector<bool>& getNonSafeCutOffPathVector() const;
 
   /*!
    * \brief Sets the state of all non-safe cut-off paths.
@@ -149,11 +156,18 @@ public:
    */
   void setNonSafeCutOffPathVector(const std::vector<bool>& non_safe_cut_off_path_vector);
 
+  /*!
+   * \brief Sets the state of all non-safe cut-off paths.
+   * Takes over the memory of the vector.
+   * \param non_safe_cut_off_path_vector Vector for the state of all non-safe cut-off paths
+   */
+  void setNonSafeCutOffPathVector(std::vector<bool>&& non_safe_cut_off_path_vector);
+
   /*!
    * \brief Returns if a cut-off path has to be reset.
    * \return Vector if a cut-off path has to be reset.
    */
-  std::vector<bool> getResetRequiredCutOffPathVector() const;
+  const std::vector<bool>& getResetRequiredCutOffPathVector() const;
 
   /*!
    * \brief Sets the reset state for all cut-off paths
@@ -162,6 +176,13 @@ public:
   void
   setResetRequiredCutOffPathVector(const std::vector<bool>& reset_required_cut_off_path_vector);
 
+  /*!
+   * \brief Sets the reset state for all cut-off paths
+   * Takes over the memory of the vector.
+   * \param reset_required_cut_off_path_vector Vector for the reset state of all cut-off paths
+   */
+  void setResetRequiredCutOffPathVector(std::vector<bool>&& reset_required_cut_off_path_vector);
+
   /*!
    * \brief Returns the current monitor case table 1.
    * \return The current monitoring case table 1.
@@ -57,7 +57,7 @@ public:
    * \brief Getter for all IntrusionDatums.
    * \return Vector of IntrusionDatum.
    */
-  std::vector<IntrusionDatum> getIntrusionDataVector() const;
+  const std::vector<IntrusionDatum>& getIntrusionDataVector() const;
 
   /*!
    * \brief Setter for the vector of IntrusionDatums.
@@ -65,6 +65,13 @@ public:
    */
   void setIntrusionDataVector(const std::vector<IntrusionDatum>& intrusion_data_vector);
 
+  /*!
+   * \brief Setter for the vector of IntrusionDatums.
+   * Takes over the memory of the vector.
+   * \param intrusion_data_vector Vector of IntrusionDatums.
+   */
+  void setIntrusionDataVector(std::vector<IntrusionDatum>&& intrusion_data_vector);
+
   /*!
    * \brief Return if intrusion data has been enabled.
    * \return If intrusion data has been enabled.
@@ -35,18 +35,30 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_INTRUSIONDATUM_H
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_INTRUSIONDATUM_H
 
+#include <cstddef>
 #include <stdint.h>
 #include <vector>
 
+#include "sick_safetyscanners_base/Generics.h"
+
 namespace sick {
 namespace datastructure {
 
 /*!
  * \brief Class containing a single IntrusionDatum.
+ *
+ * The flags of the beams are stored packed in 64-bit words in the order of the wire format, flag i
+ * is bit i % 64 of word i / 64. Bits behind the last flag are always cleared, so the words can be
+ * combined and counted directly.
  */
 class IntrusionDatum
 {
 public:
+  /*!
+   * \brief Returned by the find functions if no flag is set.
+   */
+  static const std::size_t NO_FLAG = static_cast<std::size_t>(-1);
+
   /*!
    * \brief Constructor of an empty IntrusionDatum.
    */
@@ -66,6 +78,10 @@ public:
 
   /*!
    * \brief Getter for the flags vector.
+   *
+   * The vector is unpacked from the words on every call. Prefer the word and query functions in
+   * performance critical code.
+   *
    * \return Boolean vector of all flags
    */
   std::vector<bool> getFlagsVector() const;
@@ -76,9 +92,64 @@ public:
    */
   void setFlagsVector(const std::vector<bool>& flags_vector);
 
+  /*!
+   * \brief Sets the flags from the packed bytes of the wire format.
+   *
+   * Bit i % 8 of byte i / 8 is the flag of beam i. Existing words are overwritten to keep their
+   * capacity.
+   *
+   * \param bytes The packed flags.
+   * \param number_of_flags Number of flags to take, the bytes have to cover them.
+   */
+  void setFlags(const uint8_t* bytes, std::size_t number_of_flags);
+
+  /*!
+   * \brief Returns the number of flags, which is the number of beams.
+   * \return The number of flags.
+   */
+  std::size_t getNumberOfFlags() const;
+
+  /*!
+   * \brief Getter for the packed flags.
+   * \return View of the words, the last one is padded with cleared bits.
+   */
+  Span<const uint64_t> getFlagWords() const;
+
+  /*!
+   * \brief Returns if the flag of a beam is set.
+   * \param index Index of the beam.
+   * \return If the flag is set.
+   */
+  bool isFlagSet(std::size_t index) const
+  {
+    return ((m_flag_words[index / 64] >> (index % 64)) & 0x01) != 0;
+  }
+
+  /*!
+   * \brief Counts the set flags.
+   * \return The number of set flags.
+   */
+  std::size_t countFlags() const;
+
+  /*!
+   * \brief Finds the first set flag at or behind an index.
+   * \param from Index of the beam to start the search at.
+   * \return The index of the set flag or NO_FLAG.
+   */
+  std::size_t findNextFlag(std::size_t from) const;
+
+  /*!
+   * \brief Finds the first set flag.
+   * \return The index of the first set flag or NO_FLAG.
+   */
+  std::size_t findFirstFlag() const;
+
 private:
   int32_t m_size;
-  std::vector<bool> m_flags_vector;
+  std::size_t m_number_of_flags;
+  std::vector<uint64_t> m_flag_words;
+
+  void resizeFlags(std::size_t number_of_flags);
 };
 
 } // namespace datastructure
@@ -0,0 +1,131 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file LatencyHistogram.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_LATENCYHISTOGRAM_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_LATENCYHISTOGRAM_H
+
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Summary of the values recorded in a latency histogram, all values in nanoseconds.
+ */
+struct LatencySummary
+{
+  uint64_t count; ///< Number of recorded values.
+  int64_t min;    ///< Smallest recorded value.
+  int64_t max;    ///< Largest recorded value.
+  double mean;    ///< Mean of the recorded values.
+  int64_t p50;    ///< Median.
+  int64_t p90;    ///< 90th percentile.
+  int64_t p99;    ///< 99th percentile.
+  int64_t p999;   ///< 99.9th percentile.
+};
+
+/*!
+ * \brief Lock-free histogram of latencies with a bounded relative error.
+ *
+ * Like an HDR histogram, the buckets are linear within every power of two, so that every value is
+ * recorded with a relative error of at most 1/32 from nanoseconds up to several minutes in a fixed
+ * amount of memory. Recording is a few relaxed atomic operations and never blocks, summaries can
+ * be taken from any thread while values are recorded.
+ */
+class LatencyHistogram
+{
+public:
+  /*!
+   * \brief Constructor of an empty histogram.
+   */
+  LatencyHistogram();
+
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  /*!
+   * \brief Records a value, negative values are ignored.
+   *
+   * \param value The latency in nanoseconds.
+   */
+  void record(int64_t value);
+
+  /*!
+   * \brief Returns the value below which the given percentage of the recorded values lie.
+   *
+   * \param percentile The percentage between 0 and 100.
+   *
+   * \returns The value in nanoseconds, zero if the histogram is empty.
+   */
+  int64_t getValueAtPercentile(double percentile) const;
+
+  /*!
+   * \brief Returns count, extremes, mean and the common percentiles of the recorded values.
+   *
+   * \returns The summary.
+   */
+  LatencySummary getSummary() const;
+
+  /*!
+   * \brief Discards all recorded values. Values recorded concurrently may be lost or retained.
+   */
+  void reset();
+
+  /*!
+   * \brief Number of linear buckets within every power of two, as a power of two.
+   */
+  static const uint32_t SUB_BUCKET_BITS = 5;
+
+  /*!
+   * \brief Number of buckets, values beyond the range of the last bucket are clamped into it.
+   */
+  static const std::size_t BUCKET_COUNT = 38 << SUB_BUCKET_BITS;
+
+private:
+  std::atomic<uint64_t> m_counts[BUCKET_COUNT];
+  std::atomic<uint64_t> m_total_count;
+  std::atomic<int64_t> m_sum;
+  std::atomic<int64_t> m_min;
+  std::atomic<int64_t> m_max;
+
+  static std::size_t getBucketIndex(int64_t value);
+  static int64_t getBucketValue(std::size_t index);
+  int64_t getValueAtRank(uint64_t rank) const;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_LATENCYHISTOGRAM_H
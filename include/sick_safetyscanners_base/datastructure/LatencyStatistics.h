@@ -0,0 +1,68 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file LatencyStatistics.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_LATENCYSTATISTICS_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_LATENCYSTATISTICS_H
+
+#include "sick_safetyscanners_base/datastructure/LatencyHistogram.h"
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Latencies of the stages every scan passes on the host, all values in nanoseconds.
+ *
+ * Stages start at the kernel receive timestamp of the datagrams where available, so that time
+ * spent in the socket queue is accounted for.
+ */
+struct LatencyStatistics
+{
+  //! From the kernel receiving the last datagram of a scan until the driver processes it.
+  LatencySummary socket;
+  //! From the kernel receiving the first datagram of a scan until the scan is reassembled.
+  LatencySummary reassembly;
+  //! From reassembly until parsing the scan is finished.
+  LatencySummary parsing;
+  //! From the end of parsing until the callback is entered, e.g. waiting in decoupled delivery.
+  LatencySummary delivery;
+  //! From entering until leaving the callback.
+  LatencySummary callback;
+  //! From the kernel receiving the first datagram of a scan until the callback returned, or until
+  //! parsing is finished for the synchronous API.
+  LatencySummary total;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_LATENCYSTATISTICS_H
@@ -0,0 +1,312 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file LockFreeRing.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_LOCKFREERING_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_LOCKFREERING_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+#include <thread>
+#include <utility>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Behaviour of a full ring when a new item is pushed.
+ */
+enum class OverflowPolicy
+{
+  DROP_OLDEST, ///< Discard the oldest item in the ring to make room for the new one.
+  DROP_NEWEST  ///< Discard the new item and keep the ring as it is.
+};
+
+/*!
+ * \brief Counters of a ring, all values are totals since construction.
+ */
+struct RingCounters
+{
+  uint64_t pushed;         ///< Items accepted by the ring.
+  uint64_t popped;         ///< Items taken from the ring by the consumer.
+  uint64_t dropped_oldest; ///< Items discarded to make room for newer ones.
+  uint64_t dropped_newest; ///< New items discarded since the ring was full.
+};
+
+/*!
+ * \brief Bounded lock-free ring handing over items from a single producer to consumer threads.
+ *
+ * Every slot carries a sequence number which tells producer and consumers whether the slot is free
+ * or filled, so neither side ever waits for the other one except for the duration of moving a
+ * single item. Items are taken by claiming the oldest slot with a compare and swap, so the ring is
+ * safe for multiple consumers. The producer relies on this when it discards the oldest item of a
+ * full ring, it then competes with the consumers like another one of them.
+ *
+ * \tparam T Item type, has to be default constructible and move assignable.
+ */
+template <typename T>
+class LockFreeRing
+{
+public:
+  /*!
+   * \brief Constructor of the ring.
+   *
+   * \param capacity Maximum number of items in the ring, rounded up to the next power of two and
+   * at least two.
+   */
+  explicit LockFreeRing(std::size_t capacity)
+    : m_capacity(roundUpToPowerOfTwo(capacity))
+    , m_mask(m_capacity - 1)
+    , m_slots(new Slot[m_capacity])
+    , m_enqueue_position(0)
+    , m_dequeue_position(0)
+    , m_pushed(0)
+    , m_popped(0)
+    , m_dropped_oldest(0)
+    , m_dropped_newest(0)
+  {
+    for (std::size_t i = 0; i < m_capacity; i++)
+    {
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  LockFreeRing(const LockFreeRing&) = delete;
+  LockFreeRing& operator=(const LockFreeRing&) = delete;
+
+  /*!
+   * \brief Pushes an item, applying the overflow policy if the ring is full. Discarded oldest
+   * items are destroyed.
+   *
+   * \param item The item to push, moved from if it was accepted.
+   * \param policy The behaviour if the ring is full.
+   *
+   * \returns True if the item was accepted, false if it was dropped.
+   */
+  bool push(T&& item, OverflowPolicy policy)
+  {
+    return push(std::move(item), policy, [](T&) {});
+  }
+
+  /*!
+   * \brief Pushes an item, applying the overflow policy if the ring is full.
+   *
+   * \param item The item to push, moved from if it was accepted.
+   * \param policy The behaviour if the ring is full.
+   * \param on_discard Called with every oldest item discarded to make room, e.g. to return it to a
+   * pool. A dropped new item is not passed, it is left to the caller.
+   *
+   * \returns True if the item was accepted, false if it was dropped.
+   */
+  template <typename DiscardHandler>
+  bool push(T&& item, OverflowPolicy policy, DiscardHandler on_discard)
+  {
+    while (!tryPush(std::move(item)))
+    {
+      if (isReleasingSlot())
+      {
+        // The slot is freed within moving a single item, discarding another one would be a loss.
+        std::this_thread::yield();
+        continue;
+      }
+      if (policy == OverflowPolicy::DROP_NEWEST)
+      {
+        m_dropped_newest.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      T discarded;
+      if (claim(discarded))
+      {
+        m_dropped_oldest.fetch_add(1, std::memory_order_relaxed);
+        on_discard(discarded);
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Pushes an item if the ring is not full.
+   *
+   * \param item The item to push, moved from if it was accepted.
+   *
+   * \returns True if the item was accepted.
+   */
+  bool tryPush(T&& item)
+  {
+    std::size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+    Slot& slot           = m_slots[position & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != position)
+    {
+      // The slot still holds the item of the previous round, the ring is full.
+      return false;
+    }
+    slot.value = std::move(item);
+    slot.sequence.store(position + 1, std::memory_order_release);
+    m_enqueue_position.store(position + 1, std::memory_order_relaxed);
+    m_pushed.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /*!
+   * \brief Takes the oldest item from the ring.
+   *
+   * \param item Receives the item.
+   *
+   * \returns True if an item was taken, false if the ring was empty.
+   */
+  bool tryPop(T& item)
+  {
+    if (!claim(item))
+    {
+      return false;
+    }
+    m_popped.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /*!
+   * \brief Returns whether the ring is empty. Only a snapshot while the other side is active.
+   *
+   * \returns True if the ring is empty.
+   */
+  bool empty() const
+  {
+    return m_dequeue_position.load(std::memory_order_acquire) ==
+           m_enqueue_position.load(std::memory_order_acquire);
+  }
+
+  /*!
+   * \brief Returns the capacity of the ring.
+   *
+   * \returns The maximum number of items in the ring.
+   */
+  std::size_t capacity() const { return m_capacity; }
+
+  /*!
+   * \brief Returns the counters of the ring.
+   *
+   * \returns The counters.
+   */
+  RingCounters getCounters() const
+  {
+    RingCounters counters;
+    counters.pushed         = m_pushed.load(std::memory_order_relaxed);
+    counters.popped         = m_popped.load(std::memory_order_relaxed);
+    counters.dropped_oldest = m_dropped_oldest.load(std::memory_order_relaxed);
+    counters.dropped_newest = m_dropped_newest.load(std::memory_order_relaxed);
+    return counters;
+  }
+
+private:
+  struct Slot
+  {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  // Padding keeps the positions of producer and consumer on separate cache lines.
+  static const std::size_t CACHE_LINE_SIZE = 64;
+
+  const std::size_t m_capacity;
+  const std::size_t m_mask;
+  std::unique_ptr<Slot[]> m_slots;
+  char m_padding_0[CACHE_LINE_SIZE];
+  std::atomic<std::size_t> m_enqueue_position;
+  char m_padding_1[CACHE_LINE_SIZE];
+  std::atomic<std::size_t> m_dequeue_position;
+  char m_padding_2[CACHE_LINE_SIZE];
+  std::atomic<uint64_t> m_pushed;
+  std::atomic<uint64_t> m_popped;
+  std::atomic<uint64_t> m_dropped_oldest;
+  std::atomic<uint64_t> m_dropped_newest;
+
+  /*!
+   * \brief Claims the oldest slot and moves its item out. Used by the consumers and by the producer
+   * when discarding the oldest item, hence the position is advanced with a compare and swap.
+   */
+  bool claim(T& item)
+  {
+    std::size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      Slot& slot           = m_slots[position & m_mask];
+      std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence != position + 1)
+      {
+        if (sequence < position + 1)
+        {
+          // Not yet filled, the ring is empty.
+          return false;
+        }
+        // Claimed by the other side in the meantime, retry with the next position.
+        position = m_dequeue_position.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (m_dequeue_position.compare_exchange_weak(
+            position, position + 1, std::memory_order_relaxed))
+      {
+        item = std::move(slot.value);
+        slot.value = T();
+        slot.sequence.store(position + m_capacity, std::memory_order_release);
+        return true;
+      }
+    }
+  }
+
+  /*!
+   * \brief Returns whether a consumer claimed the oldest item but did not yet release its slot, so
+   * a failed push saw a ring which is not full anymore. Only called by the producer.
+   */
+  bool isReleasingSlot() const
+  {
+    return m_dequeue_position.load(std::memory_order_acquire) + m_capacity !=
+           m_enqueue_position.load(std::memory_order_relaxed);
+  }
+
+  static std::size_t roundUpToPowerOfTwo(std::size_t value)
+  {
+    // With a single slot its filled sequence would equal the next free one of the producer.
+    std::size_t result = 2;
+    while (result < value)
+    {
+      result <<= 1;
+    }
+    return result;
+  }
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_LOCKFREERING_H
@@ -35,9 +35,11 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_MEASUREMENTDATA_H
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_MEASUREMENTDATA_H
 
+#include <cstddef>
 #include <stdint.h>
 #include <vector>
 
+#include "sick_safetyscanners_base/Generics.h"
 #include "sick_safetyscanners_base/datastructure/ScanPoint.h"
 
 namespace sick {
@@ -45,6 +47,10 @@ namespace datastructure {
 
 /*!
  * \brief Class containing all scanpoints of a single measurement.
+ *
+ * The scanpoints are stored column wise in contiguous arrays of distances, reflectivities and
+ * status bits. The angle of a beam is not stored, it is implicitly given by the start angle and the
+ * angular beam resolution of the measurement.
  */
 class MeasurementData
 {
@@ -68,16 +74,110 @@ public:
 
   /*!
    * \brief Getter for all contained scanpoints.
+   *
+   * The scanpoints are assembled from the columns on every call. Prefer the column getters in
+   * performance critical code.
+   *
    * \return Vector of scanpoints.
    */
   std::vector<ScanPoint> getScanPointsVector() const;
 
   /*!
    * \brief Add a single scanpoint to the vector of scanpoints.
+   *
+   * The angle of the scanpoint is not stored, the angles of all beams follow from setAngles(). If
+   * it was not called, the first added scanpoint sets the start angle and the second one the
+   * angular beam resolution. Scanpoints off this beam grid are reported at the angle of their beam.
+   *
    * \param scan_point New scanpoint to add.
    */
   void addScanPoint(ScanPoint scan_point);
 
+  /*!
+   * \brief Add the raw values of a single beam to the columns.
+   * \param distance Distance of the beam.
+   * \param reflectivity Reflectivity of the beam.
+   * \param status_bits Status bits of the beam, see ScanPointStatusBits.
+   */
+  void addBeam(uint16_t distance, uint8_t reflectivity, uint8_t status_bits);
+
+  /*!
+   * \brief Reserves memory in all columns for the given number of beams.
+   * \param number_of_beams Number of beams to reserve memory for.
+   */
+  void reserve(uint32_t number_of_beams);
+
+  /*!
+   * \brief Resizes all columns to the given number of beams, e.g. to decode beams in bulk.
+   * \param number_of_beams Number of beams the columns should contain.
+   */
+  void resize(uint32_t number_of_beams);
+
+  /*!
+   * \brief Getter for the distances of all beams.
+   * \return View of the distances.
+   */
+  Span<const uint16_t> getDistances() const;
+
+  /*!
+   * \brief Getter for the mutable distances of all beams.
+   * \return View of the distances.
+   */
+  Span<uint16_t> getDistances();
+
+  /*!
+   * \brief Getter for the reflectivities of all beams.
+   * \return View of the reflectivities.
+   */
+  Span<const uint8_t> getReflectivities() const;
+
+  /*!
+   * \brief Getter for the mutable reflectivities of all beams.
+   * \return View of the reflectivities.
+   */
+  Span<uint8_t> getReflectivities();
+
+  /*!
+   * \brief Getter for the status bits of all beams, see ScanPointStatusBits.
+   * \return View of the status bits.
+   */
+  Span<const uint8_t> getStatusBits() const;
+
+  /*!
+   * \brief Getter for the mutable status bits of all beams.
+   * \return View of the status bits.
+   */
+  Span<uint8_t> getStatusBits();
+
+  /*!
+   * \brief Getter for the angle of the first beam.
+   * \return The start angle.
+   */
+  float getStartAngle() const;
+
+  /*!
+   * \brief Getter for the angle between two beams.
+   * \return The angular beam resolution.
+   */
+  float getAngularBeamResolution() const;
+
+  /*!
+   * \brief Sets the angles of the beams.
+   * \param start_angle The angle of the first beam.
+   * \param angular_beam_resolution The angle between two beams.
+   */
+  void setAngles(float start_angle, float angular_beam_resolution);
+
+  /*!
+   * \brief Returns the angle of a single beam.
+   * \param index Index of the beam.
+   * \return The angle of the beam.
+   */
+  float getAngle(std::size_t index) const
+  {
+    return m_start_angle + static_cast<float>(index) * m_angular_beam_resolution;
+  }
+
   /*!
    * \brief Returns if measurement data has been enabled.
    * \return If measurement data has been enabled.
@@ -94,7 +194,12 @@ private:
   bool m_is_empty;
 
   uint32_t m_number_of_beams;
-  std::vector<ScanPoint> m_scan_points_vector;
+  bool m_has_angles;
+  float m_start_angle;
+  float m_angular_beam_resolution;
+  std::vector<uint16_t> m_distances;
+  std::vector<uint8_t> m_reflectivities;
+  std::vector<uint8_t> m_status_bits;
 };
 
 } // namespace datastructure
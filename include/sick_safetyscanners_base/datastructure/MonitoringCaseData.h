@@ -87,7 +87,7 @@ public:
    *
    * \returns The field indices.
    */
-  std::vector<uint16_t> getFieldIndices() const;
+  const std::vector<uint16_t>& getFieldIndices() const;
 
   /*!
    * \brief Sets the field indices.
@@ -96,12 +96,20 @@ public:
    */
   void setFieldIndices(const std::vector<uint16_t>& field_indices);
 
+  /*!
+   * \brief Sets the field indices.
+   * Takes over the memory of the vector.
+   *
+   * \param field_indices The field indices.
+   */
+  void setFieldIndices(std::vector<uint16_t>&& field_indices);
+
   /*!
    * \brief Returns if the fields are configured and valid.
    *
    * \returns If the fields are valid.
    */
-  std::vector<bool> getFieldsValid() const;
+  const std::vector<bool>& getFieldsValid() const;
 
   /*!
    * \brief Sets if the fields are valid.
@@ -110,6 +118,14 @@ public:
    */
   void setFieldsValid(const std::vector<bool>& fields_valid);
 
+  /*!
+   * \brief Sets if the fields are valid.
+   * Takes over the memory of the vector.
+   *
+   * \param fields_valid if the fields are valid.
+   */
+  void setFieldsValid(std::vector<bool>&& fields_valid);
+
 private:
   bool m_is_valid;
   uint16_t m_monitoring_case_number;
@@ -36,6 +36,7 @@
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_PACKETBUFFER_H
 
 #include <iostream>
+#include <memory>
 #include <stdint.h>
 #include <string>
 #include <vector>
@@ -87,6 +88,20 @@ public:
    */
   PacketBuffer(const ArrayBuffer& buffer, const size_t& length);
 
+  /*!
+   * \brief Constructor of PacketBuffer sharing an already existing buffer without copying it.
+   * \param buffer Shared buffer to set for the PacketBuffer.
+   */
+  explicit PacketBuffer(const std::shared_ptr<std::vector<uint8_t> const>& buffer);
+
+  /*!
+   * \brief Constructor of PacketBuffer sharing the first bytes of an already existing buffer, e.g.
+   * a receive buffer which is sized once for the largest datagram.
+   * \param buffer Shared buffer to set for the PacketBuffer.
+   * \param length Number of valid bytes at the start of the buffer.
+   */
+  PacketBuffer(const std::shared_ptr<std::vector<uint8_t> const>& buffer, size_t length);
+
   /*!
    * \brief Returns defined maximum size of PacketBuffer.
    * \return Maximum size of PacketBuffer.
@@ -94,7 +109,15 @@ public:
   static uint32_t getMaxSize() { return MAXSIZE; }
 
   /*!
-   * \brief Getter to return a copy of the data saved in the PacketBuffer.
+   * \brief Returns the current time on the clock of receive times, which is the clock the kernel
+   * timestamps received datagrams with.
+   * \return Nanoseconds since the epoch of the system clock.
+   */
+  static int64_t now();
+
+  /*!
+   * \brief Getter to return a copy of the data saved in the PacketBuffer. Only the first
+   * getLength() bytes are valid, the buffer may be longer.
    * \return Data copy as shared_ptr<vector const>.  Needed because this bufer could be overwritten.
    */
   std::shared_ptr<std::vector<uint8_t> const> getBuffer() const;
@@ -112,15 +135,43 @@ public:
    */
   void setBuffer(const ArrayBuffer& buffer, const size_t& length);
 
+  /*!
+   * \brief Setter for the PacketBuffer. The buffer is shared and not copied.
+   * \param buffer Input shared buffer to save.
+   */
+  void setBuffer(const std::shared_ptr<std::vector<uint8_t> const>& buffer);
+
+  /*!
+   * \brief Setter for the PacketBuffer. The buffer is shared and not copied.
+   * \param buffer Input shared buffer to save.
+   * \param length Number of valid bytes at the start of the buffer.
+   */
+  void setBuffer(const std::shared_ptr<std::vector<uint8_t> const>& buffer, size_t length);
+
   /*!
    * \brief Returns length of the current PacketBuffer.
    * \return Length.
    */
   size_t getLength() const;
 
+  /*!
+   * \brief Returns the time the packet was received. For reassembled packets this is the time the
+   * first datagram was received.
+   * \return Nanoseconds since the epoch of the system clock, zero if unknown.
+   */
+  int64_t getReceiveTime() const;
+
+  /*!
+   * \brief Setter for the time the packet was received.
+   * \param receive_time Nanoseconds since the epoch of the system clock, zero if unknown.
+   */
+  void setReceiveTime(int64_t receive_time);
+
 
 private:
   std::shared_ptr<std::vector<uint8_t> const> m_buffer;
+  size_t m_length{0};
+  int64_t m_receive_time{0};
 };
 
 } // namespace datastructure
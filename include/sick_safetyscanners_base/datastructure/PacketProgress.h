@@ -0,0 +1,59 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file PacketProgress.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_PACKETPROGRESS_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_PACKETPROGRESS_H
+
+#include <stdint.h>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Reassembly state of a data packet after one of its fragments was added.
+ */
+struct PacketProgress
+{
+  uint32_t identification;        ///< Identification of the data packet.
+  uint32_t fragment_offset;       ///< Offset of the added fragment in the data packet.
+  uint32_t fragment_length;       ///< Length of the added fragment.
+  uint32_t received_length;       ///< Bytes from the begin of the data packet up to the first
+                                  ///< missing fragment.
+  uint32_t identification_window; ///< Identification window of the merger, packets further
+                                  ///< behind the newest one are evicted.
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_PACKETPROGRESS_H
@@ -0,0 +1,62 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file RequestTiming.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_REQUESTTIMING_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_REQUESTTIMING_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Timing of a single request sent over a COLA2 session.
+ */
+struct RequestTiming
+{
+  //! Name of the request.
+  std::string name;
+  //! Time from the start of the batch until the first command of the request was sent.
+  std::chrono::microseconds start;
+  //! Time from sending the first command until the last reply of the request was processed.
+  std::chrono::microseconds duration;
+  //! Number of commands the request consisted of.
+  uint16_t number_of_commands;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_REQUESTTIMING_H
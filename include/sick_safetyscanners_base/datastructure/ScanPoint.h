@@ -40,6 +40,16 @@
 namespace sick {
 namespace datastructure {
 
+// Namespace containing the bits of the per beam status byte as constants.
+namespace ScanPointStatusBits {
+constexpr uint8_t VALID                 = 1 << 0;
+constexpr uint8_t INFINITE              = 1 << 1;
+constexpr uint8_t GLARE                 = 1 << 2;
+constexpr uint8_t REFLECTOR             = 1 << 3;
+constexpr uint8_t CONTAMINATION         = 1 << 4;
+constexpr uint8_t CONTAMINATION_WARNING = 1 << 5;
+} // namespace ScanPointStatusBits
+
 /*!
  * \brief Class containing the data of a single scan point.
  */
@@ -0,0 +1,82 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file SensorSnapshot.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_SENSORSNAPSHOT_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_SENSORSNAPSHOT_H
+
+#include "sick_safetyscanners_base/datastructure/ConfigData.h"
+#include "sick_safetyscanners_base/datastructure/ConfigMetadata.h"
+#include "sick_safetyscanners_base/datastructure/FieldData.h"
+#include "sick_safetyscanners_base/datastructure/FirmwareVersion.h"
+#include "sick_safetyscanners_base/datastructure/MonitoringCaseData.h"
+#include "sick_safetyscanners_base/datastructure/OrderNumber.h"
+#include "sick_safetyscanners_base/datastructure/ProjectName.h"
+#include "sick_safetyscanners_base/datastructure/RequestTiming.h"
+#include "sick_safetyscanners_base/datastructure/SerialNumber.h"
+#include "sick_safetyscanners_base/datastructure/TypeCode.h"
+#include "sick_safetyscanners_base/datastructure/UserName.h"
+
+#include <chrono>
+#include <vector>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief The static metadata and configuration of a sensor, as read at once by
+ * SickSafetyscannersBase::requestSensorSnapshot().
+ */
+struct SensorSnapshot
+{
+  TypeCode type_code;
+  SerialNumber serial_number;
+  FirmwareVersion firmware_version;
+  OrderNumber order_number;
+  ProjectName project_name;
+  UserName user_name;
+  ConfigMetadata config_metadata;
+  ConfigData persistent_config;
+  std::vector<FieldData> field_data;
+  std::vector<MonitoringCaseData> monitoring_cases;
+
+  //! Timing of every request the snapshot was read with, in the order they were started.
+  std::vector<RequestTiming> timings;
+  //! Time from the first request until the last reply, including opening the session if
+  //! required.
+  std::chrono::microseconds total_duration;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_SENSORSNAPSHOT_H
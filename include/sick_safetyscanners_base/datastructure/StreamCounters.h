@@ -0,0 +1,69 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file StreamCounters.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_STREAMCOUNTERS_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_STREAMCOUNTERS_H
+
+#include <stdint.h>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Health counters of the sensor data stream. Counts are totals since construction, byte
+ * values reflect the current state.
+ */
+struct StreamCounters
+{
+  uint64_t datagrams;               ///< Datagrams passed to the packet merger.
+  uint64_t invalid_datagrams;       ///< Datagrams skipped since they did not fit their packet or
+                                    ///< overlapped another fragment of a different length.
+  uint64_t duplicate_fragments;     ///< Fragments received more than once.
+  uint64_t out_of_order_fragments;  ///< Fragments received after one with a higher offset.
+  uint64_t late_fragments;          ///< Fragments of packets older than the identification window.
+  uint64_t completed_packets;       ///< Packets reassembled completely.
+  uint64_t evicted_packets;         ///< Partial packets discarded by the eviction policy.
+  uint64_t dropped_fragments;       ///< Fragments missing from evicted packets, estimated from the
+                                    ///< missing bytes and the fragment size of the packet.
+  uint64_t missed_scans;            ///< Scan numbers skipped between consecutive scans.
+  uint64_t missed_sequence_numbers; ///< Sequence numbers skipped between consecutive scans.
+  uint64_t buffered_bytes;          ///< Bytes of partial packets waiting for fragments.
+  uint64_t reserved_bytes;          ///< Bytes held by the packet merger for reassembly.
+  uint64_t pinned_slabs;            ///< Reassembly slabs still referenced by deployed packets.
+  uint64_t detached_slabs;          ///< Slabs given a new buffer since all free slabs were pinned.
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_STREAMCOUNTERS_H
@@ -0,0 +1,142 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ReplaySickSafetyScanner.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/ReplaySickSafetyScanner.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace sick {
+
+ReplaySickSafetyScanner::ReplaySickSafetyScanner(const std::string& path,
+                                                 sick::types::ScanDataCb callback,
+                                                 sick::types::SensorFeatures parse_features)
+  : m_reader(path)
+  , m_scan_data_cb(callback)
+  , m_packet_merger()
+  , m_data_parser(parse_features)
+  , m_data_pool()
+  , m_datagram()
+  , m_stopped(false)
+  , m_mutex()
+  , m_condition()
+  , m_number_of_datagrams(0)
+  , m_number_of_scans(0)
+{
+}
+
+void ReplaySickSafetyScanner::run(ReplayPace pace)
+{
+  m_stopped             = false;
+  m_number_of_datagrams = 0;
+  m_number_of_scans     = 0;
+  m_reader.rewind();
+
+  sick::communication::CaptureRecord record;
+  bool is_first           = true;
+  int64_t first_timestamp = 0;
+  int64_t receive_offset  = 0;
+  std::chrono::steady_clock::time_point start;
+  while (!m_stopped && m_reader.next(record))
+  {
+    if (pace == ReplayPace::RECORDED)
+    {
+      if (is_first)
+      {
+        first_timestamp = record.timestamp;
+        start           = std::chrono::steady_clock::now();
+        receive_offset  = sick::datastructure::PacketBuffer::now() - first_timestamp;
+        is_first        = false;
+      }
+      // Datagrams received out of order on the host clock are replayed immediately.
+      std::chrono::nanoseconds offset(std::max<int64_t>(record.timestamp - first_timestamp, 0));
+      if (!waitUntil(start +
+                     std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset)))
+      {
+        break;
+      }
+    }
+    processDatagram(record, receive_offset);
+  }
+}
+
+void ReplaySickSafetyScanner::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopped = true;
+  }
+  m_condition.notify_all();
+}
+
+uint64_t ReplaySickSafetyScanner::getNumberOfDatagrams() const
+{
+  return m_number_of_datagrams;
+}
+
+uint64_t ReplaySickSafetyScanner::getNumberOfScans() const
+{
+  return m_number_of_scans;
+}
+
+bool ReplaySickSafetyScanner::waitUntil(const std::chrono::steady_clock::time_point& time_point)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  return !m_condition.wait_until(lock, time_point, [this]() { return m_stopped.load(); });
+}
+
+void ReplaySickSafetyScanner::processDatagram(const sick::communication::CaptureRecord& record,
+                                              int64_t receive_offset)
+{
+  // The datagram buffer is reused unless the merger still holds on to it.
+  if (!m_datagram || m_datagram.use_count() != 1)
+  {
+    m_datagram = std::make_shared<std::vector<uint8_t>>();
+  }
+  m_datagram->assign(record.data, record.data + record.length);
+  m_number_of_datagrams++;
+
+  sick::datastructure::PacketBuffer buffer{std::shared_ptr<std::vector<uint8_t> const>(m_datagram)};
+  buffer.setReceiveTime(record.timestamp + receive_offset);
+  if (m_packet_merger.addUDPPacket(buffer))
+  {
+    sick::datastructure::PacketBuffer deployed_buffer = m_packet_merger.getDeployedPacketBuffer();
+    std::shared_ptr<sick::datastructure::Data> data   = m_data_pool.acquire();
+    m_data_parser.parseUDPSequence(deployed_buffer, *data);
+    m_number_of_scans++;
+    m_scan_data_cb(*data);
+    m_data_pool.release(data);
+  }
+}
+
+} // namespace sick
@@ -0,0 +1,202 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ScannerGroup.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/ScannerGroup.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace sick {
+
+namespace {
+
+/*!
+ * \brief Converts the receive time of a datagram to the monotonic clock of the alignment.
+ *
+ * \param receive_time Nanoseconds since the epoch as stamped by the kernel, zero if unknown.
+ *
+ * \returns The receive time on the monotonic clock, now if it is unknown.
+ */
+sick::types::time_point_t toSteadyTime(int64_t receive_time)
+{
+  sick::types::time_point_t steady_now = std::chrono::steady_clock::now();
+  if (receive_time == 0)
+  {
+    return steady_now;
+  }
+  int64_t age = sick::datastructure::PacketBuffer::now() - receive_time;
+  return steady_now - std::chrono::nanoseconds(std::max<int64_t>(age, 0));
+}
+
+} // namespace
+
+ScannerGroup::ScannerGroup(std::size_t num_threads, const std::vector<int>& cpu_ids)
+  : m_io_service()
+  , m_work(sick::make_unique<boost::asio::io_service::work>(m_io_service))
+{
+  num_threads = std::max<std::size_t>(num_threads, 1);
+  for (std::size_t i = 0; i < num_threads; i++)
+  {
+    m_threads.emplace_back([this] { runWorker(); });
+    if (!cpu_ids.empty())
+    {
+      pinThread(m_threads.back(), cpu_ids[i % cpu_ids.size()]);
+    }
+  }
+}
+
+ScannerGroup::~ScannerGroup()
+{
+  stop();
+  m_work.reset();
+  m_io_service.stop();
+  for (auto& thread : m_threads)
+  {
+    if (thread.joinable())
+    {
+      thread.join();
+    }
+  }
+  // The scanners are destroyed after the workers are joined, no handler can access them anymore.
+}
+
+AsyncSickSafetyScanner& ScannerGroup::addSensor(sick::types::ip_address_t sensor_ip,
+                                                sick::types::port_t sensor_tcp_port,
+                                                CommSettings comm_settings,
+                                                sick::types::AlignedScanDataCb callback)
+{
+  std::unique_ptr<Sensor> sensor = sick::make_unique<Sensor>();
+  sensor->callback               = callback;
+
+  // The callback is invoked on the strand of the sensor, so the alignment needs no locking.
+  Sensor* sensor_ptr         = sensor.get();
+  sick::types::ScanDataCb cb = [sensor_ptr](const sick::datastructure::Data& data) {
+    sick::types::time_point_t receive_time = toSteadyTime(data.getReceiveTime());
+    sick::types::time_point_t stamp        = receive_time;
+    std::shared_ptr<sick::datastructure::DataHeader> data_header = data.getDataHeaderPtr();
+    if (data_header && !data_header->isEmpty())
+    {
+      stamp = sensor_ptr->clock_alignment.align(*data_header, receive_time);
+    }
+    // An exception escaping to the worker would stop the receive loop of the sensor
+    try
+    {
+      sensor_ptr->callback(data, stamp);
+    }
+    catch (const std::exception& e)
+    {
+      LOG_ERROR("%s", e.what());
+    }
+  };
+  sensor->scanner = sick::make_unique<AsyncSickSafetyScanner>(
+    sensor_ip, sensor_tcp_port, comm_settings, cb, m_io_service);
+
+  std::lock_guard<std::mutex> lock(m_sensors_mutex);
+  m_sensors.push_back(std::move(sensor));
+  return *m_sensors.back()->scanner;
+}
+
+std::size_t ScannerGroup::getNumberOfSensors() const
+{
+  std::lock_guard<std::mutex> lock(m_sensors_mutex);
+  return m_sensors.size();
+}
+
+std::size_t ScannerGroup::getNumberOfThreads() const
+{
+  return m_threads.size();
+}
+
+void ScannerGroup::run(std::size_t batch_size)
+{
+  std::lock_guard<std::mutex> lock(m_sensors_mutex);
+  for (auto& sensor : m_sensors)
+  {
+    if (batch_size > 0)
+    {
+      sensor->scanner->runBatched(batch_size);
+    }
+    else
+    {
+      sensor->scanner->run();
+    }
+  }
+}
+
+void ScannerGroup::stop()
+{
+  std::lock_guard<std::mutex> lock(m_sensors_mutex);
+  for (auto& sensor : m_sensors)
+  {
+    sensor->scanner->stop();
+  }
+}
+
+void ScannerGroup::runWorker()
+{
+  while (!m_io_service.stopped())
+  {
+    try
+    {
+      m_io_service.run();
+    }
+    catch (const std::exception& e)
+    {
+      LOG_ERROR("%s", e.what());
+    }
+  }
+}
+
+void ScannerGroup::pinThread(boost::thread& thread, int cpu_id)
+{
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu_id, &cpu_set);
+  int result = pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set);
+  if (result != 0)
+  {
+    LOG_WARN("Could not pin worker thread to CPU %i: %s", cpu_id, strerror(result));
+  }
+#else
+  (void)thread;
+  LOG_WARN("Pinning worker threads to CPU %i is not supported on this platform.", cpu_id);
+#endif
+}
+
+} // namespace sick
@@ -35,25 +35,137 @@
 //----------------------------------------------------------------------
 
 #include "sick_safetyscanners_base/SickSafetyscanners.h"
+#include "sick_safetyscanners_base/Exceptions.h"
 #include "sick_safetyscanners_base/cola2/Cola2.h"
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 
 namespace sick {
 
+namespace {
+
+const uint16_t MAX_FIELDS           = 128;
+const uint16_t MAX_MONITORING_CASES = 254;
+
+// Index 0 is reserved for contour data, all other fields end at the first invalid one. Headers
+// requested beyond end_index are ignored.
+void addFieldHeaderRequest(sick::cola2::CommandPipeline& pipeline,
+                           sick::cola2::Cola2Session& session,
+                           std::vector<sick::datastructure::FieldData>& field_data,
+                           uint16_t& end_index)
+{
+  field_data.resize(MAX_FIELDS);
+  end_index = MAX_FIELDS;
+  pipeline.addRequest(
+    "field headers",
+    [&](uint16_t index) -> std::unique_ptr<sick::cola2::Command> {
+      if (index >= end_index)
+      {
+        return nullptr;
+      }
+      return sick::make_unique<sick::cola2::FieldHeaderVariableCommand>(
+        session, field_data[index], index);
+    },
+    [&](uint16_t index) {
+      if (index > 0 && !field_data[index].getIsValid())
+      {
+        end_index = std::min(end_index, index);
+      }
+    });
+}
+
+std::vector<uint16_t>
+getValidFieldIndices(const std::vector<sick::datastructure::FieldData>& field_data,
+                     uint16_t end_index)
+{
+  std::vector<uint16_t> valid_indices;
+  for (uint16_t i = 0; i < end_index; i++)
+  {
+    if (field_data[i].getIsValid())
+    {
+      valid_indices.push_back(i);
+    }
+  }
+  return valid_indices;
+}
+
+void addFieldGeometryRequest(sick::cola2::CommandPipeline& pipeline,
+                             sick::cola2::Cola2Session& session,
+                             std::vector<sick::datastructure::FieldData>& field_data,
+                             const std::vector<uint16_t>& valid_indices)
+{
+  pipeline.addRequest(
+    "field geometries", [&](uint16_t index) -> std::unique_ptr<sick::cola2::Command> {
+      if (index >= valid_indices.size())
+      {
+        return nullptr;
+      }
+      return sick::make_unique<sick::cola2::FieldGeometryVariableCommand>(
+        session, field_data[valid_indices[index]], valid_indices[index]);
+    });
+}
+
+// Monitoring cases end at the first invalid one.
+void addMonitoringCaseRequest(
+  sick::cola2::CommandPipeline& pipeline,
+  sick::cola2::Cola2Session& session,
+  std::vector<sick::datastructure::MonitoringCaseData>& monitoring_case_data,
+  uint16_t& end_index)
+{
+  monitoring_case_data.resize(MAX_MONITORING_CASES);
+  end_index = MAX_MONITORING_CASES;
+  pipeline.addRequest(
+    "monitoring cases",
+    [&](uint16_t index) -> std::unique_ptr<sick::cola2::Command> {
+      if (index >= end_index)
+      {
+        return nullptr;
+      }
+      return sick::make_unique<sick::cola2::MonitoringCaseVariableCommand>(
+        session, monitoring_case_data[index], index);
+    },
+    [&](uint16_t index) {
+      if (!monitoring_case_data[index].getIsValid())
+      {
+        end_index = std::min(end_index, index);
+      }
+    });
+}
+
+} // namespace
+
 SickSafetyscannersBase::SickSafetyscannersBase(sick::types::ip_address_t sensor_ip,
                                                sick::types::port_t sensor_tcp_port,
                                                CommSettings comm_settings)
   : m_sensor_ip(sensor_ip)
   , m_sensor_tcp_port(sensor_tcp_port)
   , m_comm_settings(comm_settings)
+  , m_session_keep_alive(false)
   , m_io_service_ptr(sick::make_unique<boost::asio::io_service>())
   , m_io_service(*m_io_service_ptr)
   , m_udp_client(m_io_service, comm_settings.host_udp_port)
   , m_session(
       std::move(sick::make_unique<sick::communication::TCPClient>(m_sensor_ip, sensor_tcp_port)))
   , m_packet_merger()
+  , m_parse_features(sick::SensorDataFeatures::ALL)
+  , m_has_beam_region(false)
+  , m_beam_region_mutex()
+  , m_beam_region()
+  , m_data_parser()
+  , m_measurement_decoder()
+  , m_priority_decoder()
+  , m_is_capturing(false)
+  , m_capture_mutex()
+  , m_capture_writer()
 {
+  m_packet_merger.setProgressHandler(
+    [this](const sick::datastructure::PacketBuffer& buffer,
+           const sick::datastructure::PacketProgress& progress) {
+      decodePartialPacket(buffer, progress);
+    });
   changeSensorSettings(comm_settings);
 }
 
@@ -64,13 +176,29 @@ SickSafetyscannersBase::SickSafetyscannersBase(sick::types::ip_address_t sensor_
   : m_sensor_ip(sensor_ip)
   , m_sensor_tcp_port(sensor_tcp_port)
   , m_comm_settings(comm_settings)
+  , m_session_keep_alive(false)
   , m_io_service_ptr(sick::make_unique<boost::asio::io_service>())
   , m_io_service(*m_io_service_ptr)
   , m_udp_client(m_io_service, comm_settings.host_udp_port, comm_settings.host_ip, interface_ip)
   , m_session(
       std::move(sick::make_unique<sick::communication::TCPClient>(m_sensor_ip, sensor_tcp_port)))
   , m_packet_merger()
+  , m_parse_features(sick::SensorDataFeatures::ALL)
+  , m_has_beam_region(false)
+  , m_beam_region_mutex()
+  , m_beam_region()
+  , m_data_parser()
+  , m_measurement_decoder()
+  , m_priority_decoder()
+  , m_is_capturing(false)
+  , m_capture_mutex()
+  , m_capture_writer()
 {
+  m_packet_merger.setProgressHandler(
+    [this](const sick::datastructure::PacketBuffer& buffer,
+           const sick::datastructure::PacketProgress& progress) {
+      decodePartialPacket(buffer, progress);
+    });
   changeSensorSettings(comm_settings);
 }
 
@@ -81,17 +209,180 @@ SickSafetyscannersBase::SickSafetyscannersBase(sick::types::ip_address_t sensor_
   : m_sensor_ip(sensor_ip)
   , m_sensor_tcp_port(sensor_tcp_port)
   , m_comm_settings(comm_settings)
+  , m_session_keep_alive(false)
   , m_io_service_ptr(nullptr)
   , m_io_service(io_service)
   , m_udp_client(m_io_service, comm_settings.host_udp_port)
   , m_session(
       std::move(sick::make_unique<sick::communication::TCPClient>(m_sensor_ip, sensor_tcp_port)))
   , m_packet_merger()
+  , m_parse_features(sick::SensorDataFeatures::ALL)
+  , m_has_beam_region(false)
+  , m_beam_region_mutex()
+  , m_beam_region()
+  , m_data_parser()
+  , m_measurement_decoder()
+  , m_priority_decoder()
+  , m_is_capturing(false)
+  , m_capture_mutex()
+  , m_capture_writer()
 {
+  m_packet_merger.setProgressHandler(
+    [this](const sick::datastructure::PacketBuffer& buffer,
+           const sick::datastructure::PacketProgress& progress) {
+      decodePartialPacket(buffer, progress);
+    });
   changeSensorSettings(comm_settings);
 }
 
 
+SickSafetyscannersBase::~SickSafetyscannersBase()
+{
+  if (m_session_keep_alive)
+  {
+    try
+    {
+      m_session.close();
+    }
+    catch (const std::exception& e)
+    {
+      LOG_WARN("Could not close the COLA2 session: %s", e.what());
+    }
+  }
+}
+
+void SickSafetyscannersBase::setSessionKeepAlive(bool keep_alive)
+{
+  if (m_session_keep_alive && !keep_alive)
+  {
+    m_session.close();
+  }
+  m_session_keep_alive = keep_alive;
+}
+
+bool SickSafetyscannersBase::getSessionKeepAlive() const
+{
+  return m_session_keep_alive;
+}
+
+void SickSafetyscannersBase::startCapture(const std::string& path)
+{
+  std::unique_ptr<sick::communication::CaptureWriter> writer =
+    sick::make_unique<sick::communication::CaptureWriter>(path);
+  std::lock_guard<std::mutex> lock(m_capture_mutex);
+  m_capture_writer = std::move(writer);
+  m_is_capturing   = true;
+}
+
+void SickSafetyscannersBase::stopCapture()
+{
+  std::lock_guard<std::mutex> lock(m_capture_mutex);
+  m_is_capturing = false;
+  if (m_capture_writer)
+  {
+    LOG_INFO("Captured %lu datagrams",
+             static_cast<unsigned long>(m_capture_writer->getNumberOfRecords()));
+    m_capture_writer.reset();
+  }
+}
+
+void SickSafetyscannersBase::captureDatagram(const sick::datastructure::PacketBuffer& buffer)
+{
+  if (!m_is_capturing)
+  {
+    return;
+  }
+  int64_t timestamp = buffer.getReceiveTime() != 0 ? buffer.getReceiveTime()
+                                                   : sick::communication::CaptureWriter::now();
+  std::lock_guard<std::mutex> lock(m_capture_mutex);
+  if (m_capture_writer)
+  {
+    m_capture_writer->write(buffer, timestamp);
+  }
+}
+
+void SickSafetyscannersBase::decodePartialPacket(
+  const sick::datastructure::PacketBuffer& buffer,
+  const sick::datastructure::PacketProgress& progress)
+{
+  // Without eager measurement data or with a beam region the decoded beams would be discarded
+  if (sick::SensorDataFeatures::isFlagSet(m_parse_features,
+                                          sick::SensorDataFeatures::MEASUREMENT_DATA) &&
+      !m_has_beam_region)
+  {
+    m_measurement_decoder.update(buffer, progress);
+  }
+  if (m_priority_decoder.getBlocks() != 0)
+  {
+    m_priority_decoder.update(buffer, progress);
+  }
+}
+
+void SickSafetyscannersBase::configureDataParser()
+{
+  m_data_parser.setParseFeatures(m_parse_features);
+  if (!m_has_beam_region)
+  {
+    m_data_parser.clearBeamRegion();
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_beam_region_mutex);
+  m_data_parser.setBeamRegion(m_beam_region);
+}
+
+sick::datastructure::LatencyStatistics SickSafetyscannersBase::getStatistics() const
+{
+  return m_latency_recorder.getStatistics();
+}
+
+void SickSafetyscannersBase::resetStatistics()
+{
+  m_latency_recorder.reset();
+}
+
+sick::datastructure::StreamCounters SickSafetyscannersBase::getStreamCounters() const
+{
+  sick::datastructure::StreamCounters counters = m_packet_merger.getCounters();
+  counters.missed_scans                        = m_sequence_tracker.getMissedScans();
+  counters.missed_sequence_numbers             = m_sequence_tracker.getMissedSequenceNumbers();
+  return counters;
+}
+
+void SickSafetyscannersBase::setEvictionPolicy(uint32_t identification_window,
+                                               sick::types::time_duration_t max_age)
+{
+  m_packet_merger.setEvictionPolicy(identification_window, max_age);
+}
+
+void SickSafetyscannersBase::executeInSession(const std::function<void()>& function)
+{
+  if (!m_session_keep_alive)
+  {
+    m_session.open();
+    function();
+    m_session.close();
+    return;
+  }
+
+  bool is_new_session = m_session.ensureOpen();
+  try
+  {
+    function();
+  }
+  catch (const std::exception& e)
+  {
+    // The session is in an unknown state, replies of the failed request might still arrive.
+    m_session.abort();
+    if (is_new_session)
+    {
+      throw;
+    }
+    LOG_WARN("Request in the reused COLA2 session failed, retrying in a new session: %s", e.what());
+    m_session.open();
+    function();
+  }
+}
+
 void SickSafetyscannersBase::changeSensorSettings(const CommSettings& settings)
 {
   CommSettings _settings  = settings;
@@ -119,40 +410,142 @@ void SickSafetyscannersBase::requestApplicationName(
 
 void SickSafetyscannersBase::requestFieldData(std::vector<sick::datastructure::FieldData>& fields)
 {
-  for (int i = 0; i < 128; i++)
-  {
-    sick::datastructure::FieldData field_data;
-    createAndExecuteCommand<sick::cola2::FieldHeaderVariableCommand>(m_session, field_data, i);
-
-    if (field_data.getIsValid())
+  executeInSession([&]() {
+    std::vector<sick::datastructure::FieldData> field_data;
+    uint16_t end_index;
+    sick::cola2::CommandPipeline pipeline(m_session);
+    addFieldHeaderRequest(pipeline, m_session, field_data, end_index);
+    pipeline.run();
+
+    std::vector<uint16_t> valid_indices = getValidFieldIndices(field_data, end_index);
+    addFieldGeometryRequest(pipeline, m_session, field_data, valid_indices);
+    pipeline.run();
+
+    for (uint16_t index : valid_indices)
     {
-      createAndExecuteCommand<sick::cola2::FieldGeometryVariableCommand>(m_session, field_data, i);
-      fields.push_back(field_data);
+      fields.push_back(std::move(field_data[index]));
     }
-    else if (i > 0) // index 0 is reserved for contour data
+  });
+}
+
+void SickSafetyscannersBase::requestMonitoringCases(
+  std::vector<sick::datastructure::MonitoringCaseData>& monitoring_cases)
+{
+  executeInSession([&]() {
+    std::vector<sick::datastructure::MonitoringCaseData> monitoring_case_data;
+    uint16_t end_index;
+    sick::cola2::CommandPipeline pipeline(m_session);
+    addMonitoringCaseRequest(pipeline, m_session, monitoring_case_data, end_index);
+    pipeline.run();
+
+    monitoring_cases.insert(monitoring_cases.end(),
+                            monitoring_case_data.begin(),
+                            monitoring_case_data.begin() + end_index);
+  });
+}
+
+void SickSafetyscannersBase::requestSensorSnapshot(sick::datastructure::SensorSnapshot& snapshot)
+{
+  auto start = std::chrono::steady_clock::now();
+  executeInSession([&]() {
+    // Every item is overwritten, so a retry in a new session starts from scratch.
+    sick::datastructure::SensorSnapshot& result = snapshot;
+    result.field_data.clear();
+    result.monitoring_cases.clear();
+    sick::cola2::CommandPipeline pipeline(m_session);
+    pipeline.addCommand<sick::cola2::TypeCodeVariableCommand>("type code", result.type_code);
+    pipeline.addCommand<sick::cola2::SerialNumberVariableCommand>("serial number",
+                                                                  result.serial_number);
+    pipeline.addCommand<sick::cola2::FirmwareVersionVariableCommand>("firmware version",
+                                                                     result.firmware_version);
+    pipeline.addCommand<sick::cola2::OrderNumberVariableCommand>("order number",
+                                                                 result.order_number);
+    pipeline.addCommand<sick::cola2::ProjectNameVariableCommand>("project name",
+                                                                 result.project_name);
+    pipeline.addCommand<sick::cola2::UserNameVariableCommand>("user name", result.user_name);
+    pipeline.addCommand<sick::cola2::ConfigMetadataVariableCommand>("config metadata",
+                                                                    result.config_metadata);
+    pipeline.addCommand<sick::cola2::MeasurementPersistentConfigVariableCommand>(
+      "persistent config", result.persistent_config);
+
+    std::vector<sick::datastructure::FieldData> field_data;
+    uint16_t field_end_index;
+    addFieldHeaderRequest(pipeline, m_session, field_data, field_end_index);
+    std::vector<sick::datastructure::MonitoringCaseData> monitoring_case_data;
+    uint16_t monitoring_case_end_index;
+    addMonitoringCaseRequest(pipeline, m_session, monitoring_case_data, monitoring_case_end_index);
+    pipeline.run();
+
+    // The geometries can only be requested once all field headers are known.
+    std::vector<uint16_t> valid_indices = getValidFieldIndices(field_data, field_end_index);
+    addFieldGeometryRequest(pipeline, m_session, field_data, valid_indices);
+    pipeline.run();
+
+    for (uint16_t index : valid_indices)
     {
-      break; // skip other requests after first invalid
+      result.field_data.push_back(std::move(field_data[index]));
     }
+    result.monitoring_cases.assign(monitoring_case_data.begin(),
+                                   monitoring_case_data.begin() + monitoring_case_end_index);
+    result.timings = pipeline.getTimings();
+  });
+  snapshot.total_duration = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  for (const auto& timing : snapshot.timings)
+  {
+    LOG_DEBUG("Snapshot item %s: %u commands, started after %ld us, took %ld us",
+              timing.name.c_str(),
+              timing.number_of_commands,
+              static_cast<long>(timing.start.count()),
+              static_cast<long>(timing.duration.count()));
   }
+  LOG_INFO("Sensor snapshot took %ld us", static_cast<long>(snapshot.total_duration.count()));
 }
 
-void SickSafetyscannersBase::requestMonitoringCases(
+bool SickSafetyscannersBase::requestCachedConfiguration(
+  const sick::data_processing::ConfigurationCache& cache,
+  std::vector<sick::datastructure::FieldData>& fields,
   std::vector<sick::datastructure::MonitoringCaseData>& monitoring_cases)
 {
-  for (int i = 0; i < 254; i++)
-  {
-    sick::datastructure::MonitoringCaseData monitoring_case_data;
-    createAndExecuteCommand<sick::cola2::MonitoringCaseVariableCommand>(
-      m_session, monitoring_case_data, i);
-    if (monitoring_case_data.getIsValid())
+  bool is_cached = false;
+  executeInSession([&]() {
+    sick::datastructure::SerialNumber serial_number;
+    sick::datastructure::ConfigMetadata config_metadata;
+    sick::cola2::CommandPipeline pipeline(m_session);
+    pipeline.addCommand<sick::cola2::SerialNumberVariableCommand>("serial number", serial_number);
+    pipeline.addCommand<sick::cola2::ConfigMetadataVariableCommand>("config metadata",
+                                                                    config_metadata);
+    pipeline.run();
+
+    is_cached = cache.load(serial_number, config_metadata, fields, monitoring_cases);
+    if (is_cached)
     {
-      monitoring_cases.push_back(monitoring_case_data);
+      return;
     }
-    else
+
+    std::vector<sick::datastructure::FieldData> field_data;
+    uint16_t field_end_index;
+    addFieldHeaderRequest(pipeline, m_session, field_data, field_end_index);
+    std::vector<sick::datastructure::MonitoringCaseData> monitoring_case_data;
+    uint16_t monitoring_case_end_index;
+    addMonitoringCaseRequest(pipeline, m_session, monitoring_case_data, monitoring_case_end_index);
+    pipeline.run();
+
+    std::vector<uint16_t> valid_indices = getValidFieldIndices(field_data, field_end_index);
+    addFieldGeometryRequest(pipeline, m_session, field_data, valid_indices);
+    pipeline.run();
+
+    fields.clear();
+    for (uint16_t index : valid_indices)
     {
-      break; // skip other requests after first invalid
+      fields.push_back(std::move(field_data[index]));
     }
-  }
+    monitoring_cases.assign(monitoring_case_data.begin(),
+                            monitoring_case_data.begin() + monitoring_case_end_index);
+    cache.store(serial_number, config_metadata, fields, monitoring_cases);
+  });
+  return is_cached;
 }
 
 void SickSafetyscannersBase::requestDeviceName(
@@ -235,6 +628,67 @@ void SickSafetyscannersBase::requestRequiredUserAction(
                                                                           required_user_action);
 }
 
+uint32_t SickSafetyscannersBase::getKernelDropCount() const
+{
+  return m_udp_client.getKernelDropCount();
+}
+
+void SickSafetyscannersBase::setParseFeatures(sick::types::SensorFeatures parse_features)
+{
+  m_parse_features = parse_features;
+}
+
+sick::types::SensorFeatures SickSafetyscannersBase::getParseFeatures() const
+{
+  return m_parse_features;
+}
+
+void SickSafetyscannersBase::setBeamRegion(const sick::data_processing::BeamRegion& region)
+{
+  std::lock_guard<std::mutex> lock(m_beam_region_mutex);
+  m_beam_region     = region;
+  m_has_beam_region = true;
+}
+
+void SickSafetyscannersBase::clearBeamRegion()
+{
+  m_has_beam_region = false;
+}
+
+const std::size_t AsyncSickSafetyScanner::DEFAULT_DELIVERY_CAPACITY;
+
+namespace {
+
+/*!
+ * \brief A parsed scan waiting for the callback, with the timestamps of its earlier stages.
+ */
+struct DeliveryItem
+{
+  std::shared_ptr<sick::datastructure::Data> data;
+  int64_t receive_time;
+  int64_t parsed_time;
+};
+
+} // namespace
+
+struct AsyncSickSafetyScanner::DecoupledDelivery
+{
+  DecoupledDelivery(std::size_t capacity, sick::datastructure::OverflowPolicy overflow_policy)
+    : ring(capacity)
+    , policy(overflow_policy)
+    , stopped(false)
+  {
+  }
+
+  sick::datastructure::LockFreeRing<DeliveryItem> ring;
+  sick::datastructure::OverflowPolicy policy;
+  // Only used to put the delivery thread to sleep, the ring itself is lock-free.
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::atomic<bool> stopped;
+  boost::thread thread;
+};
+
 AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
                                                sick::types::port_t sensor_tcp_port,
                                                CommSettings comm_settings,
@@ -242,6 +696,7 @@ AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_
   : SickSafetyscannersBase(sensor_ip, sensor_tcp_port, comm_settings)
   , m_scan_data_cb(callback)
   , m_work(sick::make_unique<boost::asio::io_service::work>(m_io_service))
+  , m_is_running(false)
 {
   m_service_thread = boost::thread([this] {
     try
@@ -263,6 +718,7 @@ AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_
   : SickSafetyscannersBase(sensor_ip, sensor_tcp_port, comm_settings, interface_ip)
   , m_scan_data_cb(callback)
   , m_work(sick::make_unique<boost::asio::io_service::work>(m_io_service))
+  , m_is_running(false)
 {
   m_service_thread = boost::thread([this] {
     try
@@ -284,6 +740,7 @@ AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_
   : SickSafetyscannersBase(sensor_ip, sensor_tcp_port, comm_settings, io_service)
   , m_scan_data_cb(callback)
   , m_work()
+  , m_is_running(false)
 {
 }
 
@@ -295,28 +752,186 @@ AsyncSickSafetyScanner::~AsyncSickSafetyScanner()
   {
     m_service_thread.join();
   }
+  if (m_delivery)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_delivery->mutex);
+      m_delivery->stopped = true;
+    }
+    m_delivery->condition.notify_one();
+    if (m_delivery->thread.joinable())
+    {
+      m_delivery->thread.join();
+    }
+  }
+}
+
+void AsyncSickSafetyScanner::enableDecoupledDelivery(std::size_t capacity,
+                                                     sick::datastructure::OverflowPolicy policy)
+{
+  requireNotRunning("enableDecoupledDelivery");
+  if (m_delivery)
+  {
+    LOG_WARN("Decoupled delivery is already enabled.");
+    return;
+  }
+  m_delivery = sick::make_unique<DecoupledDelivery>(capacity, policy);
+  // Scans in the ring, at the callback and in parsing are recycled without allocating.
+  m_data_pool.setMaxSize(m_delivery->ring.capacity() + 2);
+  m_delivery->thread = boost::thread([this] { deliverScans(); });
+}
+
+sick::datastructure::RingCounters AsyncSickSafetyScanner::getDeliveryCounters() const
+{
+  if (!m_delivery)
+  {
+    return sick::datastructure::RingCounters();
+  }
+  return m_delivery->ring.getCounters();
+}
+
+void AsyncSickSafetyScanner::setPriorityCallback(sick::types::ScanDataCb callback,
+                                                 sick::types::SensorFeatures blocks)
+{
+  requireNotRunning("setPriorityCallback");
+  m_priority_cb = callback;
+  m_priority_decoder.setBlocks(m_priority_cb ? blocks : 0);
+}
+
+void AsyncSickSafetyScanner::dispatchPriorityData()
+{
+  if (!m_priority_decoder.isReady())
+  {
+    return;
+  }
+  try
+  {
+    m_priority_cb(m_priority_decoder.takeData());
+  }
+  catch (const std::exception& e)
+  {
+    LOG_ERROR("%s", e.what());
+  }
+}
+
+void AsyncSickSafetyScanner::deliverScans()
+{
+  DecoupledDelivery& delivery = *m_delivery;
+  DeliveryItem item = DeliveryItem();
+  while (!delivery.stopped)
+  {
+    if (delivery.ring.tryPop(item))
+    {
+      try
+      {
+        invokeCallback(*item.data, item.receive_time, item.parsed_time);
+      }
+      catch (const std::exception& e)
+      {
+        LOG_ERROR("%s", e.what());
+      }
+      m_data_pool.release(item.data);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(delivery.mutex);
+    delivery.condition.wait(lock,
+                            [&delivery] { return delivery.stopped || !delivery.ring.empty(); });
+  }
 }
 
 void AsyncSickSafetyScanner::processUDPPacket(const sick::datastructure::PacketBuffer& buffer)
 {
-  if (m_packet_merger.addUDPPacket(buffer))
+  using sick::data_processing::LatencyRecorder;
+  captureDatagram(buffer);
+  bool is_complete = m_packet_merger.addUDPPacket(buffer);
+  // The merger is unlocked again, so the callback may query it
+  dispatchPriorityData();
+  if (is_complete)
   {
+    int64_t reassembled_time = sick::datastructure::PacketBuffer::now();
     sick::datastructure::PacketBuffer deployed_buffer = m_packet_merger.getDeployedPacketBuffer();
-    sick::data_processing::ParseData data_parser;
-    sick::datastructure::Data data = data_parser.parseUDPSequence(deployed_buffer);
+    int64_t receive_time = deployed_buffer.getReceiveTime();
+    m_latency_recorder.record(LatencyRecorder::SOCKET, buffer.getReceiveTime(), reassembled_time);
+    m_latency_recorder.record(LatencyRecorder::REASSEMBLY, receive_time, reassembled_time);
+
+    std::shared_ptr<sick::datastructure::Data> data = m_data_pool.acquire();
+    configureDataParser();
+    m_data_parser.parseUDPSequence(deployed_buffer, *data, m_measurement_decoder);
+    int64_t parsed_time = sick::datastructure::PacketBuffer::now();
+    m_sequence_tracker.update(*data->getDataHeaderPtr());
+    m_latency_recorder.record(LatencyRecorder::PARSING, reassembled_time, parsed_time);
+
+    if (m_delivery)
+    {
+      DeliveryItem item = {data, receive_time, parsed_time};
+      // Scans discarded as oldest go back to the pool like delivered ones
+      auto release = [this](DeliveryItem& discarded) { m_data_pool.release(discarded.data); };
+      if (!m_delivery->ring.push(std::move(item), m_delivery->policy, release))
+      {
+        m_data_pool.release(data);
+        return;
+      }
+      // Taking the mutex orders the push before a delivery thread going to sleep.
+      {
+        std::lock_guard<std::mutex> lock(m_delivery->mutex);
+      }
+      m_delivery->condition.notify_one();
+      return;
+    }
+    invokeCallback(*data, receive_time, parsed_time);
+    m_data_pool.release(data);
+  }
+}
+
+void AsyncSickSafetyScanner::invokeCallback(const sick::datastructure::Data& data,
+                                            int64_t receive_time,
+                                            int64_t parsed_time)
+{
+  using sick::data_processing::LatencyRecorder;
+  int64_t entry_time = sick::datastructure::PacketBuffer::now();
+  m_scan_data_cb(data);
+  int64_t exit_time = sick::datastructure::PacketBuffer::now();
+  m_latency_recorder.record(LatencyRecorder::DELIVERY, parsed_time, entry_time);
+  m_latency_recorder.record(LatencyRecorder::CALLBACK, entry_time, exit_time);
+  m_latency_recorder.record(LatencyRecorder::TOTAL, receive_time, exit_time);
+}
+
+void AsyncSickSafetyScanner::processUDPPacketBatch(
+  const std::vector<sick::datastructure::PacketBuffer>& batch)
+{
+  for (const auto& buffer : batch)
+  {
+    processUDPPacket(buffer);
+  }
+}
 
-    m_scan_data_cb(data);
+void AsyncSickSafetyScanner::requireNotRunning(const char* function) const
+{
+  if (m_is_running)
+  {
+    throw sick::runtime_error(std::string(function) + " has to be called before run().");
   }
 }
 
 void AsyncSickSafetyScanner::run()
 {
+  m_is_running = true;
   sick::types::PacketHandler callback = [this](const sick::datastructure::PacketBuffer& buffer) {
     processUDPPacket(buffer);
   };
   m_udp_client.run(std::move(callback));
 }
 
+void AsyncSickSafetyScanner::runBatched(std::size_t batch_size)
+{
+  m_is_running = true;
+  sick::types::PacketBatchHandler callback =
+    [this](const std::vector<sick::datastructure::PacketBuffer>& batch) {
+      processUDPPacketBatch(batch);
+    };
+  m_udp_client.runBatched(std::move(callback), batch_size);
+}
+
 void AsyncSickSafetyScanner::stop()
 {
   m_udp_client.stop();
@@ -329,15 +944,34 @@ bool SyncSickSafetyScanner::isDataAvailable() const
 
 const Data SyncSickSafetyScanner::receive(sick::types::time_duration_t timeout)
 {
-  sick::data_processing::ParseData data_parser;
+  sick::datastructure::Data data;
+  receive(data, timeout);
+  return data;
+}
+
+void SyncSickSafetyScanner::receive(Data& data, sick::types::time_duration_t timeout)
+{
+  using sick::data_processing::LatencyRecorder;
+  int64_t last_receive_time = 0;
   while (!m_packet_merger.isComplete())
   {
     auto buffer = m_udp_client.receive(timeout);
+    captureDatagram(buffer);
+    last_receive_time = buffer.getReceiveTime();
     m_packet_merger.addUDPPacket(buffer);
   }
+  int64_t reassembled_time = sick::datastructure::PacketBuffer::now();
   sick::datastructure::PacketBuffer deployed_buffer = m_packet_merger.getDeployedPacketBuffer();
-  sick::datastructure::Data data                    = data_parser.parseUDPSequence(deployed_buffer);
-  return data;
+  int64_t receive_time = deployed_buffer.getReceiveTime();
+  m_latency_recorder.record(LatencyRecorder::SOCKET, last_receive_time, reassembled_time);
+  m_latency_recorder.record(LatencyRecorder::REASSEMBLY, receive_time, reassembled_time);
+
+  configureDataParser();
+  m_data_parser.parseUDPSequence(deployed_buffer, data, m_measurement_decoder);
+  int64_t parsed_time = sick::datastructure::PacketBuffer::now();
+  m_sequence_tracker.update(*data.getDataHeaderPtr());
+  m_latency_recorder.record(LatencyRecorder::PARSING, reassembled_time, parsed_time);
+  m_latency_recorder.record(LatencyRecorder::TOTAL, receive_time, parsed_time);
 }
 
 } // namespace sick
@@ -34,15 +34,30 @@
 
 #include "sick_safetyscanners_base/cola2/Cola2Session.h"
 #include "sick_safetyscanners_base/Types.h"
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
 #include <boost/asio.hpp>
 
+#include <map>
+
 namespace sick {
 namespace cola2 {
 
+namespace {
+
+// STx and length, the length field does not include these 8 bytes.
+const std::size_t TELEGRAM_HEADER_SIZE = 8;
+const uint32_t TELEGRAM_STX            = 0x02020202;
+
+} // namespace
+
+const std::size_t Cola2Session::DEFAULT_PIPELINE_DEPTH;
+
 Cola2Session::Cola2Session(communication::TCPClientPtr tcp_client)
   : m_request_id(0)
   , m_session_id(boost::none)
   , m_tcp_client_ptr(std::move(tcp_client))
+  , m_stream_buffer()
+  , m_last_activity()
 {
 }
 
@@ -75,6 +90,7 @@ void Cola2Session::open()
     close();
   }
   m_tcp_client_ptr->connect();
+  m_stream_buffer.clear();
   CreateSession cmd(*this);
   sendCommand(cmd);
   auto sessID = cmd.getSessionID();
@@ -98,6 +114,30 @@ void Cola2Session::close()
   sendCommand(cmd);
   // auto sessID = cmd.getSessionID();
   m_tcp_client_ptr->disconnect();
+  m_stream_buffer.clear();
+}
+
+bool Cola2Session::ensureOpen()
+{
+  // Half of the heartbeat timeout leaves enough margin for the next command to reach the sensor.
+  const std::chrono::seconds max_idle_time(CreateSession::HEARTBEAT_TIMEOUT_SECONDS / 2);
+  if (isOpen() && std::chrono::steady_clock::now() - m_last_activity < max_idle_time)
+  {
+    return false;
+  }
+  if (isOpen())
+  {
+    abort();
+  }
+  open();
+  return true;
+}
+
+void Cola2Session::abort()
+{
+  m_tcp_client_ptr->disconnect();
+  m_stream_buffer.clear();
+  m_session_id = boost::none;
 }
 
 void Cola2Session::assembleAndSendTelegram(Command& cmd)
@@ -113,30 +153,99 @@ void Cola2Session::assembleAndSendTelegram(Command& cmd)
 }
 
 sick::datastructure::PacketBuffer
-Cola2Session::receiveAndProcessResponse(Command& cmd, boost::posix_time::time_duration timeout)
+Cola2Session::receiveTelegram(boost::posix_time::time_duration timeout)
 {
-  sick::data_processing::TCPPacketMerger packet_merger(0);
-  sick::data_processing::ParseTCPPacket tcp_packet_parser;
-
-  while (!packet_merger.isComplete())
+  for (;;)
   {
-    sick::datastructure::PacketBuffer packet_buffer = m_tcp_client_ptr->receive(timeout);
-    if (packet_merger.isEmpty())
+    if (m_stream_buffer.size() >= TELEGRAM_HEADER_SIZE)
     {
-      auto expectedPacketLength = tcp_packet_parser.getExpectedPacketLength(packet_buffer);
-      packet_merger.setTargetSize(expectedPacketLength);
+      const uint8_t* data_ptr = m_stream_buffer.data();
+      if (read_write_helper::readUint32BigEndian(data_ptr + 0) != TELEGRAM_STX)
+      {
+        m_stream_buffer.clear();
+        throw runtime_error("Lost synchronization with the telegram stream of the sensor.");
+      }
+      std::size_t telegram_length =
+        read_write_helper::readUint32BigEndian(data_ptr + 4) + TELEGRAM_HEADER_SIZE;
+      if (m_stream_buffer.size() >= telegram_length)
+      {
+        sick::datastructure::PacketBuffer telegram(
+          std::vector<uint8_t>(m_stream_buffer.begin(), m_stream_buffer.begin() + telegram_length));
+        m_stream_buffer.erase(m_stream_buffer.begin(), m_stream_buffer.begin() + telegram_length);
+        m_last_activity = std::chrono::steady_clock::now();
+        return telegram;
+      }
     }
-    packet_merger.addTCPPacket(packet_buffer);
+    sick::datastructure::PacketBuffer packet_buffer = m_tcp_client_ptr->receive(timeout);
+    const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = packet_buffer.getBuffer();
+    m_stream_buffer.insert(m_stream_buffer.end(), vec_ptr->begin(), vec_ptr->end());
   }
-  sick::datastructure::PacketBuffer response = packet_merger.getDeployedPacketBuffer();
-  return response;
 }
 
 void Cola2Session::sendCommand(Command& cmd, boost::posix_time::time_duration timeout)
 {
   assembleAndSendTelegram(cmd);
-  auto response = receiveAndProcessResponse(cmd, timeout);
-  cmd.processReplyBase(*response.getBuffer());
+  sick::data_processing::ParseTCPPacket tcp_packet_parser;
+  for (;;)
+  {
+    auto response = receiveTelegram(timeout);
+    // Replies of previously pipelined commands which were not awaited anymore are skipped.
+    if (tcp_packet_parser.getRequestID(response) == cmd.getRequestID())
+    {
+      cmd.processReplyBase(*response.getBuffer());
+      return;
+    }
+    LOG_WARN("Skipping reply with unexpected request ID %u.",
+             tcp_packet_parser.getRequestID(response));
+  }
+}
+
+void Cola2Session::sendCommandsPipelined(const CommandGenerator& next_command,
+                                         const ReplyHandler& on_reply,
+                                         std::size_t pipeline_depth,
+                                         boost::posix_time::time_duration timeout)
+{
+  if (pipeline_depth == 0)
+  {
+    pipeline_depth = 1;
+  }
+  sick::data_processing::ParseTCPPacket tcp_packet_parser;
+  std::map<uint16_t, Command*> pending;
+  bool has_more_commands = true;
+  for (;;)
+  {
+    while (has_more_commands && pending.size() < pipeline_depth)
+    {
+      Command* cmd = next_command();
+      if (cmd == nullptr)
+      {
+        has_more_commands = false;
+        break;
+      }
+      assembleAndSendTelegram(*cmd);
+      pending[cmd->getRequestID()] = cmd;
+    }
+    if (pending.empty())
+    {
+      return;
+    }
+
+    auto response = receiveTelegram(timeout);
+    auto it       = pending.find(tcp_packet_parser.getRequestID(response));
+    if (it == pending.end())
+    {
+      LOG_WARN("Skipping reply with unexpected request ID %u.",
+               tcp_packet_parser.getRequestID(response));
+      continue;
+    }
+    Command* cmd = it->second;
+    pending.erase(it);
+    cmd->processReplyBase(*response.getBuffer());
+    if (on_reply)
+    {
+      on_reply(*cmd);
+    }
+  }
 }
 
 } // namespace cola2
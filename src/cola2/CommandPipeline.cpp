@@ -0,0 +1,146 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file CommandPipeline.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/cola2/CommandPipeline.h"
+
+namespace sick {
+namespace cola2 {
+
+CommandPipeline::CommandPipeline(Cola2Session& session)
+  : m_session(session)
+  , m_requests()
+  , m_next_request(0)
+  , m_is_started(false)
+  , m_start()
+{
+}
+
+void CommandPipeline::addRequest(const std::string& name,
+                                 const CommandFactory& factory,
+                                 const ReplyHandler& on_reply)
+{
+  Request request;
+  request.name         = name;
+  request.factory      = factory;
+  request.on_reply     = on_reply;
+  request.is_exhausted = false;
+  m_requests.push_back(std::move(request));
+}
+
+void CommandPipeline::run(std::size_t pipeline_depth)
+{
+  if (!m_is_started)
+  {
+    m_start      = std::chrono::steady_clock::now();
+    m_is_started = true;
+  }
+
+  // Maps every command in flight to the index of its request.
+  std::map<const Command*, std::size_t> owners;
+  m_session.sendCommandsPipelined(
+    [&]() { return nextCommand(owners); },
+    [&](Command& cmd) {
+      auto it = owners.find(&cmd);
+      if (it == owners.end())
+      {
+        return;
+      }
+      Request& request   = m_requests[it->second];
+      request.last_reply = std::chrono::steady_clock::now();
+      owners.erase(it);
+      if (request.on_reply)
+      {
+        for (std::size_t i = 0; i < request.commands.size(); i++)
+        {
+          if (request.commands[i].get() == &cmd)
+          {
+            request.on_reply(static_cast<uint16_t>(i));
+            break;
+          }
+        }
+      }
+    },
+    pipeline_depth);
+}
+
+Command* CommandPipeline::nextCommand(std::map<const Command*, std::size_t>& owners)
+{
+  while (m_next_request < m_requests.size())
+  {
+    Request& request = m_requests[m_next_request];
+    if (!request.is_exhausted)
+    {
+      std::unique_ptr<Command> cmd =
+        request.factory(static_cast<uint16_t>(request.commands.size()));
+      if (cmd)
+      {
+        if (request.commands.empty())
+        {
+          request.first_sent = std::chrono::steady_clock::now();
+        }
+        owners[cmd.get()] = m_next_request;
+        request.commands.push_back(std::move(cmd));
+        return request.commands.back().get();
+      }
+      request.is_exhausted = true;
+    }
+    m_next_request++;
+  }
+  return nullptr;
+}
+
+std::vector<sick::datastructure::RequestTiming> CommandPipeline::getTimings() const
+{
+  std::vector<sick::datastructure::RequestTiming> timings;
+  for (std::size_t i = 0; i < m_next_request && i < m_requests.size(); i++)
+  {
+    const Request& request = m_requests[i];
+    sick::datastructure::RequestTiming timing;
+    timing.name               = request.name;
+    timing.number_of_commands = static_cast<uint16_t>(request.commands.size());
+    timing.start              = std::chrono::microseconds(0);
+    timing.duration           = std::chrono::microseconds(0);
+    if (!request.commands.empty())
+    {
+      timing.start = std::chrono::duration_cast<std::chrono::microseconds>(request.first_sent -
+                                                                            m_start);
+      timing.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        request.last_reply - request.first_sent);
+    }
+    timings.push_back(timing);
+  }
+  return timings;
+}
+
+} // namespace cola2
+} // namespace sick
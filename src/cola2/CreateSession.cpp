@@ -40,6 +40,8 @@
 namespace sick {
 namespace cola2 {
 
+const uint8_t CreateSession::HEARTBEAT_TIMEOUT_SECONDS;
+
 CreateSession::CreateSession(Cola2Session& session)
   : Command(session, 0x4F, 0x58) // see cola2 manual 0x4F = O, 0x58 = X
 {
@@ -78,8 +80,7 @@ bool CreateSession::processReply()
 
 void CreateSession::writeHeartbeatTimeoutToDataPtr(std::vector<uint8_t>::iterator it) const
 {
-  uint8_t heart_beat_time_out_seconds = 60;
-  read_write_helper::writeUint8BigEndian(it + 0, heart_beat_time_out_seconds);
+  read_write_helper::writeUint8BigEndian(it + 0, HEARTBEAT_TIMEOUT_SECONDS);
 }
 
 void CreateSession::writeClientIdToDataPtr(std::vector<uint8_t>::iterator it) const
@@ -0,0 +1,229 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file CaptureFile.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/communication/CaptureFile.h"
+
+#include "sick_safetyscanners_base/Exceptions.h"
+#include "sick_safetyscanners_base/Logging.h"
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SICK_CAPTURE_USE_MMAP
+#endif
+
+namespace sick {
+namespace communication {
+
+namespace {
+
+std::size_t getPaddedLength(std::size_t length)
+{
+  return (length + capture_format::ALIGNMENT - 1) / capture_format::ALIGNMENT *
+         capture_format::ALIGNMENT;
+}
+
+uint32_t readUint32LittleEndian(const uint8_t* data)
+{
+  return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+         (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+uint64_t readUint64LittleEndian(const uint8_t* data)
+{
+  return static_cast<uint64_t>(readUint32LittleEndian(data)) |
+         (static_cast<uint64_t>(readUint32LittleEndian(data + 4)) << 32);
+}
+
+} // namespace
+
+CaptureWriter::CaptureWriter(const std::string& path)
+  : m_file(path.c_str(), std::ios::binary | std::ios::trunc)
+  , m_record_header(capture_format::RECORD_HEADER_SIZE)
+  , m_number_of_records(0)
+{
+  if (!m_file)
+  {
+    throw runtime_error("Could not create the capture file " + path);
+  }
+  std::vector<uint8_t> file_header(capture_format::FILE_HEADER_SIZE, 0);
+  std::copy(capture_format::MAGIC, capture_format::MAGIC + sizeof(capture_format::MAGIC),
+            file_header.begin());
+  read_write_helper::writeUint32LittleEndian(file_header.begin() + 8, capture_format::VERSION);
+  m_file.write(reinterpret_cast<const char*>(file_header.data()), file_header.size());
+}
+
+void CaptureWriter::write(const sick::datastructure::PacketBuffer& buffer, int64_t timestamp)
+{
+  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
+  uint64_t raw_timestamp                                    = static_cast<uint64_t>(timestamp);
+  read_write_helper::writeUint32LittleEndian(m_record_header.begin() + 0,
+                                             static_cast<uint32_t>(raw_timestamp));
+  read_write_helper::writeUint32LittleEndian(m_record_header.begin() + 4,
+                                             static_cast<uint32_t>(raw_timestamp >> 32));
+  read_write_helper::writeUint32LittleEndian(m_record_header.begin() + 8, buffer.getLength());
+  read_write_helper::writeUint32LittleEndian(m_record_header.begin() + 12, 0);
+  m_file.write(reinterpret_cast<const char*>(m_record_header.data()), m_record_header.size());
+  m_file.write(reinterpret_cast<const char*>(vec_ptr->data()), buffer.getLength());
+
+  static const char padding[capture_format::ALIGNMENT] = {};
+  m_file.write(padding, getPaddedLength(buffer.getLength()) - buffer.getLength());
+  m_number_of_records++;
+}
+
+void CaptureWriter::flush()
+{
+  m_file.flush();
+}
+
+uint64_t CaptureWriter::getNumberOfRecords() const
+{
+  return m_number_of_records;
+}
+
+int64_t CaptureWriter::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::system_clock::now().time_since_epoch())
+    .count();
+}
+
+CaptureReader::CaptureReader(const std::string& path)
+  : m_data(nullptr)
+  , m_size(0)
+  , m_position(capture_format::FILE_HEADER_SIZE)
+  , m_is_mapped(false)
+  , m_fallback_buffer()
+{
+#ifdef SICK_CAPTURE_USE_MMAP
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    throw runtime_error("Could not open the capture file " + path);
+  }
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+  {
+    void* mapping =
+      ::mmap(nullptr, static_cast<std::size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED)
+    {
+      ::madvise(mapping, static_cast<std::size_t>(file_stat.st_size), MADV_SEQUENTIAL);
+      m_data      = static_cast<const uint8_t*>(mapping);
+      m_size      = static_cast<std::size_t>(file_stat.st_size);
+      m_is_mapped = true;
+    }
+  }
+  ::close(fd);
+#endif
+  if (!m_is_mapped)
+  {
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file)
+    {
+      throw runtime_error("Could not open the capture file " + path);
+    }
+    m_fallback_buffer.assign(std::istreambuf_iterator<char>(file),
+                             std::istreambuf_iterator<char>());
+    m_data = m_fallback_buffer.data();
+    m_size = m_fallback_buffer.size();
+  }
+
+  if (m_size < capture_format::FILE_HEADER_SIZE ||
+      !std::equal(capture_format::MAGIC, capture_format::MAGIC + sizeof(capture_format::MAGIC),
+                  m_data) ||
+      readUint32LittleEndian(m_data + 8) != capture_format::VERSION)
+  {
+    unmap();
+    throw runtime_error("Not a capture file of a supported version: " + path);
+  }
+}
+
+CaptureReader::~CaptureReader()
+{
+  unmap();
+}
+
+void CaptureReader::unmap()
+{
+#ifdef SICK_CAPTURE_USE_MMAP
+  if (m_is_mapped)
+  {
+    ::munmap(const_cast<uint8_t*>(m_data), m_size);
+    m_is_mapped = false;
+  }
+#endif
+}
+
+bool CaptureReader::next(CaptureRecord& record)
+{
+  if (m_size - m_position < capture_format::RECORD_HEADER_SIZE)
+  {
+    return false;
+  }
+  const uint8_t* header = m_data + m_position;
+  uint32_t length       = readUint32LittleEndian(header + 8);
+  if (m_size - m_position - capture_format::RECORD_HEADER_SIZE < length)
+  {
+    LOG_WARN("Capture ends with a truncated datagram.");
+    m_position = m_size;
+    return false;
+  }
+  record.timestamp = static_cast<int64_t>(readUint64LittleEndian(header));
+  record.data      = header + capture_format::RECORD_HEADER_SIZE;
+  record.length    = length;
+  m_position = std::min(m_size, m_position + capture_format::RECORD_HEADER_SIZE +
+                                  getPaddedLength(length));
+  return true;
+}
+
+void CaptureReader::rewind()
+{
+  m_position = capture_format::FILE_HEADER_SIZE;
+}
+
+std::size_t CaptureReader::getSize() const
+{
+  return m_size;
+}
+
+} // namespace communication
+} // namespace sick
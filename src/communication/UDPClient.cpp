@@ -36,6 +36,7 @@
 
 #include "sick_safetyscanners_base/communication/UDPClient.h"
 #include "sick_safetyscanners_base/Exceptions.h"
+#include "sick_safetyscanners_base/Generics.h"
 #include "sick_safetyscanners_base/Logging.h"
 
 #include <boost/array.hpp>
@@ -44,12 +45,22 @@
 #include <boost/lambda/bind.hpp>
 #include <boost/lambda/lambda.hpp>
 #include <boost/thread.hpp>
+#include <cerrno>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
 
+#ifdef __linux__
+#  include <linux/sockios.h>
+#  include <sys/ioctl.h>
+#  include <sys/socket.h>
+#  include <sys/uio.h>
+#  include <time.h>
+#endif
+
 namespace sick {
 namespace communication {
 
@@ -59,13 +70,64 @@ using boost::lambda::_1;
 using boost::lambda::bind;
 using boost::lambda::var;
 
+#ifdef __linux__
+namespace {
+
+//! Space for the control messages of a datagram, the kernel drop counter and its timestamp.
+const std::size_t CONTROL_LENGTH = CMSG_SPACE(sizeof(uint32_t)) + CMSG_SPACE(sizeof(timespec));
+
+/*!
+ * \brief Reads the kernel drop counter and receive timestamp from the control messages of a
+ * received datagram. Values which are not present are left untouched.
+ */
+void readControlMessages(msghdr& header, uint32_t& drop_count, int64_t& receive_time)
+{
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != nullptr; cmsg = CMSG_NXTHDR(&header, cmsg))
+  {
+    if (cmsg->cmsg_level != SOL_SOCKET)
+    {
+      continue;
+    }
+    if (cmsg->cmsg_type == SO_RXQ_OVFL)
+    {
+      std::memcpy(&drop_count, CMSG_DATA(cmsg), sizeof(drop_count));
+    }
+    else if (cmsg->cmsg_type == SCM_TIMESTAMPNS)
+    {
+      timespec stamp;
+      std::memcpy(&stamp, CMSG_DATA(cmsg), sizeof(stamp));
+      receive_time = static_cast<int64_t>(stamp.tv_sec) * 1000000000 + stamp.tv_nsec;
+    }
+  }
+}
+
+} // namespace
+#endif
+
+/*!
+ * \brief Ring of preallocated receive buffers and the system call descriptors pointing to them.
+ */
+struct UDPClient::BatchReceiveState
+{
+  std::vector<std::shared_ptr<std::vector<uint8_t>>> ring;
+  std::vector<sick::datastructure::PacketBuffer> batch;
+#ifdef __linux__
+  std::vector<mmsghdr> headers;
+  std::vector<iovec> iovecs;
+  std::vector<uint8_t> control;
+#endif
+};
+
 UDPClient::UDPClient(boost::asio::io_service& io_service, sick::types::port_t server_port)
   : m_io_service(io_service)
   , m_socket(io_service, boost::asio::ip::udp::endpoint{boost::asio::ip::udp::v4(), server_port})
   , m_packet_handler()
   , m_recv_buffer()
   , m_deadline(io_service)
+  , m_strand(io_service)
+  , m_kernel_drop_count(0)
 {
+  enableControlMessages();
   m_deadline.expires_at(boost::posix_time::pos_infin);
   checkDeadline();
 }
@@ -79,6 +141,8 @@ UDPClient::UDPClient(boost::asio::io_service& io_service,
   , m_packet_handler()
   , m_recv_buffer()
   , m_deadline(io_service)
+  , m_strand(io_service)
+  , m_kernel_drop_count(0)
 {
   if (interface_ip.is_unspecified())
   {
@@ -86,6 +150,7 @@ UDPClient::UDPClient(boost::asio::io_service& io_service,
     exit(-1);
   }
   m_socket.set_option(boost::asio::ip::multicast::join_group(host_ip, interface_ip));
+  enableControlMessages();
 
   m_deadline.expires_at(boost::posix_time::pos_infin);
   checkDeadline();
@@ -93,6 +158,22 @@ UDPClient::UDPClient(boost::asio::io_service& io_service,
 
 UDPClient::~UDPClient() {}
 
+void UDPClient::enableControlMessages()
+{
+#ifdef __linux__
+  int enable = 1;
+  if (setsockopt(m_socket.native_handle(), SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) !=
+      0)
+  {
+    LOG_WARN("Could not enable receive timestamps of the UDP socket: %s", strerror(errno));
+  }
+  if (setsockopt(m_socket.native_handle(), SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) != 0)
+  {
+    LOG_WARN("Could not enable the kernel drop counter of the UDP socket: %s", strerror(errno));
+  }
+#endif
+}
+
 void UDPClient::checkDeadline()
 {
   // Check whether the deadline has passed. We compare the deadline against
@@ -118,9 +199,15 @@ void UDPClient::checkDeadline()
 
 void UDPClient::handleReceive(boost::system::error_code ec, std::size_t bytes_recv)
 {
+  if (ec == boost::asio::error::operation_aborted)
+  {
+    // Receiving was stopped, keep the io_service running for other clients sharing it.
+    return;
+  }
   if (!ec)
   {
     sick::datastructure::PacketBuffer packet_buffer(m_recv_buffer, bytes_recv);
+    packet_buffer.setReceiveTime(getLastReceiveTime());
     m_packet_handler(packet_buffer);
   }
   else
@@ -130,13 +217,210 @@ void UDPClient::handleReceive(boost::system::error_code ec, std::size_t bytes_re
   beginReceive();
 }
 
+void UDPClient::handleReadable(boost::system::error_code ec)
+{
+  if (ec == boost::asio::error::operation_aborted)
+  {
+    return;
+  }
+  if (ec)
+  {
+    throw runtime_error(ec.message());
+  }
+
+#ifdef __linux__
+  // Receives with recvmsg to get the kernel timestamp along with the datagram, which costs the
+  // same system calls as the asynchronous receive of boost::asio.
+  uint8_t control[CONTROL_LENGTH];
+  for (;;)
+  {
+    iovec iov;
+    iov.iov_base = m_recv_buffer.data();
+    iov.iov_len  = m_recv_buffer.size();
+    msghdr header;
+    std::memset(&header, 0, sizeof(header));
+    header.msg_iov        = &iov;
+    header.msg_iovlen     = 1;
+    header.msg_control    = control;
+    header.msg_controllen = sizeof(control);
+
+    ssize_t bytes_recv = recvmsg(m_socket.native_handle(), &header, MSG_DONTWAIT);
+    if (bytes_recv < 0)
+    {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+      {
+        break;
+      }
+      throw runtime_error(strerror(errno));
+    }
+    uint32_t drop_count  = m_kernel_drop_count;
+    int64_t receive_time = 0;
+    readControlMessages(header, drop_count, receive_time);
+    m_kernel_drop_count = drop_count;
+    sick::datastructure::PacketBuffer packet_buffer(m_recv_buffer, bytes_recv);
+    packet_buffer.setReceiveTime(receive_time != 0 ? receive_time
+                                                   : sick::datastructure::PacketBuffer::now());
+    m_packet_handler(packet_buffer);
+  }
+#endif
+  beginReceive();
+}
+
 void UDPClient::beginReceive()
 {
+#ifdef __linux__
+  m_socket.async_wait(
+    boost::asio::ip::udp::socket::wait_read,
+    m_strand.wrap([this](boost::system::error_code ec) { this->handleReadable(ec); }));
+#else
   m_socket.async_receive_from(boost::asio::buffer(m_recv_buffer),
                               m_remote_endpoint,
-                              [this](boost::system::error_code ec, std::size_t bytes_recvd) {
+                              m_strand.wrap([this](boost::system::error_code ec,
+                                                   std::size_t bytes_recvd) {
                                 this->handleReceive(ec, bytes_recvd);
-                              });
+                              }));
+#endif
+}
+
+int64_t UDPClient::getLastReceiveTime()
+{
+#ifdef __linux__
+  timespec stamp;
+  if (ioctl(m_socket.native_handle(), SIOCGSTAMPNS, &stamp) == 0)
+  {
+    return static_cast<int64_t>(stamp.tv_sec) * 1000000000 + stamp.tv_nsec;
+  }
+#endif
+  return sick::datastructure::PacketBuffer::now();
+}
+
+void UDPClient::initBatchReceive(std::size_t batch_size)
+{
+  if (batch_size == 0)
+  {
+    batch_size = 1;
+  }
+  m_batch_state = sick::make_unique<BatchReceiveState>();
+  m_batch_state->batch.reserve(batch_size);
+  for (std::size_t i = 0; i < batch_size; i++)
+  {
+    m_batch_state->ring.push_back(
+      std::make_shared<std::vector<uint8_t>>(sick::datastructure::PacketBuffer::getMaxSize()));
+  }
+
+#ifdef __linux__
+  m_batch_state->headers.resize(batch_size);
+  m_batch_state->iovecs.resize(batch_size);
+  m_batch_state->control.resize(batch_size * CONTROL_LENGTH);
+#endif
+}
+
+void UDPClient::beginBatchReceive()
+{
+#ifdef __linux__
+  m_socket.async_wait(
+    boost::asio::ip::udp::socket::wait_read,
+    m_strand.wrap([this](boost::system::error_code ec) { this->handleBatchReceive(ec); }));
+#else
+  m_socket.async_receive_from(
+    boost::asio::buffer(m_recv_buffer),
+    m_remote_endpoint,
+    m_strand.wrap([this](boost::system::error_code ec, std::size_t bytes_recvd) {
+      if (ec == boost::asio::error::operation_aborted)
+      {
+        return;
+      }
+      if (ec)
+      {
+        throw runtime_error(ec.message());
+      }
+      m_batch_state->batch.assign(1,
+                                  sick::datastructure::PacketBuffer(m_recv_buffer, bytes_recvd));
+      m_batch_state->batch.back().setReceiveTime(sick::datastructure::PacketBuffer::now());
+      m_packet_batch_handler(m_batch_state->batch);
+      m_batch_state->batch.clear();
+      this->beginBatchReceive();
+    }));
+#endif
+}
+
+void UDPClient::handleBatchReceive(boost::system::error_code ec)
+{
+  if (ec == boost::asio::error::operation_aborted)
+  {
+    // Receiving was stopped, keep the io_service running for other clients sharing it.
+    return;
+  }
+  if (ec)
+  {
+    throw runtime_error(ec.message());
+  }
+
+#ifdef __linux__
+  BatchReceiveState& state      = *m_batch_state;
+  const std::size_t batch_size  = state.ring.size();
+  const std::size_t max_size    = sick::datastructure::PacketBuffer::getMaxSize();
+  const std::size_t control_len = CONTROL_LENGTH;
+
+  int received = 0;
+  do
+  {
+    for (std::size_t i = 0; i < batch_size; i++)
+    {
+      // Buffers still referenced by a consumer are replaced instead of being overwritten.
+      if (state.ring[i].use_count() > 1)
+      {
+        state.ring[i] = std::make_shared<std::vector<uint8_t>>(max_size);
+      }
+      state.iovecs[i].iov_base                = state.ring[i]->data();
+      state.iovecs[i].iov_len                 = max_size;
+      state.headers[i].msg_hdr.msg_name       = nullptr;
+      state.headers[i].msg_hdr.msg_namelen    = 0;
+      state.headers[i].msg_hdr.msg_iov        = &state.iovecs[i];
+      state.headers[i].msg_hdr.msg_iovlen     = 1;
+      state.headers[i].msg_hdr.msg_control    = state.control.data() + i * control_len;
+      state.headers[i].msg_hdr.msg_controllen = control_len;
+      state.headers[i].msg_hdr.msg_flags      = 0;
+      state.headers[i].msg_len                = 0;
+    }
+
+    received = recvmmsg(
+      m_socket.native_handle(), state.headers.data(), batch_size, MSG_DONTWAIT, nullptr);
+    if (received < 0)
+    {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+      {
+        break;
+      }
+      throw runtime_error(strerror(errno));
+    }
+
+    for (int i = 0; i < received; i++)
+    {
+      uint32_t drop_count  = m_kernel_drop_count;
+      int64_t receive_time = 0;
+      readControlMessages(state.headers[i].msg_hdr, drop_count, receive_time);
+      m_kernel_drop_count = drop_count;
+      // The buffers keep their full size, only the received bytes are handed out.
+      state.batch.emplace_back(std::shared_ptr<std::vector<uint8_t> const>(state.ring[i]),
+                               state.headers[i].msg_len);
+      state.batch.back().setReceiveTime(
+        receive_time != 0 ? receive_time : sick::datastructure::PacketBuffer::now());
+    }
+    if (received > 0)
+    {
+      m_packet_batch_handler(state.batch);
+    }
+    state.batch.clear();
+  } while (static_cast<std::size_t>(received) == batch_size);
+
+  beginBatchReceive();
+#endif
+}
+
+uint32_t UDPClient::getKernelDropCount() const
+{
+  return m_kernel_drop_count;
 }
 
 void UDPClient::stop()
@@ -153,7 +437,9 @@ sick::datastructure::PacketBuffer UDPClient::receive(sick::types::time_duration_
   m_socket.async_receive_from(
     boost::asio::buffer(m_recv_buffer),
     m_remote_endpoint,
-    boost::bind(&UDPClient::handleReceiveDeadline, _1, _2, &ec, &bytes_recv));
+    [&ec, &bytes_recv](const boost::system::error_code& error, std::size_t length) {
+      UDPClient::handleReceiveDeadline(error, length, &ec, &bytes_recv);
+    });
 
   // Block until async_receive_from finishes or the deadline_timer exceeds its timeout.
   do
@@ -170,6 +456,7 @@ sick::datastructure::PacketBuffer UDPClient::receive(sick::types::time_duration_
   }
 
   auto buffer = sick::datastructure::PacketBuffer(m_recv_buffer, bytes_recv);
+  buffer.setReceiveTime(getLastReceiveTime());
   return buffer;
 }
 
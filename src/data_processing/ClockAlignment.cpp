@@ -0,0 +1,94 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ClockAlignment.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/ClockAlignment.h"
+
+#include <algorithm>
+
+namespace sick {
+namespace data_processing {
+
+const uint32_t ClockAlignment::DEFAULT_WINDOW_SIZE;
+
+ClockAlignment::ClockAlignment(uint32_t window_size)
+  : m_window_size(std::max<uint32_t>(window_size, 1))
+  , m_window_count(0)
+  , m_is_valid(false)
+  , m_offset(0)
+  , m_window_offset(0)
+{
+}
+
+sick::types::time_point_t
+ClockAlignment::align(const sick::datastructure::DataHeader& data_header,
+                      const sick::types::time_point_t& receive_time)
+{
+  int64_t sensor_time = getSensorTime(data_header);
+  int64_t host_time =
+    std::chrono::duration_cast<std::chrono::microseconds>(receive_time.time_since_epoch()).count();
+  int64_t offset = host_time - sensor_time;
+
+  if (!m_is_valid)
+  {
+    m_is_valid      = true;
+    m_offset        = offset;
+    m_window_offset = offset;
+    m_window_count  = 0;
+  }
+  m_offset        = std::min(m_offset, offset);
+  m_window_offset = std::min(m_window_offset, offset);
+  if (++m_window_count >= m_window_size)
+  {
+    // Adopt the minimum of the last window, which allows the offset to grow with the clock drift.
+    m_offset        = m_window_offset;
+    m_window_offset = offset;
+    m_window_count  = 0;
+  }
+  return sick::types::time_point_t(std::chrono::microseconds(sensor_time + m_offset));
+}
+
+void ClockAlignment::reset()
+{
+  m_is_valid     = false;
+  m_window_count = 0;
+}
+
+int64_t ClockAlignment::getSensorTime(const sick::datastructure::DataHeader& data_header)
+{
+  // Days since the sensor epoch and milliseconds since midnight.
+  const int64_t ms_per_day = 24 * 60 * 60 * 1000;
+  return (data_header.getTimestampDate() * ms_per_day + data_header.getTimestampTime()) * 1000;
+}
+
+} // namespace data_processing
+} // namespace sick
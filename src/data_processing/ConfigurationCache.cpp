@@ -0,0 +1,439 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ConfigurationCache.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/ConfigurationCache.h"
+
+#include "sick_safetyscanners_base/Exceptions.h"
+#include "sick_safetyscanners_base/Logging.h"
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace sick {
+namespace data_processing {
+
+namespace {
+
+const char FILE_MAGIC[4] = {'S', 'S', 'C', 'C'};
+
+/*!
+ * \brief Returns a temporary file name next to the path which is unique across the caches of all
+ * threads and processes, so that concurrent stores never write into the same file.
+ */
+std::string getTempFilePath(const std::string& path)
+{
+  static std::atomic<uint32_t> counter(0);
+#if defined(__unix__) || defined(__APPLE__)
+  long long process = static_cast<long long>(getpid());
+#else
+  long long process =
+    static_cast<long long>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+  return path + "." + std::to_string(process) + "." + std::to_string(counter++) + ".tmp";
+}
+
+class Writer
+{
+public:
+  void writeUint8(uint8_t value) { m_buffer.push_back(value); }
+
+  void writeUint16(uint16_t value)
+  {
+    m_buffer.resize(m_buffer.size() + 2);
+    read_write_helper::writeUint16LittleEndian(m_buffer.end() - 2, value);
+  }
+
+  void writeUint32(uint32_t value)
+  {
+    m_buffer.resize(m_buffer.size() + 4);
+    read_write_helper::writeUint32LittleEndian(m_buffer.end() - 4, value);
+  }
+
+  void writeFloat(float value)
+  {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeUint32(bits);
+  }
+
+  void writeString(const std::string& value)
+  {
+    writeUint32(value.size());
+    m_buffer.insert(m_buffer.end(), value.begin(), value.end());
+  }
+
+  const std::vector<uint8_t>& getBuffer() const { return m_buffer; }
+
+private:
+  std::vector<uint8_t> m_buffer;
+};
+
+// Every read is checked against the end of the buffer, truncated files throw.
+class Reader
+{
+public:
+  explicit Reader(const std::vector<uint8_t>& buffer)
+    : m_cursor(buffer)
+  {
+  }
+
+  uint8_t readUint8()
+  {
+    require(1);
+    return m_cursor.readLittleEndian<uint8_t>();
+  }
+
+  uint16_t readUint16()
+  {
+    require(2);
+    return m_cursor.readLittleEndian<uint16_t>();
+  }
+
+  uint32_t readUint32()
+  {
+    require(4);
+    return m_cursor.readLittleEndian<uint32_t>();
+  }
+
+  float readFloat()
+  {
+    uint32_t bits = readUint32();
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  // The elements have to fit into the remaining data, so that a corrupt count does not allocate.
+  std::size_t readCount(std::size_t element_size)
+  {
+    uint32_t count = readUint32();
+    if (static_cast<uint64_t>(count) * element_size > m_cursor.getRemaining())
+    {
+      throw runtime_error("Configuration cache file has an invalid element count.");
+    }
+    return count;
+  }
+
+  std::string readString()
+  {
+    uint32_t length = readUint32();
+    require(length);
+    std::string value(reinterpret_cast<const char*>(m_cursor.getData()), length);
+    m_cursor.skip(length);
+    return value;
+  }
+
+  bool isAtEnd() const { return m_cursor.getRemaining() == 0; }
+
+private:
+  read_write_helper::ByteCursor m_cursor;
+
+  void require(std::size_t length) const
+  {
+    if (!m_cursor.require(length))
+    {
+      throw runtime_error("Configuration cache file is truncated.");
+    }
+  }
+};
+
+void writeKey(Writer& writer,
+              const sick::datastructure::SerialNumber& serial_number,
+              const sick::datastructure::ConfigMetadata& config_metadata)
+{
+  writer.writeString(serial_number.getSerialNumber());
+  writer.writeUint32(config_metadata.getAppChecksum());
+  writer.writeUint32(config_metadata.getOverallChecksum());
+  std::vector<uint32_t> integrity_hash = config_metadata.getIntegrityHash();
+  writer.writeUint32(integrity_hash.size());
+  for (uint32_t value : integrity_hash)
+  {
+    writer.writeUint32(value);
+  }
+}
+
+void writeFieldData(Writer& writer, const sick::datastructure::FieldData& field)
+{
+  writer.writeUint8(field.getIsValid());
+  writer.writeString(field.getVersionCVersion());
+  writer.writeUint8(field.getVersionMajorVersionNumber());
+  writer.writeUint8(field.getVersionMinorVersionNumber());
+  writer.writeUint8(field.getVersionReleaseNumber());
+  writer.writeUint8(field.getIsDefined());
+  writer.writeUint8(field.getEvalMethod());
+  writer.writeUint16(field.getMultiSampling());
+  writer.writeUint16(field.getObjectResolution());
+  writer.writeUint16(field.getFieldSetIndex());
+  writer.writeUint32(field.getNameLength());
+  writer.writeString(field.getFieldName());
+  writer.writeUint8(field.getIsWarningField());
+  writer.writeUint8(field.getIsProtectiveField());
+  const std::vector<uint16_t>& beam_distances = field.getBeamDistances();
+  writer.writeUint32(beam_distances.size());
+  for (uint16_t distance : beam_distances)
+  {
+    writer.writeUint16(distance);
+  }
+  writer.writeFloat(field.getStartAngle());
+  writer.writeFloat(field.getEndAngle());
+  writer.writeFloat(field.getAngularBeamResolution());
+}
+
+void readFieldData(Reader& reader, sick::datastructure::FieldData& field)
+{
+  field.setIsValid(reader.readUint8() != 0);
+  field.setVersionCVersion(reader.readString());
+  field.setVersionMajorVersionNumber(reader.readUint8());
+  field.setVersionMinorVersionNumber(reader.readUint8());
+  field.setVersionReleaseNumber(reader.readUint8());
+  field.setIsDefined(reader.readUint8() != 0);
+  field.setEvalMethod(reader.readUint8());
+  field.setMultiSampling(reader.readUint16());
+  field.setObjectResolution(reader.readUint16());
+  field.setFieldSetIndex(reader.readUint16());
+  field.setNameLength(reader.readUint32());
+  field.setFieldName(reader.readString());
+  field.setIsWarningField(reader.readUint8() != 0);
+  field.setIsProtectiveField(reader.readUint8() != 0);
+  std::vector<uint16_t> beam_distances(reader.readCount(2));
+  for (uint16_t& distance : beam_distances)
+  {
+    distance = reader.readUint16();
+  }
+  field.setBeamDistances(std::move(beam_distances));
+  field.setStartAngleDegrees(reader.readFloat());
+  field.setEndAngleDegrees(reader.readFloat());
+  field.setAngularBeamResolutionDegrees(reader.readFloat());
+}
+
+void writeMonitoringCase(Writer& writer, const sick::datastructure::MonitoringCaseData& data)
+{
+  writer.writeUint8(data.getIsValid());
+  writer.writeUint16(data.getMonitoringCaseNumber());
+  const std::vector<uint16_t>& field_indices = data.getFieldIndices();
+  writer.writeUint32(field_indices.size());
+  for (uint16_t index : field_indices)
+  {
+    writer.writeUint16(index);
+  }
+  const std::vector<bool>& fields_valid = data.getFieldsValid();
+  writer.writeUint32(fields_valid.size());
+  for (bool valid : fields_valid)
+  {
+    writer.writeUint8(valid);
+  }
+}
+
+void readMonitoringCase(Reader& reader, sick::datastructure::MonitoringCaseData& data)
+{
+  data.setIsValid(reader.readUint8() != 0);
+  data.setMonitoringCaseNumber(reader.readUint16());
+  std::vector<uint16_t> field_indices(reader.readCount(2));
+  for (uint16_t& index : field_indices)
+  {
+    index = reader.readUint16();
+  }
+  data.setFieldIndices(std::move(field_indices));
+  std::vector<bool> fields_valid(reader.readCount(1));
+  for (std::size_t i = 0; i < fields_valid.size(); i++)
+  {
+    fields_valid[i] = reader.readUint8() != 0;
+  }
+  data.setFieldsValid(std::move(fields_valid));
+}
+
+} // namespace
+
+const uint16_t ConfigurationCache::FORMAT_VERSION;
+
+ConfigurationCache::ConfigurationCache(const std::string& directory)
+  : m_directory(directory)
+{
+}
+
+bool ConfigurationCache::load(
+  const sick::datastructure::SerialNumber& serial_number,
+  const sick::datastructure::ConfigMetadata& config_metadata,
+  std::vector<sick::datastructure::FieldData>& field_data,
+  std::vector<sick::datastructure::MonitoringCaseData>& monitoring_cases) const
+{
+  std::ifstream file(getFilePath(serial_number).c_str(), std::ios::binary);
+  if (!file)
+  {
+    return false;
+  }
+  std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+
+  Writer key;
+  writeKey(key, serial_number, config_metadata);
+  const std::vector<uint8_t>& expected_key = key.getBuffer();
+  const std::size_t key_offset             = sizeof(FILE_MAGIC) + 2;
+  if (buffer.size() < key_offset + expected_key.size() ||
+      !std::equal(FILE_MAGIC, FILE_MAGIC + sizeof(FILE_MAGIC), buffer.begin()) ||
+      read_write_helper::readUint16LittleEndian(buffer.begin() + sizeof(FILE_MAGIC)) !=
+        FORMAT_VERSION ||
+      !std::equal(expected_key.begin(), expected_key.end(), buffer.begin() + key_offset))
+  {
+    LOG_INFO("Configuration cache of sensor %s is outdated.",
+             serial_number.getSerialNumber().c_str());
+    return false;
+  }
+
+  try
+  {
+    Reader reader(buffer);
+    reader.readUint32();
+    reader.readUint16();
+    for (std::size_t i = 0; i < expected_key.size(); i++)
+    {
+      reader.readUint8();
+    }
+    std::vector<sick::datastructure::FieldData> fields(reader.readUint16());
+    for (auto& field : fields)
+    {
+      readFieldData(reader, field);
+    }
+    std::vector<sick::datastructure::MonitoringCaseData> cases(reader.readUint16());
+    for (auto& monitoring_case : cases)
+    {
+      readMonitoringCase(reader, monitoring_case);
+    }
+    if (!reader.isAtEnd())
+    {
+      throw runtime_error("Configuration cache file has trailing data.");
+    }
+    field_data.swap(fields);
+    monitoring_cases.swap(cases);
+  }
+  catch (const std::exception& e)
+  {
+    LOG_WARN("Ignoring invalid configuration cache of sensor %s: %s",
+             serial_number.getSerialNumber().c_str(),
+             e.what());
+    return false;
+  }
+  return true;
+}
+
+bool ConfigurationCache::store(
+  const sick::datastructure::SerialNumber& serial_number,
+  const sick::datastructure::ConfigMetadata& config_metadata,
+  const std::vector<sick::datastructure::FieldData>& field_data,
+  const std::vector<sick::datastructure::MonitoringCaseData>& monitoring_cases) const
+{
+  Writer writer;
+  for (char c : FILE_MAGIC)
+  {
+    writer.writeUint8(c);
+  }
+  writer.writeUint16(FORMAT_VERSION);
+  writeKey(writer, serial_number, config_metadata);
+  writer.writeUint16(field_data.size());
+  for (const auto& field : field_data)
+  {
+    writeFieldData(writer, field);
+  }
+  writer.writeUint16(monitoring_cases.size());
+  for (const auto& monitoring_case : monitoring_cases)
+  {
+    writeMonitoringCase(writer, monitoring_case);
+  }
+
+  std::string path      = getFilePath(serial_number);
+  std::string temp_path = getTempFilePath(path);
+  {
+    std::ofstream file(temp_path.c_str(), std::ios::binary | std::ios::trunc);
+    const std::vector<uint8_t>& buffer = writer.getBuffer();
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    // Closing flushes the buffered data, which may fail as well
+    file.close();
+    if (!file)
+    {
+      LOG_WARN("Could not write the configuration cache file %s", temp_path.c_str());
+      std::remove(temp_path.c_str());
+      return false;
+    }
+  }
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0)
+  {
+    LOG_WARN("Could not replace the configuration cache file %s", path.c_str());
+    std::remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+std::string
+ConfigurationCache::getFilePath(const sick::datastructure::SerialNumber& serial_number) const
+{
+  // Only keep characters which are safe in file names on all platforms.
+  std::string name;
+  for (char c : serial_number.getSerialNumber())
+  {
+    if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_')
+    {
+      name.push_back(c);
+    }
+  }
+  if (name.empty())
+  {
+    name = "unknown";
+  }
+  std::string directory = m_directory;
+  if (!directory.empty() && directory.back() != '/')
+  {
+    directory.push_back('/');
+  }
+  return directory + "sick_config_" + name + ".bin";
+}
+
+std::string ConfigurationCache::getDirectory() const
+{
+  return m_directory;
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -0,0 +1,397 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file FieldEvaluator.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/FieldEvaluator.h"
+
+#include "sick_safetyscanners_base/datastructure/ScanPoint.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define SICK_FIELD_EVALUATOR_X86 1
+#  include <immintrin.h>
+#endif
+
+namespace sick {
+namespace data_processing {
+
+namespace {
+
+const int32_t NO_RAW_CLEARANCE = std::numeric_limits<int32_t>::max();
+
+using FieldKernel = int32_t (*)(
+  const uint16_t*, const uint8_t*, const uint16_t*, std::size_t, std::size_t, uint64_t*);
+
+std::size_t popcount(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+  std::size_t count = 0;
+  for (; word != 0; word &= word - 1)
+  {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+// Sets the bits of the intruded beams from begin to end and returns the smallest difference of a
+// measured beam to its threshold, all in units of the distances. Beams without a threshold, without
+// a distance or without the valid bit are skipped. The kernels below give identical results.
+int32_t evaluateBeamsScalar(const uint16_t* distances,
+                            const uint8_t* status_bits,
+                            const uint16_t* thresholds,
+                            std::size_t begin,
+                            std::size_t end,
+                            uint64_t* intrusion_words)
+{
+  int32_t clearance = NO_RAW_CLEARANCE;
+  for (std::size_t i = begin; i < end; i++)
+  {
+    if (thresholds[i] == 0 || distances[i] == 0 ||
+        (status_bits[i] & sick::datastructure::ScanPointStatusBits::VALID) == 0)
+    {
+      continue;
+    }
+    int32_t difference = static_cast<int32_t>(distances[i]) - static_cast<int32_t>(thresholds[i]);
+    if (difference < 0)
+    {
+      intrusion_words[i / 64] |= uint64_t(1) << (i % 64);
+    }
+    clearance = std::min(clearance, difference);
+  }
+  return clearance;
+}
+
+#ifdef SICK_FIELD_EVALUATOR_X86
+#  ifdef __SSE2__
+// Compares 8 beams per iteration. The differences need 32 bits, so each half is widened on its
+// own. SSE2 has no signed minimum of 32 bit integers, it is composed of a compare and a select.
+int32_t evaluateBeamsSSE2(const uint16_t* distances,
+                          const uint8_t* status_bits,
+                          const uint16_t* thresholds,
+                          std::size_t begin,
+                          std::size_t end,
+                          uint64_t* intrusion_words)
+{
+  const __m128i zero         = _mm_setzero_si128();
+  const __m128i valid_bit    = _mm_set1_epi16(sick::datastructure::ScanPointStatusBits::VALID);
+  const __m128i no_clearance = _mm_set1_epi32(NO_RAW_CLEARANCE);
+  __m128i clearance          = no_clearance;
+  std::size_t i              = begin;
+  for (; i + 8 <= end; i += 8)
+  {
+    __m128i distance  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(distances + i));
+    __m128i threshold = _mm_loadu_si128(reinterpret_cast<const __m128i*>(thresholds + i));
+    __m128i status =
+      _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(status_bits + i)), zero);
+    __m128i skipped = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi16(distance, zero), _mm_cmpeq_epi16(threshold, zero)),
+      _mm_cmpeq_epi16(_mm_and_si128(status, valid_bit), zero));
+
+    __m128i differences[2] = {
+      _mm_sub_epi32(_mm_unpacklo_epi16(distance, zero), _mm_unpacklo_epi16(threshold, zero)),
+      _mm_sub_epi32(_mm_unpackhi_epi16(distance, zero), _mm_unpackhi_epi16(threshold, zero))};
+    __m128i skipped_lanes[2] = {_mm_unpacklo_epi16(skipped, skipped),
+                                _mm_unpackhi_epi16(skipped, skipped)};
+    uint64_t bits = 0;
+    for (int half = 0; half < 2; half++)
+    {
+      __m128i intruded =
+        _mm_andnot_si128(skipped_lanes[half], _mm_cmplt_epi32(differences[half], zero));
+      bits |= static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(intruded))) << (4 * half);
+      __m128i candidate = _mm_or_si128(_mm_and_si128(skipped_lanes[half], no_clearance),
+                                       _mm_andnot_si128(skipped_lanes[half], differences[half]));
+      __m128i is_less   = _mm_cmplt_epi32(candidate, clearance);
+      clearance         = _mm_or_si128(_mm_and_si128(is_less, candidate),
+                               _mm_andnot_si128(is_less, clearance));
+    }
+    // Blocks start at multiples of 8 beams, so their bits never cross a word
+    intrusion_words[i / 64] |= bits << (i % 64);
+  }
+  int32_t lanes[4];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), clearance);
+  int32_t result = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+  return std::min(
+    result, evaluateBeamsScalar(distances, status_bits, thresholds, i, end, intrusion_words));
+}
+#  endif // __SSE2__
+
+// Same as the SSE2 kernel on 16 beams per iteration, with a native minimum and select.
+__attribute__((target("avx2"))) int32_t evaluateBeamsAVX2(const uint16_t* distances,
+                                                          const uint8_t* status_bits,
+                                                          const uint16_t* thresholds,
+                                                          std::size_t begin,
+                                                          std::size_t end,
+                                                          uint64_t* intrusion_words)
+{
+  const __m256i zero         = _mm256_setzero_si256();
+  const __m256i valid_bit    = _mm256_set1_epi16(sick::datastructure::ScanPointStatusBits::VALID);
+  const __m256i no_clearance = _mm256_set1_epi32(NO_RAW_CLEARANCE);
+  __m256i clearance          = no_clearance;
+  std::size_t i              = begin;
+  for (; i + 16 <= end; i += 16)
+  {
+    __m256i distance  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(distances + i));
+    __m256i threshold = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(thresholds + i));
+    __m256i status    = _mm256_cvtepu8_epi16(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(status_bits + i)));
+    __m256i skipped = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi16(distance, zero), _mm256_cmpeq_epi16(threshold, zero)),
+      _mm256_cmpeq_epi16(_mm256_and_si256(status, valid_bit), zero));
+
+    uint64_t bits = 0;
+    for (int half = 0; half < 2; half++)
+    {
+      __m128i distance_half =
+        half == 0 ? _mm256_castsi256_si128(distance) : _mm256_extracti128_si256(distance, 1);
+      __m128i threshold_half =
+        half == 0 ? _mm256_castsi256_si128(threshold) : _mm256_extracti128_si256(threshold, 1);
+      __m128i skipped_half =
+        half == 0 ? _mm256_castsi256_si128(skipped) : _mm256_extracti128_si256(skipped, 1);
+      __m256i difference   = _mm256_sub_epi32(_mm256_cvtepu16_epi32(distance_half),
+                                            _mm256_cvtepu16_epi32(threshold_half));
+      __m256i skipped_lanes = _mm256_cvtepi16_epi32(skipped_half);
+      __m256i intruded = _mm256_andnot_si256(skipped_lanes, _mm256_cmpgt_epi32(zero, difference));
+      bits |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(intruded)))
+              << (8 * half);
+      clearance = _mm256_min_epi32(clearance,
+                                   _mm256_blendv_epi8(difference, no_clearance, skipped_lanes));
+    }
+    // Blocks start at multiples of 16 beams, so their bits never cross a word
+    intrusion_words[i / 64] |= bits << (i % 64);
+  }
+  __m128i lanes = _mm_min_epi32(_mm256_castsi256_si128(clearance),
+                                _mm256_extracti128_si256(clearance, 1));
+  lanes         = _mm_min_epi32(lanes, _mm_shuffle_epi32(lanes, _MM_SHUFFLE(1, 0, 3, 2)));
+  lanes         = _mm_min_epi32(lanes, _mm_shuffle_epi32(lanes, _MM_SHUFFLE(2, 3, 0, 1)));
+  int32_t result = _mm_cvtsi128_si32(lanes);
+  return std::min(
+    result, evaluateBeamsScalar(distances, status_bits, thresholds, i, end, intrusion_words));
+}
+#endif // SICK_FIELD_EVALUATOR_X86
+
+FieldKernel getFieldKernel(SimdKernel kernel)
+{
+  switch (kernel)
+  {
+#ifdef SICK_FIELD_EVALUATOR_X86
+    case SimdKernel::AVX2:
+      return evaluateBeamsAVX2;
+#  ifdef __SSE2__
+    case SimdKernel::SSE2:
+      return evaluateBeamsSSE2;
+#  endif
+#endif
+    default:
+      return evaluateBeamsScalar;
+  }
+}
+
+} // namespace
+
+const int32_t FieldEvaluator::NO_CLEARANCE = std::numeric_limits<int32_t>::max();
+
+FieldEvaluator::FieldEvaluator()
+  : m_kernel(getBestSimdKernel())
+  , m_has_grid(false)
+  , m_multiplication_factor(0)
+{
+}
+
+FieldEvaluator::FieldEvaluator(const std::vector<sick::datastructure::FieldData>& fields)
+  : FieldEvaluator()
+{
+  setFields(fields);
+}
+
+void FieldEvaluator::setFields(const std::vector<sick::datastructure::FieldData>& fields)
+{
+  m_fields.clear();
+  m_fields.reserve(fields.size());
+  for (const sick::datastructure::FieldData& field : fields)
+  {
+    // The remaining members of a field are only set if it is valid
+    FieldContour contour;
+    bool is_defined                 = field.getIsValid() && field.getIsDefined();
+    contour.is_protective_field     = is_defined && field.getIsProtectiveField();
+    contour.is_warning_field        = is_defined && field.getIsWarningField();
+    contour.start_angle             = is_defined ? field.getStartAngle() : 0.0f;
+    contour.angular_beam_resolution = is_defined ? field.getAngularBeamResolution() : 0.0f;
+    if (is_defined)
+    {
+      contour.beam_distances = field.getBeamDistances();
+    }
+    m_fields.push_back(std::move(contour));
+  }
+  m_has_grid = false;
+}
+
+std::size_t FieldEvaluator::getNumberOfFields() const
+{
+  return m_fields.size();
+}
+
+SimdKernel FieldEvaluator::getKernel() const
+{
+  return m_kernel;
+}
+
+void FieldEvaluator::setKernel(SimdKernel kernel)
+{
+  m_kernel = isSimdKernelSupported(kernel) ? kernel : SimdKernel::SCALAR;
+}
+
+bool FieldEvaluator::evaluate(const sick::datastructure::Data& data,
+                              std::vector<FieldEvaluation>& evaluations)
+{
+  std::shared_ptr<sick::datastructure::DerivedValues> derived_values = data.getDerivedValuesPtr();
+  std::shared_ptr<sick::datastructure::MeasurementData> measurement_data =
+    data.getMeasurementDataPtr();
+  if (!derived_values || derived_values->isEmpty() || !measurement_data ||
+      measurement_data->isEmpty())
+  {
+    return false;
+  }
+  evaluate(*measurement_data, derived_values->getMultiplicationFactor(), evaluations);
+  return true;
+}
+
+void FieldEvaluator::evaluate(const sick::datastructure::MeasurementData& measurement_data,
+                              uint16_t multiplication_factor,
+                              std::vector<FieldEvaluation>& evaluations)
+{
+  // A factor of zero would make every threshold unreachable
+  uint16_t factor     = std::max<uint16_t>(multiplication_factor, 1);
+  TrigTable::Key grid = TrigTable::makeKey(measurement_data);
+  if (!m_has_grid || !(m_grid == grid) || m_multiplication_factor != factor)
+  {
+    updateThresholds(grid, factor);
+  }
+  Span<const uint16_t> distances  = measurement_data.getDistances();
+  Span<const uint8_t> status_bits = measurement_data.getStatusBits();
+  std::size_t number_of_beams     = std::min<std::size_t>(
+    std::min(distances.size(), status_bits.size()), m_grid.number_of_beams);
+  std::size_t number_of_words = (number_of_beams + 63) / 64;
+  FieldKernel kernel          = getFieldKernel(m_kernel);
+
+  evaluations.resize(m_fields.size());
+  for (std::size_t field = 0; field < m_fields.size(); field++)
+  {
+    FieldEvaluation& evaluation    = evaluations[field];
+    evaluation.is_protective_field = m_fields[field].is_protective_field;
+    evaluation.is_warning_field    = m_fields[field].is_warning_field;
+    evaluation.intrusion_words.assign(number_of_words, 0);
+    int32_t clearance = kernel(distances.data(),
+                               status_bits.data(),
+                               getThresholds(field).data(),
+                               0,
+                               number_of_beams,
+                               evaluation.intrusion_words.data());
+
+    std::size_t number_of_intruded_beams = 0;
+    for (uint64_t word : evaluation.intrusion_words)
+    {
+      number_of_intruded_beams += popcount(word);
+    }
+    evaluation.number_of_intruded_beams = static_cast<uint32_t>(number_of_intruded_beams);
+    if (clearance == NO_RAW_CLEARANCE)
+    {
+      evaluation.min_clearance = NO_CLEARANCE;
+    }
+    else
+    {
+      // Kept below NO_CLEARANCE for unusually large multiplication factors
+      int64_t millimeters      = static_cast<int64_t>(clearance) * m_multiplication_factor;
+      evaluation.min_clearance = static_cast<int32_t>(std::max<int64_t>(
+        std::min<int64_t>(millimeters, NO_CLEARANCE - 1), -static_cast<int64_t>(NO_CLEARANCE)));
+    }
+  }
+}
+
+Span<const uint16_t> FieldEvaluator::getThresholds(std::size_t field) const
+{
+  if (!m_has_grid || field >= m_fields.size())
+  {
+    return Span<const uint16_t>();
+  }
+  return Span<const uint16_t>(m_thresholds.data() + field * m_grid.number_of_beams,
+                              m_grid.number_of_beams);
+}
+
+void FieldEvaluator::updateThresholds(const TrigTable::Key& grid, uint16_t multiplication_factor)
+{
+  m_grid                  = grid;
+  m_multiplication_factor = multiplication_factor;
+  m_has_grid              = true;
+  m_thresholds.assign(m_fields.size() * grid.number_of_beams, 0);
+  for (std::size_t field = 0; field < m_fields.size(); field++)
+  {
+    resampleField(m_fields[field], m_thresholds.data() + field * grid.number_of_beams);
+  }
+}
+
+void FieldEvaluator::resampleField(const FieldContour& field, uint16_t* thresholds) const
+{
+  const std::vector<uint16_t>& beam_distances = field.beam_distances;
+  if (beam_distances.empty() || !(field.angular_beam_resolution > 0.0f))
+  {
+    return;
+  }
+  double last_position = static_cast<double>(beam_distances.size() - 1);
+  for (uint32_t i = 0; i < m_grid.number_of_beams; i++)
+  {
+    // Same angle as sick::datastructure::MeasurementData::getAngle()
+    float angle     = m_grid.start_angle + static_cast<float>(i) * m_grid.angular_beam_resolution;
+    double position = static_cast<double>(angle - field.start_angle) /
+                      static_cast<double>(field.angular_beam_resolution);
+    if (position < -0.5 || position > last_position + 0.5)
+    {
+      continue;
+    }
+    // Between two points of the contour the farther one is taken, so the field never shrinks
+    std::size_t lower    = static_cast<std::size_t>(std::max(std::floor(position), 0.0));
+    std::size_t upper    = static_cast<std::size_t>(std::min(std::ceil(position), last_position));
+    uint32_t millimeters = std::max(beam_distances[lower], beam_distances[upper]);
+    // A beam is within the field if distance * multiplication factor < millimeters
+    uint32_t units = (millimeters + m_multiplication_factor - 1) / m_multiplication_factor;
+    thresholds[i]  = static_cast<uint16_t>(std::min<uint32_t>(units, 0xFFFF));
+  }
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -0,0 +1,181 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file IncrementalMeasurementDecoder.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/IncrementalMeasurementDecoder.h"
+
+namespace sick {
+namespace data_processing {
+
+IncrementalMeasurementDecoder::IncrementalMeasurementDecoder()
+  : m_state(IDLE)
+  , m_identification(0)
+  , m_packet(nullptr)
+  , m_beams_offset(0)
+  , m_number_of_beams(0)
+  , m_decoded_beams(0)
+{
+  m_data.setDataHeaderPtr(std::make_shared<sick::datastructure::DataHeader>());
+  m_data.setDerivedValuesPtr(std::make_shared<sick::datastructure::DerivedValues>());
+}
+
+void IncrementalMeasurementDecoder::update(const datastructure::PacketBuffer& buffer,
+                                           const datastructure::PacketProgress& progress)
+{
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
+  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
+  if (m_state == IDLE || progress.identification != m_identification ||
+      vec_ptr->data() != m_packet)
+  {
+    startPacket(progress.identification, vec_ptr->data());
+  }
+  // Fragments behind a missing one are decoded once the gap is filled
+  uint32_t received_length = progress.received_length;
+  if (received_length > buffer.getLength())
+  {
+    received_length = static_cast<uint32_t>(buffer.getLength());
+  }
+  decodeHeaders(buffer, received_length);
+  if (m_state == DECODING_BEAMS)
+  {
+    decodeBeams(vec_ptr->data(), received_length);
+  }
+}
+
+void IncrementalMeasurementDecoder::reset()
+{
+  m_state  = IDLE;
+  m_packet = nullptr;
+}
+
+bool IncrementalMeasurementDecoder::takeMeasurementData(
+  const datastructure::PacketBuffer& buffer,
+  std::shared_ptr<sick::datastructure::MeasurementData>& measurement_data)
+{
+  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
+  if (m_state != COMPLETE || vec_ptr->data() != m_packet)
+  {
+    return false;
+  }
+  measurement_data.swap(m_measurement_data);
+  reset();
+  return true;
+}
+
+void IncrementalMeasurementDecoder::startPacket(uint32_t identification, const uint8_t* packet)
+{
+  m_state           = WAITING_FOR_DATA_HEADER;
+  m_identification  = identification;
+  m_packet          = packet;
+  m_beams_offset    = 0;
+  m_number_of_beams = 0;
+  m_decoded_beams   = 0;
+  // The block handed out with a previous scan is reused once that scan released it
+  if (!m_measurement_data || m_measurement_data.use_count() != 1)
+  {
+    m_measurement_data = std::make_shared<sick::datastructure::MeasurementData>();
+  }
+}
+
+void IncrementalMeasurementDecoder::decodeHeaders(const datastructure::PacketBuffer& buffer,
+                                                  uint32_t received_length)
+{
+  if (m_state == WAITING_FOR_DATA_HEADER)
+  {
+    if (received_length < sick::datastructure::DataHeader::HEADER_SIZE)
+    {
+      return;
+    }
+    *m_data.getDataHeaderPtr() = m_data_header_parser.parseUDPSequence(buffer, m_data);
+    m_state                    = WAITING_FOR_DERIVED_VALUES;
+  }
+  const sick::datastructure::DataHeader& data_header = *m_data.getDataHeaderPtr();
+  if (m_state == WAITING_FOR_DERIVED_VALUES)
+  {
+    if (received_length < static_cast<uint32_t>(data_header.getDerivedValuesBlockOffset()) +
+                            data_header.getDerivedValuesBlockSize())
+    {
+      return;
+    }
+    m_derived_values_parser.parseUDPSequence(buffer, m_data, *m_data.getDerivedValuesPtr());
+    m_state = WAITING_FOR_NUMBER_OF_BEAMS;
+  }
+  if (m_state == WAITING_FOR_NUMBER_OF_BEAMS)
+  {
+    // The measurement data block begins with the number of beams
+    if (received_length <
+        static_cast<uint32_t>(data_header.getMeasurementDataBlockOffset()) + sizeof(uint32_t))
+    {
+      return;
+    }
+    m_beams_offset =
+      m_measurement_data_parser.beginUDPSequence(buffer, m_data, *m_measurement_data);
+    if (m_beams_offset == 0)
+    {
+      m_state = NOT_DECODABLE;
+      return;
+    }
+    m_number_of_beams = m_measurement_data->getNumberOfBeams();
+    m_state           = DECODING_BEAMS;
+  }
+}
+
+void IncrementalMeasurementDecoder::decodeBeams(const uint8_t* packet, uint32_t received_length)
+{
+  uint32_t received_beams = 0;
+  if (received_length > m_beams_offset)
+  {
+    received_beams = static_cast<uint32_t>((received_length - m_beams_offset) /
+                                           ParseMeasurementData::BEAM_RECORD_SIZE);
+  }
+  if (received_beams > m_number_of_beams)
+  {
+    received_beams = m_number_of_beams;
+  }
+  if (received_beams > m_decoded_beams)
+  {
+    ParseMeasurementData::decodeBeams(
+      packet + m_beams_offset + m_decoded_beams * ParseMeasurementData::BEAM_RECORD_SIZE,
+      received_beams - m_decoded_beams,
+      m_measurement_data->getDistances().data() + m_decoded_beams,
+      m_measurement_data->getReflectivities().data() + m_decoded_beams,
+      m_measurement_data->getStatusBits().data() + m_decoded_beams);
+    m_decoded_beams = received_beams;
+  }
+  if (m_decoded_beams == m_number_of_beams)
+  {
+    m_state = COMPLETE;
+  }
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -0,0 +1,60 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file LatencyRecorder.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/LatencyRecorder.h"
+
+namespace sick {
+namespace data_processing {
+
+sick::datastructure::LatencyStatistics LatencyRecorder::getStatistics() const
+{
+  sick::datastructure::LatencyStatistics statistics;
+  statistics.socket     = m_histograms[SOCKET].getSummary();
+  statistics.reassembly = m_histograms[REASSEMBLY].getSummary();
+  statistics.parsing    = m_histograms[PARSING].getSummary();
+  statistics.delivery   = m_histograms[DELIVERY].getSummary();
+  statistics.callback   = m_histograms[CALLBACK].getSummary();
+  statistics.total      = m_histograms[TOTAL].getSummary();
+  return statistics;
+}
+
+void LatencyRecorder::reset()
+{
+  for (auto& histogram : m_histograms)
+  {
+    histogram.reset();
+  }
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -46,9 +46,9 @@ bool ParseApplicationNameData::parseTCPSequence(
   const datastructure::PacketBuffer& buffer,
   sick::datastructure::ApplicationName& application_name) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  const uint8_t* data_ptr                                   = vec_ptr->data();
   application_name.setVersionCVersion(readVersionIndicator(data_ptr));
   application_name.setVersionMajorVersionNumber(readMajorNumber(data_ptr));
   application_name.setVersionMinorVersionNumber(readMinorNumber(data_ptr));
@@ -58,41 +58,35 @@ bool ParseApplicationNameData::parseTCPSequence(
   return true;
 }
 
-std::string
-ParseApplicationNameData::readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseApplicationNameData::readVersionIndicator(const uint8_t* data_ptr) const
 {
   std::string result;
   result.push_back(read_write_helper::readUint8(data_ptr + 0));
   return result;
 }
 
-uint8_t
-ParseApplicationNameData::readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseApplicationNameData::readMajorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 1);
 }
 
-uint8_t
-ParseApplicationNameData::readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseApplicationNameData::readMinorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 2);
 }
 
-uint8_t
-ParseApplicationNameData::readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseApplicationNameData::readReleaseNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 3);
 }
 
-uint32_t
-ParseApplicationNameData::readNameLength(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseApplicationNameData::readNameLength(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 4);
 }
 
 
-std::string
-ParseApplicationNameData::readApplicationName(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseApplicationNameData::readApplicationName(const uint8_t* data_ptr) const
 {
   uint32_t name_length = read_write_helper::readUint32LittleEndian(data_ptr + 4);
   std::string name;
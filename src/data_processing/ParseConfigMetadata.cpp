@@ -46,9 +46,9 @@ bool ParseConfigMetadata::parseTCPSequence(
   const datastructure::PacketBuffer& buffer,
   sick::datastructure::ConfigMetadata& config_metadata) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  const uint8_t* data_ptr                                   = vec_ptr->data();
   config_metadata.setVersionCVersion(readVersionIndicator(data_ptr));
   config_metadata.setVersionMajorVersionNumber(readMajorNumber(data_ptr));
   config_metadata.setVersionMinorVersionNumber(readMinorNumber(data_ptr));
@@ -63,66 +63,59 @@ bool ParseConfigMetadata::parseTCPSequence(
   return true;
 }
 
-std::string
-ParseConfigMetadata::readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseConfigMetadata::readVersionIndicator(const uint8_t* data_ptr) const
 {
   std::string result;
   result.push_back(read_write_helper::readUint8(data_ptr + 0));
   return result;
 }
 
-uint8_t ParseConfigMetadata::readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseConfigMetadata::readMajorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 1);
 }
 
-uint8_t ParseConfigMetadata::readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseConfigMetadata::readMinorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 2);
 }
 
-uint8_t ParseConfigMetadata::readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseConfigMetadata::readReleaseNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 3);
 }
 
-uint16_t
-ParseConfigMetadata::readModificationTimeDate(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseConfigMetadata::readModificationTimeDate(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 4);
 }
 
-uint32_t
-ParseConfigMetadata::readModificationTimeTime(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseConfigMetadata::readModificationTimeTime(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 8);
 }
 
-uint16_t
-ParseConfigMetadata::readTransferTimeDate(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseConfigMetadata::readTransferTimeDate(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 12);
 }
 
-uint32_t
-ParseConfigMetadata::readTransferTimeTime(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseConfigMetadata::readTransferTimeTime(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 16);
 }
 
-uint32_t ParseConfigMetadata::readAppChecksum(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseConfigMetadata::readAppChecksum(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 36);
 }
 
-uint32_t
-ParseConfigMetadata::readOverallChecksum(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseConfigMetadata::readOverallChecksum(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 52);
 }
 
-std::vector<uint32_t>
-ParseConfigMetadata::readIntegrityHash(std::vector<uint8_t>::const_iterator data_ptr) const
+std::vector<uint32_t> ParseConfigMetadata::readIntegrityHash(const uint8_t* data_ptr) const
 {
   std::vector<uint32_t> result;
   for (uint8_t i = 0; i < 4; i++)
@@ -37,36 +37,146 @@
 namespace sick {
 namespace data_processing {
 
-ParseData::ParseData()
+namespace {
+
+/*!
+ * \brief Keeps a block of a recycled data instance for parsing if it is referenced by nobody else.
+ * Otherwise a new block is created, since the old one is still in use.
+ */
+template <typename BlockT>
+void recycleBlock(std::shared_ptr<BlockT>& block)
+{
+  if (!block || block.use_count() != 1)
+  {
+    block = std::make_shared<BlockT>();
+  }
+}
+
+} // namespace
+
+struct ParseData::Parsers
+{
+  Parsers();
+
+  bool has_beam_region;
+  BeamRegion beam_region;
+  std::shared_ptr<sick::data_processing::ParseDataHeader> data_header_parser_ptr;
+  std::shared_ptr<sick::data_processing::ParseDerivedValues> derived_values_parser_ptr;
+  std::shared_ptr<sick::data_processing::ParseMeasurementData> measurement_data_parser_ptr;
+  std::shared_ptr<sick::data_processing::ParseGeneralSystemState> general_system_state_parser_ptr;
+  std::shared_ptr<sick::data_processing::ParseApplicationData> application_data_parser_ptr;
+
+  void setDataHeaderInData(const datastructure::PacketBuffer& buffer,
+                           datastructure::Data& data) const;
+  void setDerivedValuesInData(const datastructure::PacketBuffer& buffer,
+                              datastructure::Data& data) const;
+  void setMeasurementDataInData(const datastructure::PacketBuffer& buffer,
+                                datastructure::Data& data) const;
+  void setGeneralSystemStateInData(const datastructure::PacketBuffer& buffer,
+                                   datastructure::Data& data) const;
+  void setIntrusionDataInData(const datastructure::PacketBuffer& buffer,
+                              datastructure::Data& data) const;
+  void setApplicationDataInData(const datastructure::PacketBuffer& buffer,
+                                datastructure::Data& data) const;
+  void setBlockInData(uint16_t block,
+                      const datastructure::PacketBuffer& buffer,
+                      datastructure::Data& data) const;
+};
+
+ParseData::Parsers::Parsers()
+  : has_beam_region(false)
+  , beam_region()
 {
-  m_data_header_parser_ptr      = std::make_shared<sick::data_processing::ParseDataHeader>();
-  m_derived_values_parser_ptr   = std::make_shared<sick::data_processing::ParseDerivedValues>();
-  m_measurement_data_parser_ptr = std::make_shared<sick::data_processing::ParseMeasurementData>();
-  m_general_system_state_parser_ptr =
+  data_header_parser_ptr      = std::make_shared<sick::data_processing::ParseDataHeader>();
+  derived_values_parser_ptr   = std::make_shared<sick::data_processing::ParseDerivedValues>();
+  measurement_data_parser_ptr = std::make_shared<sick::data_processing::ParseMeasurementData>();
+  general_system_state_parser_ptr =
     std::make_shared<sick::data_processing::ParseGeneralSystemState>();
-  m_intrusion_data_parser_ptr   = std::make_shared<sick::data_processing::ParseIntrusionData>();
-  m_application_data_parser_ptr = std::make_shared<sick::data_processing::ParseApplicationData>();
+  application_data_parser_ptr = std::make_shared<sick::data_processing::ParseApplicationData>();
+}
+
+ParseData::ParseData()
+  : ParseData(sick::SensorDataFeatures::ALL)
+{
+}
+
+ParseData::ParseData(sick::types::SensorFeatures parse_features)
+  : m_parse_features(parse_features)
+  , m_parsers(std::make_shared<Parsers>())
+{
+}
+
+void ParseData::setParseFeatures(sick::types::SensorFeatures parse_features)
+{
+  m_parse_features = parse_features;
+}
+
+sick::types::SensorFeatures ParseData::getParseFeatures() const
+{
+  return m_parse_features;
+}
+
+void ParseData::setBeamRegion(const BeamRegion& region)
+{
+  // Loaders of already parsed instances keep the previous state
+  std::shared_ptr<Parsers> parsers = std::make_shared<Parsers>(*m_parsers);
+  parsers->has_beam_region         = true;
+  parsers->beam_region             = region;
+  m_parsers                        = parsers;
+}
+
+void ParseData::clearBeamRegion()
+{
+  std::shared_ptr<Parsers> parsers = std::make_shared<Parsers>(*m_parsers);
+  parsers->has_beam_region         = false;
+  parsers->beam_region             = BeamRegion();
+  m_parsers                        = parsers;
+}
+
+bool ParseData::hasBeamRegion() const
+{
+  return m_parsers->has_beam_region;
+}
+
+BeamRegion ParseData::getBeamRegion() const
+{
+  return m_parsers->beam_region;
 }
 
 sick::datastructure::Data
 ParseData::parseUDPSequence(const datastructure::PacketBuffer& buffer) const
 {
   sick::datastructure::Data data;
-  setDataBlocksInData(buffer, data);
+  setDataBlocksInData(buffer, data, nullptr);
   return data;
 }
 
+void ParseData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                                 sick::datastructure::Data& data) const
+{
+  setDataBlocksInData(buffer, data, nullptr);
+}
+
+void ParseData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                                 sick::datastructure::Data& data,
+                                 IncrementalMeasurementDecoder& decoder) const
+{
+  setDataBlocksInData(buffer, data, &decoder);
+}
+
 bool ParseData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                  sick::datastructure::Data& data) const
 {
-  setDataBlocksInData(buffer, data);
+  setDataBlocksInData(buffer, data, nullptr);
   return true;
 }
 
 void ParseData::setDataBlocksInData(const datastructure::PacketBuffer& buffer,
-                                    datastructure::Data& data) const
+                                    datastructure::Data& data,
+                                    IncrementalMeasurementDecoder* decoder) const
 {
-  setDataHeaderInData(buffer, data);
+  data.setReceiveTime(buffer.getReceiveTime());
+  m_parsers->setDataHeaderInData(buffer, data);
 
   auto dataHeadPtr = data.getDataHeaderPtr();
   uint32_t expected_size =
@@ -95,63 +205,160 @@ void ParseData::setDataBlocksInData(const datastructure::PacketBuffer& buffer,
     dataHeadPtr->setApplicationDataBlockOffset(0);
   }
 
+  // Deferred blocks keep the buffer alive until the data is destroyed. They have to be registered
+  // before parsing, since the measurement and intrusion data access the derived values.
+  uint16_t lazy_blocks = sick::SensorDataFeatures::ALL & ~m_parse_features;
+  if (lazy_blocks != 0)
+  {
+    std::shared_ptr<const Parsers> parsers = m_parsers;
+    data.setLazyBlocks(lazy_blocks,
+                       [parsers, buffer](uint16_t block, datastructure::Data& lazy_data) {
+                         parsers->setBlockInData(block, buffer, lazy_data);
+                       });
+  }
+  else
+  {
+    // A recycled instance might still defer blocks of the previous scan.
+    data.setLazyBlocks(0, datastructure::Data::BlockLoader());
+  }
 
-  setDerivedValuesInData(buffer, data);
-  setMeasurementDataInData(buffer, data);
-  setGeneralSystemStateInData(buffer, data);
-  setIntrusionDataInData(buffer, data);
-  setApplicationDataInData(buffer, data);
+  const uint16_t blocks[] = {sick::SensorDataFeatures::DERIVED_SETTINGS,
+                             sick::SensorDataFeatures::MEASUREMENT_DATA,
+                             sick::SensorDataFeatures::GENERAL_SYSTEM_STATE,
+                             sick::SensorDataFeatures::INTRUSION_DATA,
+                             sick::SensorDataFeatures::APPLICATION_DATA};
+  for (uint16_t block : blocks)
+  {
+    if (sick::SensorDataFeatures::isFlagSet(m_parse_features, block))
+    {
+      // The decoder always decodes all beams
+      if (block == sick::SensorDataFeatures::MEASUREMENT_DATA && decoder != nullptr &&
+          !m_parsers->has_beam_region && takeDecodedMeasurementData(buffer, data, *decoder))
+      {
+        continue;
+      }
+      m_parsers->setBlockInData(block, buffer, data);
+    }
+  }
 }
 
-void ParseData::setDataHeaderInData(const datastructure::PacketBuffer& buffer,
+void ParseData::Parsers::setBlockInData(uint16_t block,
+                               const datastructure::PacketBuffer& buffer,
+                               datastructure::Data& data) const
+{
+  switch (block)
+  {
+    case sick::SensorDataFeatures::DERIVED_SETTINGS:
+      setDerivedValuesInData(buffer, data);
+      break;
+    case sick::SensorDataFeatures::MEASUREMENT_DATA:
+      setMeasurementDataInData(buffer, data);
+      break;
+    case sick::SensorDataFeatures::GENERAL_SYSTEM_STATE:
+      setGeneralSystemStateInData(buffer, data);
+      break;
+    case sick::SensorDataFeatures::INTRUSION_DATA:
+      setIntrusionDataInData(buffer, data);
+      break;
+    case sick::SensorDataFeatures::APPLICATION_DATA:
+      setApplicationDataInData(buffer, data);
+      break;
+    default:
+      break;
+  }
+}
+
+void ParseData::Parsers::setDataHeaderInData(const datastructure::PacketBuffer& buffer,
                                     datastructure::Data& data) const
 {
-  sick::datastructure::DataHeader data_header =
-    m_data_header_parser_ptr->parseUDPSequence(buffer, data);
-  data.setDataHeaderPtr(std::make_shared<sick::datastructure::DataHeader>(data_header));
+  std::shared_ptr<sick::datastructure::DataHeader> data_header = data.getDataHeaderPtr();
+  data.setDataHeaderPtr(nullptr);
+  recycleBlock(data_header);
+  *data_header = data_header_parser_ptr->parseUDPSequence(buffer, data);
+  data.setDataHeaderPtr(data_header);
 }
 
-void ParseData::setDerivedValuesInData(const datastructure::PacketBuffer& buffer,
+void ParseData::Parsers::setDerivedValuesInData(const datastructure::PacketBuffer& buffer,
                                        datastructure::Data& data) const
 {
-  sick::datastructure::DerivedValues derived_values =
-    m_derived_values_parser_ptr->parseUDPSequence(buffer, data);
-  data.setDerivedValuesPtr(std::make_shared<sick::datastructure::DerivedValues>(derived_values));
+  std::shared_ptr<sick::datastructure::DerivedValues> derived_values = data.getDerivedValuesPtr();
+  data.setDerivedValuesPtr(nullptr);
+  recycleBlock(derived_values);
+  derived_values_parser_ptr->parseUDPSequence(buffer, data, *derived_values);
+  data.setDerivedValuesPtr(derived_values);
 }
 
-void ParseData::setMeasurementDataInData(const datastructure::PacketBuffer& buffer,
+void ParseData::Parsers::setMeasurementDataInData(const datastructure::PacketBuffer& buffer,
                                          datastructure::Data& data) const
 {
-  sick::datastructure::MeasurementData measurement_data =
-    m_measurement_data_parser_ptr->parseUDPSequence(buffer, data);
-  data.setMeasurementDataPtr(
-    std::make_shared<sick::datastructure::MeasurementData>(measurement_data));
+  std::shared_ptr<sick::datastructure::MeasurementData> measurement_data =
+    data.getMeasurementDataPtr();
+  data.setMeasurementDataPtr(nullptr);
+  recycleBlock(measurement_data);
+  if (has_beam_region)
+  {
+    measurement_data_parser_ptr->parseUDPSequence(buffer, data, beam_region, *measurement_data);
+  }
+  else
+  {
+    measurement_data_parser_ptr->parseUDPSequence(buffer, data, *measurement_data);
+  }
+  data.setMeasurementDataPtr(measurement_data);
+}
+
+bool ParseData::takeDecodedMeasurementData(const datastructure::PacketBuffer& buffer,
+                                           datastructure::Data& data,
+                                           IncrementalMeasurementDecoder& decoder) const
+{
+  // The size check above unpublishes all blocks of an inconsistent data packet
+  if (data.getDataHeaderPtr()->getMeasurementDataBlockOffset() == 0 &&
+      data.getDataHeaderPtr()->getMeasurementDataBlockSize() == 0)
+  {
+    return false;
+  }
+  // The previous block of the instance goes to the decoder, which recycles it for later packets
+  std::shared_ptr<sick::datastructure::MeasurementData> measurement_data =
+    data.getMeasurementDataPtr();
+  if (!decoder.takeMeasurementData(buffer, measurement_data))
+  {
+    return false;
+  }
+  data.setMeasurementDataPtr(measurement_data);
+  return true;
 }
 
-void ParseData::setGeneralSystemStateInData(const datastructure::PacketBuffer& buffer,
+void ParseData::Parsers::setGeneralSystemStateInData(const datastructure::PacketBuffer& buffer,
                                             datastructure::Data& data) const
 {
-  sick::datastructure::GeneralSystemState general_system_state =
-    m_general_system_state_parser_ptr->parseUDPSequence(buffer, data);
-  data.setGeneralSystemStatePtr(
-    std::make_shared<sick::datastructure::GeneralSystemState>(general_system_state));
+  std::shared_ptr<sick::datastructure::GeneralSystemState> general_system_state =
+    data.getGeneralSystemStatePtr();
+  data.setGeneralSystemStatePtr(nullptr);
+  recycleBlock(general_system_state);
+  general_system_state_parser_ptr->parseUDPSequence(buffer, data, *general_system_state);
+  data.setGeneralSystemStatePtr(general_system_state);
 }
 
-void ParseData::setIntrusionDataInData(const datastructure::PacketBuffer& buffer,
+void ParseData::Parsers::setIntrusionDataInData(const datastructure::PacketBuffer& buffer,
                                        datastructure::Data& data) const
 {
-  sick::datastructure::IntrusionData intrusion_data =
-    m_intrusion_data_parser_ptr->parseUDPSequence(buffer, data);
-  data.setIntrusionDataPtr(std::make_shared<sick::datastructure::IntrusionData>(intrusion_data));
+  std::shared_ptr<sick::datastructure::IntrusionData> intrusion_data = data.getIntrusionDataPtr();
+  data.setIntrusionDataPtr(nullptr);
+  recycleBlock(intrusion_data);
+  // The intrusion data parser keeps the number of beams, so it is not shared between threads
+  sick::data_processing::ParseIntrusionData intrusion_data_parser;
+  intrusion_data_parser.parseUDPSequence(buffer, data, *intrusion_data);
+  data.setIntrusionDataPtr(intrusion_data);
 }
 
-void ParseData::setApplicationDataInData(const datastructure::PacketBuffer& buffer,
+void ParseData::Parsers::setApplicationDataInData(const datastructure::PacketBuffer& buffer,
                                          datastructure::Data& data) const
 {
-  sick::datastructure::ApplicationData application_data =
-    m_application_data_parser_ptr->parseUDPSequence(buffer, data);
-  data.setApplicationDataPtr(
-    std::make_shared<sick::datastructure::ApplicationData>(application_data));
+  std::shared_ptr<sick::datastructure::ApplicationData> application_data =
+    data.getApplicationDataPtr();
+  data.setApplicationDataPtr(nullptr);
+  recycleBlock(application_data);
+  application_data_parser_ptr->parseUDPSequence(buffer, data, *application_data);
+  data.setApplicationDataPtr(application_data);
 }
 
 } // namespace data_processing
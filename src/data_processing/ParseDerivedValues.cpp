@@ -34,9 +34,28 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseDerivedValues.h"
 
+#include "sick_safetyscanners_base/data_processing/BlockLayout.hpp"
+
 namespace sick {
 namespace data_processing {
 
+namespace {
+
+using datastructure::DerivedValues;
+
+typedef block_layout::Layout<SICK_LAYOUT_FIELD(0, DerivedValues::setMultiplicationFactor),
+                             SICK_LAYOUT_FIELD(2, DerivedValues::setNumberOfBeams),
+                             SICK_LAYOUT_FIELD(4, DerivedValues::setScanTime),
+                             SICK_LAYOUT_FIELD(8, DerivedValues::setStartAngle),
+                             SICK_LAYOUT_FIELD(12, DerivedValues::setAngularBeamResolution),
+                             SICK_LAYOUT_FIELD(16, DerivedValues::setInterbeamPeriod)>
+  DerivedValuesLayout;
+
+static_assert(DerivedValuesLayout::SIZE == 20,
+              "Derived values layout does not match the specification.");
+
+} // namespace
+
 ParseDerivedValues::ParseDerivedValues() {}
 
 datastructure::DerivedValues
@@ -44,19 +63,30 @@ ParseDerivedValues::parseUDPSequence(const datastructure::PacketBuffer& buffer,
                                      datastructure::Data& data) const
 {
   datastructure::DerivedValues derived_values;
+  parseUDPSequence(buffer, data, derived_values);
+  return derived_values;
+}
 
-
+void ParseDerivedValues::parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                                          datastructure::Data& data,
+                                          datastructure::DerivedValues& derived_values) const
+{
+  derived_values.setIsEmpty(false);
   if (!checkIfPreconditionsAreMet(data))
   {
     derived_values.setIsEmpty(true);
-    return derived_values;
+    return;
   }
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the buffer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr =
-    vec_ptr->begin() + data.getDataHeaderPtr()->getDerivedValuesBlockOffset();
-  setDataInDerivedValues(data_ptr, derived_values);
-  return derived_values;
+  const std::size_t offset = data.getDataHeaderPtr()->getDerivedValuesBlockOffset();
+  const std::size_t length = block_layout::blockLength(
+    buffer.getLength(), offset, data.getDataHeaderPtr()->getDerivedValuesBlockSize());
+  if (!DerivedValuesLayout::decode(vec_ptr->data() + offset, length, derived_values))
+  {
+    LOG_WARN("Derived values block is truncated, skipping it.");
+    derived_values.setIsEmpty(true);
+  }
 }
 
 bool ParseDerivedValues::checkIfPreconditionsAreMet(const datastructure::Data& data) const
@@ -85,52 +115,5 @@ bool ParseDerivedValues::checkIfDataContainsNeededParsedBlocks(
   return !(data.getDataHeaderPtr()->isEmpty());
 }
 
-void ParseDerivedValues::setDataInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                                datastructure::DerivedValues& derived_values) const
-{
-  setMultiplicationFactorInDerivedValues(data_ptr, derived_values);
-  setNumberOfBeamsInDerivedValues(data_ptr, derived_values);
-  setScanTimeInDerivedValues(data_ptr, derived_values);
-  setStartAngleInDerivedValues(data_ptr, derived_values);
-  setAngularBeamResolutionInDerivedValues(data_ptr, derived_values);
-  setInterbeamPeriodInDerivedValues(data_ptr, derived_values);
-}
-
-void ParseDerivedValues::setMultiplicationFactorInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setMultiplicationFactor(read_write_helper::readUint16LittleEndian(data_ptr + 0));
-}
-
-void ParseDerivedValues::setNumberOfBeamsInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setNumberOfBeams(read_write_helper::readUint16LittleEndian(data_ptr + 2));
-}
-
-void ParseDerivedValues::setScanTimeInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setScanTime(read_write_helper::readUint16LittleEndian(data_ptr + 4));
-}
-
-void ParseDerivedValues::setStartAngleInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setStartAngle(read_write_helper::readInt32LittleEndian(data_ptr + 8));
-}
-
-void ParseDerivedValues::setAngularBeamResolutionInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setAngularBeamResolution(read_write_helper::readInt32LittleEndian(data_ptr + 12));
-}
-
-void ParseDerivedValues::setInterbeamPeriodInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setInterbeamPeriod(read_write_helper::readUint32LittleEndian(data_ptr + 16));
-}
-
 } // namespace data_processing
 } // namespace sick
@@ -45,14 +45,14 @@ ParseDeviceStatusData::ParseDeviceStatusData() {}
 bool ParseDeviceStatusData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                              sick::datastructure::DeviceStatus& device_status) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  const uint8_t* data_ptr                                   = vec_ptr->data();
   device_status.setDeviceStatus(readDeviceStatus(data_ptr));
   return true;
 }
 
-uint8_t ParseDeviceStatusData::readDeviceStatus(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseDeviceStatusData::readDeviceStatus(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 0);
 }
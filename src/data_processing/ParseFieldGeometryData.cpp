@@ -34,8 +34,11 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseFieldGeometryData.h"
 
+#include "sick_safetyscanners_base/Logging.h"
 #include "sick_safetyscanners_base/cola2/Command.h"
 
+#include <utility>
+
 namespace sick {
 namespace data_processing {
 
@@ -45,16 +48,27 @@ ParseFieldGeometryData::ParseFieldGeometryData() {}
 bool ParseFieldGeometryData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                               sick::datastructure::FieldData& field_data) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the cursor valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
-  uint32_t array_length                                     = readArrayLength(data_ptr);
-  std::vector<uint16_t> geometry_distance_mm;
+  read_write_helper::ByteCursor cursor(*vec_ptr);
+  if (!cursor.require(8))
+  {
+    LOG_WARN("Field geometry data is shorter than its header.");
+    return false;
+  }
+  const uint8_t* data_ptr = cursor.getData();
+  uint32_t array_length   = readArrayLength(data_ptr);
+  if (!cursor.require(8 + static_cast<std::size_t>(array_length) * 2))
+  {
+    LOG_WARN("Field geometry data is shorter than its announced number of beams.");
+    return false;
+  }
+  std::vector<uint16_t> geometry_distance_mm(array_length);
   for (uint32_t i = 0; i < array_length; i++)
   {
-    geometry_distance_mm.push_back(readArrayElement(data_ptr, i));
+    geometry_distance_mm[i] = readArrayElement(data_ptr, i);
   }
-  field_data.setBeamDistances(geometry_distance_mm);
+  field_data.setBeamDistances(std::move(geometry_distance_mm));
 
   // Values are persistent for scanners
   field_data.setStartAngleDegrees(-47.5); // defined start angle in degrees in sick coordinates
@@ -64,13 +78,12 @@ bool ParseFieldGeometryData::parseTCPSequence(const datastructure::PacketBuffer&
   return true;
 }
 
-uint32_t
-ParseFieldGeometryData::readArrayLength(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseFieldGeometryData::readArrayLength(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 4);
 }
 
-uint16_t ParseFieldGeometryData::readArrayElement(std::vector<uint8_t>::const_iterator data_ptr,
+uint16_t ParseFieldGeometryData::readArrayElement(const uint8_t* data_ptr,
                                                   uint32_t elem_number) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 8 + elem_number * 2);
@@ -34,6 +34,7 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseFieldHeaderData.h"
 
+#include "sick_safetyscanners_base/Logging.h"
 #include "sick_safetyscanners_base/cola2/Command.h"
 
 namespace sick {
@@ -45,10 +46,19 @@ ParseFieldHeaderData::ParseFieldHeaderData() {}
 bool ParseFieldHeaderData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                             datastructure::FieldData& field_data) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the cursor valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
-  bool valid                                                = isValid(data_ptr);
+  read_write_helper::ByteCursor cursor(*vec_ptr);
+  // The name is the only part of variable length and starts at byte 88
+  if (!cursor.require(88) ||
+      !cursor.require(88 + static_cast<std::size_t>(readNameLength(cursor.getData()))))
+  {
+    LOG_WARN("Field header data is shorter than its announced field name.");
+    field_data.setIsValid(false);
+    return false;
+  }
+  const uint8_t* data_ptr = cursor.getData();
+  bool valid              = isValid(data_ptr);
   field_data.setIsValid(valid);
 
   if (valid)
@@ -70,7 +80,7 @@ bool ParseFieldHeaderData::parseTCPSequence(const datastructure::PacketBuffer& b
   return true;
 }
 
-bool ParseFieldHeaderData::isValid(std::vector<uint8_t>::const_iterator data_ptr) const
+bool ParseFieldHeaderData::isValid(const uint8_t* data_ptr) const
 {
   bool res     = false;
   uint8_t byte = read_write_helper::readUint8(data_ptr + 0);
@@ -82,7 +92,7 @@ bool ParseFieldHeaderData::isValid(std::vector<uint8_t>::const_iterator data_ptr
   return res;
 }
 
-void ParseFieldHeaderData::setFieldType(std::vector<uint8_t>::const_iterator data_ptr,
+void ParseFieldHeaderData::setFieldType(const uint8_t* data_ptr,
                                         datastructure::FieldData& field_data) const
 {
   uint8_t field_type = readEvalMethod(data_ptr);
@@ -98,66 +108,63 @@ void ParseFieldHeaderData::setFieldType(std::vector<uint8_t>::const_iterator dat
   }
 }
 
-std::string
-ParseFieldHeaderData::readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseFieldHeaderData::readVersionIndicator(const uint8_t* data_ptr) const
 {
   std::string result;
   result.push_back(read_write_helper::readUint8(data_ptr + 0));
   return result;
 }
 
-uint8_t ParseFieldHeaderData::readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldHeaderData::readMajorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 1);
 }
 
-uint8_t ParseFieldHeaderData::readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldHeaderData::readMinorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 2);
 }
 
-uint8_t ParseFieldHeaderData::readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldHeaderData::readReleaseNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 3);
 }
 
-bool ParseFieldHeaderData::readIsDefined(std::vector<uint8_t>::const_iterator data_ptr) const
+bool ParseFieldHeaderData::readIsDefined(const uint8_t* data_ptr) const
 {
   // TODO
   return read_write_helper::readUint8(data_ptr + 72);
 }
 
-uint8_t ParseFieldHeaderData::readEvalMethod(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldHeaderData::readEvalMethod(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 73);
 }
 
 
-uint16_t
-ParseFieldHeaderData::readMultiSampling(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseFieldHeaderData::readMultiSampling(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 74);
 }
 
-uint16_t
-ParseFieldHeaderData::readObjectResolution(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseFieldHeaderData::readObjectResolution(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 78);
 }
 
-uint16_t ParseFieldHeaderData::readSetIndex(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseFieldHeaderData::readSetIndex(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 82);
 }
 
 
-uint32_t ParseFieldHeaderData::readNameLength(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseFieldHeaderData::readNameLength(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 84);
 }
 
 
-std::string ParseFieldHeaderData::readFieldName(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseFieldHeaderData::readFieldName(const uint8_t* data_ptr) const
 {
   uint32_t name_length = read_write_helper::readUint32LittleEndian(data_ptr + 84);
   std::string name;
@@ -34,6 +34,7 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseFieldSetsData.h"
 
+#include "sick_safetyscanners_base/Logging.h"
 #include "sick_safetyscanners_base/cola2/Command.h"
 
 namespace sick {
@@ -45,54 +46,65 @@ ParseFieldSetsData::ParseFieldSetsData() {}
 bool ParseFieldSetsData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                           sick::datastructure::FieldSets& field_sets) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the cursor valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ByteCursor cursor(*vec_ptr);
+  if (!cursor.require(8))
+  {
+    LOG_WARN("Field sets data is shorter than its header.");
+    return false;
+  }
+  const uint8_t* data_ptr = cursor.getData();
+  uint32_t array_length   = readArrayLength(data_ptr);
+  // Every field set occupies 104 bytes
+  if (!cursor.require(8 + static_cast<std::size_t>(array_length) * 104))
+  {
+    LOG_WARN("Field sets data is shorter than its announced number of field sets.");
+    return false;
+  }
   field_sets.setVersionCVersion(readVersionIndicator(data_ptr));
   field_sets.setVersionMajorVersionNumber(readMajorNumber(data_ptr));
   field_sets.setVersionMinorVersionNumber(readMinorNumber(data_ptr));
   field_sets.setVersionReleaseNumber(readReleaseNumber(data_ptr));
-  uint32_t array_length = readArrayLength(data_ptr);
   field_sets.setNameLength(readNameLength(data_ptr, array_length));
   field_sets.setFieldName(readFieldName(data_ptr, array_length));
   field_sets.setIsDefined(readIsDefined(data_ptr, array_length));
   return true;
 }
 
-std::string
-ParseFieldSetsData::readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseFieldSetsData::readVersionIndicator(const uint8_t* data_ptr) const
 {
   std::string result;
   result.push_back(read_write_helper::readUint8(data_ptr + 0));
   return result;
 }
 
-uint8_t ParseFieldSetsData::readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldSetsData::readMajorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 1);
 }
 
-uint8_t ParseFieldSetsData::readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldSetsData::readMinorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 2);
 }
 
-uint8_t ParseFieldSetsData::readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldSetsData::readReleaseNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 3);
 }
 
-uint32_t ParseFieldSetsData::readArrayLength(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseFieldSetsData::readArrayLength(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 4);
 }
 
 
 std::vector<std::string>
-ParseFieldSetsData::readFieldName(std::vector<uint8_t>::const_iterator data_ptr,
-                                  uint32_t array_length) const
+ParseFieldSetsData::readFieldName(const uint8_t* data_ptr, uint32_t array_length) const
 {
   std::vector<std::string> result;
+  result.reserve(array_length);
   for (uint32_t i = 0; i < array_length; i++)
   {
     uint32_t name_length = read_write_helper::readUint32LittleEndian(data_ptr + 8 + i * 104);
@@ -107,20 +119,21 @@ ParseFieldSetsData::readFieldName(std::vector<uint8_t>::const_iterator data_ptr,
 }
 
 std::vector<uint32_t>
-ParseFieldSetsData::readNameLength(std::vector<uint8_t>::const_iterator data_ptr,
-                                   uint32_t array_length) const
+ParseFieldSetsData::readNameLength(const uint8_t* data_ptr, uint32_t array_length) const
 {
   std::vector<uint32_t> result;
+  result.reserve(array_length);
   for (uint32_t i = 0; i < array_length; i++)
   {
     result.push_back(read_write_helper::readUint32LittleEndian(data_ptr + 8 + i * 104));
   }
   return result;
 }
-std::vector<bool> ParseFieldSetsData::readIsDefined(std::vector<uint8_t>::const_iterator data_ptr,
+std::vector<bool> ParseFieldSetsData::readIsDefined(const uint8_t* data_ptr,
                                                     uint32_t array_length) const
 {
   std::vector<bool> result;
+  result.reserve(array_length);
   for (uint32_t i = 0; i < array_length; i++)
   {
     uint8_t byte = read_write_helper::readUint8LittleEndian(data_ptr + 44 + i * 104);
@@ -45,16 +45,15 @@ ParseFirmwareVersion::ParseFirmwareVersion() {}
 bool ParseFirmwareVersion::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                             datastructure::FirmwareVersion& firmware_version) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  const uint8_t* data_ptr                                   = vec_ptr->data();
   firmware_version.setFirmwareVersion(readFirmwareVersion(data_ptr));
   return true;
 }
 
 
-std::string
-ParseFirmwareVersion::readFirmwareVersion(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseFirmwareVersion::readFirmwareVersion(const uint8_t* data_ptr) const
 {
   uint16_t string_length = read_write_helper::readUint16LittleEndian(data_ptr + 0);
 
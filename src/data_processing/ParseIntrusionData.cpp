@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseIntrusionData.h"
 
+#include "sick_safetyscanners_base/Logging.h"
+
 namespace sick {
 namespace data_processing {
 
@@ -44,19 +46,32 @@ ParseIntrusionData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
                                      datastructure::Data& data)
 {
   datastructure::IntrusionData intrusion_data;
+  parseUDPSequence(buffer, data, intrusion_data);
+  return intrusion_data;
+}
+
+void ParseIntrusionData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                                          datastructure::Data& data,
+                                          datastructure::IntrusionData& intrusion_data)
+{
+  intrusion_data.setIsEmpty(false);
   if (!checkIfPreconditionsAreMet(data))
   {
     intrusion_data.setIsEmpty(true);
-    return intrusion_data;
+    return;
   }
 
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the cursor valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr =
-    vec_ptr->begin() + data.getDataHeaderPtr()->getIntrusionDataBlockOffset();
+  read_write_helper::ByteCursor cursor = read_write_helper::ByteCursor(*vec_ptr).block(
+    data.getDataHeaderPtr()->getIntrusionDataBlockOffset(),
+    data.getDataHeaderPtr()->getIntrusionDataBlockSize());
   setNumScanPoints(data.getDerivedValuesPtr()->getNumberOfBeams());
-  setDataInIntrusionData(data_ptr, intrusion_data);
-  return intrusion_data;
+  if (!setDataInIntrusionData(cursor, intrusion_data))
+  {
+    LOG_WARN("Skipping intrusion data, the cut-off paths exceed the received data.");
+    intrusion_data.setIsEmpty(true);
+  }
 }
 
 bool ParseIntrusionData::checkIfPreconditionsAreMet(const datastructure::Data& data) const
@@ -102,35 +117,48 @@ void ParseIntrusionData::setNumScanPoints(const uint16_t& num_scan_points)
   m_num_scan_points = num_scan_points;
 }
 
-void ParseIntrusionData::setDataInIntrusionData(std::vector<uint8_t>::const_iterator data_ptr,
+bool ParseIntrusionData::setDataInIntrusionData(read_write_helper::ByteCursor cursor,
                                                 datastructure::IntrusionData& intrusion_data) const
 {
-  std::vector<sick::datastructure::IntrusionDatum> intrusion_datums;
-  setDataInIntrusionDatums(data_ptr, intrusion_datums);
+  // Thread local scratch space, the setter only copies into the existing capacity of the target.
+  static thread_local std::vector<sick::datastructure::IntrusionDatum> intrusion_datums;
+  if (!setDataInIntrusionDatums(cursor, intrusion_datums))
+  {
+    return false;
+  }
   intrusion_data.setIntrusionDataVector(intrusion_datums);
+  return true;
 }
 
-void ParseIntrusionData::setDataInIntrusionDatums(
-  std::vector<uint8_t>::const_iterator data_ptr,
+bool ParseIntrusionData::setDataInIntrusionDatums(
+  read_write_helper::ByteCursor cursor,
   std::vector<sick::datastructure::IntrusionDatum>& intrusion_datums) const
 {
-  uint16_t offset = 0;
-  // Repeats for 24 CutOffPaths
+  // Repeats for 24 CutOffPaths, existing datums are overwritten to keep their flag capacity
+  intrusion_datums.resize(24);
   for (uint8_t i_set = 0; i_set < 24; ++i_set)
   {
-    sick::datastructure::IntrusionDatum datum;
-    setSizeInIntrusionDatum(offset, data_ptr, datum);
-    offset += 4;
-    setFlagsInIntrusionDatum(offset, data_ptr, datum);
-    offset += datum.getSize();
-    intrusion_datums.push_back(datum);
+    sick::datastructure::IntrusionDatum& datum = intrusion_datums[i_set];
+    if (!cursor.require(4))
+    {
+      return false;
+    }
+    setSizeInIntrusionDatum(0, cursor.getData(), datum);
+    cursor.skip(4);
+    if (!cursor.require(datum.getSize()))
+    {
+      return false;
+    }
+    setFlagsInIntrusionDatum(0, cursor.getData(), datum);
+    cursor.skip(datum.getSize());
   }
+  return true;
 }
 
 
 uint16_t
 ParseIntrusionData::setSizeInIntrusionDatum(const uint16_t& offset,
-                                            std::vector<uint8_t>::const_iterator data_ptr,
+                                            const uint8_t* data_ptr,
                                             sick::datastructure::IntrusionDatum& datum) const
 {
   uint32_t num_bytes_to_read = read_write_helper::readUint32LittleEndian(data_ptr + offset);
@@ -140,23 +168,16 @@ ParseIntrusionData::setSizeInIntrusionDatum(const uint16_t& offset,
 
 uint16_t
 ParseIntrusionData::setFlagsInIntrusionDatum(const uint16_t& offset,
-                                             std::vector<uint8_t>::const_iterator data_ptr,
+                                             const uint8_t* data_ptr,
                                              sick::datastructure::IntrusionDatum& datum) const
 {
-  uint32_t num_read_flags = 0;
-  std::vector<bool> flags;
-  for (uint16_t num_read_bytes = 0;
-       (num_read_bytes < datum.getSize()) && (num_read_flags < m_num_scan_points);
-       num_read_bytes++)
+  // The datum keeps the packed bytes, flags behind the number of beams are dropped.
+  std::size_t num_flags = static_cast<std::size_t>(datum.getSize()) * 8;
+  if (num_flags > m_num_scan_points)
   {
-    uint8_t bitset = read_write_helper::readUint8LittleEndian(data_ptr + offset + num_read_bytes);
-    for (uint32_t i_bit = 0; (i_bit < 8) && (num_read_flags < m_num_scan_points);
-         i_bit++, num_read_flags++)
-    {
-      flags.push_back(static_cast<bool>(bitset & (0x01 << i_bit)));
-    }
+    num_flags = m_num_scan_points;
   }
-  datum.setFlagsVector(flags);
+  datum.setFlags(data_ptr + offset, num_flags);
   return offset;
 }
 
@@ -45,9 +45,9 @@ ParseMeasurementCurrentConfigData::ParseMeasurementCurrentConfigData() {}
 bool ParseMeasurementCurrentConfigData::parseTCPSequence(
   const datastructure::PacketBuffer& buffer, datastructure::ConfigData& config_data) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  const uint8_t* data_ptr                                   = vec_ptr->data();
   config_data.setVersionCVersion(readVersionIndicator(data_ptr));
   config_data.setVersionMajorVersionNumber(readMajorNumber(data_ptr));
   config_data.setVersionMinorVersionNumber(readMinorNumber(data_ptr));
@@ -69,115 +69,101 @@ bool ParseMeasurementCurrentConfigData::parseTCPSequence(
   return true;
 }
 
-std::string ParseMeasurementCurrentConfigData::readVersionIndicator(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseMeasurementCurrentConfigData::readVersionIndicator(const uint8_t* data_ptr) const
 {
   std::string result;
   result.push_back(read_write_helper::readUint8(data_ptr + 0));
   return result;
 }
 
-uint8_t ParseMeasurementCurrentConfigData::readMajorNumber(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseMeasurementCurrentConfigData::readMajorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 1);
 }
 
-uint8_t ParseMeasurementCurrentConfigData::readMinorNumber(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseMeasurementCurrentConfigData::readMinorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 2);
 }
 
-uint8_t ParseMeasurementCurrentConfigData::readReleaseNumber(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseMeasurementCurrentConfigData::readReleaseNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 3);
 }
 
-bool ParseMeasurementCurrentConfigData::readEnabled(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+bool ParseMeasurementCurrentConfigData::readEnabled(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 4);
 }
 
-uint8_t ParseMeasurementCurrentConfigData::readInterfaceType(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseMeasurementCurrentConfigData::readInterfaceType(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 5);
 }
 
 boost::asio::ip::address_v4
-ParseMeasurementCurrentConfigData::readHostIp(std::vector<uint8_t>::const_iterator data_ptr) const
+ParseMeasurementCurrentConfigData::readHostIp(const uint8_t* data_ptr) const
 {
   uint32_t word = read_write_helper::readUint32LittleEndian(data_ptr + 8);
   boost::asio::ip::address_v4 addr(word);
   return addr;
 }
 
-uint16_t
-ParseMeasurementCurrentConfigData::readHostPort(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseMeasurementCurrentConfigData::readHostPort(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 12);
 }
 
-uint16_t ParseMeasurementCurrentConfigData::readPublishingFreq(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseMeasurementCurrentConfigData::readPublishingFreq(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 14);
 }
 
-uint32_t ParseMeasurementCurrentConfigData::readStartAngle(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseMeasurementCurrentConfigData::readStartAngle(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 16);
 }
 
-uint32_t
-ParseMeasurementCurrentConfigData::readEndAngle(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseMeasurementCurrentConfigData::readEndAngle(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 20);
 }
 
-uint16_t
-ParseMeasurementCurrentConfigData::readFeatures(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseMeasurementCurrentConfigData::readFeatures(const uint8_t* data_ptr) const
 {
   // TODO parse Features
   return read_write_helper::readUint16LittleEndian(data_ptr + 24);
 }
 
 uint16_t ParseMeasurementCurrentConfigData::readDerivedMultiplicationFactor(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+  const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 28);
 }
 
-uint16_t ParseMeasurementCurrentConfigData::readDerivedNumBeams(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseMeasurementCurrentConfigData::readDerivedNumBeams(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 30);
 }
 
-uint16_t ParseMeasurementCurrentConfigData::readDerivedScanTime(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseMeasurementCurrentConfigData::readDerivedScanTime(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 32);
 }
 
-uint32_t ParseMeasurementCurrentConfigData::readDerivedStartAngle(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseMeasurementCurrentConfigData::readDerivedStartAngle(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 36);
 }
 
 uint32_t ParseMeasurementCurrentConfigData::readDerivedAngularBeamResolution(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+  const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 40);
 }
 
 uint32_t ParseMeasurementCurrentConfigData::readDerivedInterbeamPeriod(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+  const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 44);
 }
@@ -34,29 +34,277 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseMeasurementData.h"
 
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define SICK_BEAM_DECODER_X86 1
+#  include <immintrin.h>
+#endif
+
 namespace sick {
 namespace data_processing {
 
+namespace {
+
+const std::size_t BEAM_RECORD_SIZE = ParseMeasurementData::BEAM_RECORD_SIZE;
+
+using BeamDecoder = void (*)(const uint8_t*, uint32_t, uint16_t*, uint8_t*, uint8_t*);
+
+void decodeBeamsScalar(const uint8_t* beams,
+                       uint32_t number_of_beams,
+                       uint16_t* distances,
+                       uint8_t* reflectivities,
+                       uint8_t* status_bits)
+{
+  for (uint32_t i = 0; i < number_of_beams; i++)
+  {
+    const uint8_t* record = beams + i * BEAM_RECORD_SIZE;
+    distances[i]          = static_cast<uint16_t>(record[0] | (record[1] << 8));
+    reflectivities[i]     = record[2];
+    status_bits[i]        = record[3];
+  }
+}
+
+#ifdef SICK_BEAM_DECODER_X86
+#  ifdef __SSE2__
+// Decodes 16 beams per iteration. The low and high halves of every 32 bit record are sign extended
+// before packing, so the signed saturation of _mm_packs_epi32 keeps all 16 bits.
+void decodeBeamsSSE2(const uint8_t* beams,
+                     uint32_t number_of_beams,
+                     uint16_t* distances,
+                     uint8_t* reflectivities,
+                     uint8_t* status_bits)
+{
+  const __m128i low_byte_mask = _mm_set1_epi16(0x00ff);
+  uint32_t i                  = 0;
+  for (; i + 16 <= number_of_beams; i += 16)
+  {
+    const uint8_t* record = beams + i * BEAM_RECORD_SIZE;
+    __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(record + 0));
+    __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(record + 16));
+    __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(record + 32));
+    __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(record + 48));
+
+    __m128i d0 = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(r0, 16), 16),
+                                 _mm_srai_epi32(_mm_slli_epi32(r1, 16), 16));
+    __m128i d1 = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(r2, 16), 16),
+                                 _mm_srai_epi32(_mm_slli_epi32(r3, 16), 16));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(distances + i), d0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(distances + i + 8), d1);
+
+    __m128i h0 = _mm_packs_epi32(_mm_srai_epi32(r0, 16), _mm_srai_epi32(r1, 16));
+    __m128i h1 = _mm_packs_epi32(_mm_srai_epi32(r2, 16), _mm_srai_epi32(r3, 16));
+    __m128i reflectivity =
+      _mm_packus_epi16(_mm_and_si128(h0, low_byte_mask), _mm_and_si128(h1, low_byte_mask));
+    __m128i status = _mm_packus_epi16(_mm_srli_epi16(h0, 8), _mm_srli_epi16(h1, 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(reflectivities + i), reflectivity);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(status_bits + i), status);
+  }
+  decodeBeamsScalar(beams + i * BEAM_RECORD_SIZE,
+                    number_of_beams - i,
+                    distances + i,
+                    reflectivities + i,
+                    status_bits + i);
+}
+#  endif // __SSE2__
+
+// Same as the SSE2 kernel on 32 beams per iteration. The AVX2 pack instructions work within 128
+// bit lanes, so the 64 bit quarters are reordered after every pack.
+__attribute__((target("avx2"))) void decodeBeamsAVX2(const uint8_t* beams,
+                                                     uint32_t number_of_beams,
+                                                     uint16_t* distances,
+                                                     uint8_t* reflectivities,
+                                                     uint8_t* status_bits)
+{
+  const __m256i low_byte_mask = _mm256_set1_epi16(0x00ff);
+  uint32_t i                  = 0;
+  for (; i + 32 <= number_of_beams; i += 32)
+  {
+    const uint8_t* record = beams + i * BEAM_RECORD_SIZE;
+    __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(record + 0));
+    __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(record + 32));
+    __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(record + 64));
+    __m256i r3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(record + 96));
+
+    __m256i d0 = _mm256_permute4x64_epi64(
+      _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(r0, 16), 16),
+                         _mm256_srai_epi32(_mm256_slli_epi32(r1, 16), 16)),
+      0xd8);
+    __m256i d1 = _mm256_permute4x64_epi64(
+      _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(r2, 16), 16),
+                         _mm256_srai_epi32(_mm256_slli_epi32(r3, 16), 16)),
+      0xd8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(distances + i), d0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(distances + i + 16), d1);
+
+    __m256i h0 = _mm256_permute4x64_epi64(
+      _mm256_packs_epi32(_mm256_srai_epi32(r0, 16), _mm256_srai_epi32(r1, 16)), 0xd8);
+    __m256i h1 = _mm256_permute4x64_epi64(
+      _mm256_packs_epi32(_mm256_srai_epi32(r2, 16), _mm256_srai_epi32(r3, 16)), 0xd8);
+    __m256i reflectivity = _mm256_permute4x64_epi64(
+      _mm256_packus_epi16(_mm256_and_si256(h0, low_byte_mask), _mm256_and_si256(h1, low_byte_mask)),
+      0xd8);
+    __m256i status = _mm256_permute4x64_epi64(
+      _mm256_packus_epi16(_mm256_srli_epi16(h0, 8), _mm256_srli_epi16(h1, 8)), 0xd8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(reflectivities + i), reflectivity);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(status_bits + i), status);
+  }
+  decodeBeamsScalar(beams + i * BEAM_RECORD_SIZE,
+                    number_of_beams - i,
+                    distances + i,
+                    reflectivities + i,
+                    status_bits + i);
+}
+#endif // SICK_BEAM_DECODER_X86
+
+BeamDecoder getBeamDecoder(SimdKernel kernel)
+{
+  switch (kernel)
+  {
+#ifdef SICK_BEAM_DECODER_X86
+    case SimdKernel::AVX2:
+      return decodeBeamsAVX2;
+#  ifdef __SSE2__
+    case SimdKernel::SSE2:
+      return decodeBeamsSSE2;
+#  endif
+#endif
+    default:
+      return decodeBeamsScalar;
+  }
+}
+
+} // namespace
+
+const std::size_t ParseMeasurementData::BEAM_RECORD_SIZE;
+
 ParseMeasurementData::ParseMeasurementData() {}
 
+void ParseMeasurementData::decodeBeams(const uint8_t* beams,
+                                       uint32_t number_of_beams,
+                                       uint16_t* distances,
+                                       uint8_t* reflectivities,
+                                       uint8_t* status_bits)
+{
+  static const BeamDecoder decoder = getBeamDecoder(getBestSimdKernel());
+  decoder(beams, number_of_beams, distances, reflectivities, status_bits);
+}
+
+void ParseMeasurementData::decodeBeams(SimdKernel kernel,
+                                       const uint8_t* beams,
+                                       uint32_t number_of_beams,
+                                       uint16_t* distances,
+                                       uint8_t* reflectivities,
+                                       uint8_t* status_bits)
+{
+  if (!isSimdKernelSupported(kernel))
+  {
+    kernel = SimdKernel::SCALAR;
+  }
+  getBeamDecoder(kernel)(beams, number_of_beams, distances, reflectivities, status_bits);
+}
+
 datastructure::MeasurementData
 ParseMeasurementData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
                                        datastructure::Data& data)
 {
   datastructure::MeasurementData measurement_data;
+  parseUDPSequence(buffer, data, measurement_data);
+  return measurement_data;
+}
+
+void ParseMeasurementData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                                            datastructure::Data& data,
+                                            datastructure::MeasurementData& measurement_data)
+{
+  parseUDPSequence(buffer, data, BeamRegion(), measurement_data);
+}
+
+void ParseMeasurementData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                                            datastructure::Data& data,
+                                            const BeamRegion& region,
+                                            datastructure::MeasurementData& measurement_data)
+{
+  measurement_data.setIsEmpty(false);
   if (!checkIfPreconditionsAreMet(data))
   {
-    measurement_data.setIsEmpty(true);
-    return measurement_data;
+    setEmptyMeasurementData(measurement_data);
+    return;
   }
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr =
-    vec_ptr->begin() + data.getDataHeaderPtr()->getMeasurementDataBlockOffset();
+  uint32_t number_of_beams = 0;
+  const uint8_t* beams     = findBeams(*vec_ptr, data, number_of_beams);
+  if (beams == nullptr)
+  {
+    setEmptyMeasurementData(measurement_data);
+    return;
+  }
+  setScanPointsInMeasurementData(beams, number_of_beams, data, region, measurement_data);
+}
 
-  setStartAngleAndDelta(data);
-  setDataInMeasurementData(data_ptr, measurement_data);
-  return measurement_data;
+void ParseMeasurementData::parseUDPSequence(
+  const datastructure::PacketBuffer& buffer,
+  datastructure::Data& data,
+  const std::vector<BeamRegion>& regions,
+  std::vector<datastructure::MeasurementData>& measurement_data)
+{
+  measurement_data.resize(regions.size());
+  const uint8_t* beams     = nullptr;
+  uint32_t number_of_beams = 0;
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
+  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
+  if (checkIfPreconditionsAreMet(data))
+  {
+    beams = findBeams(*vec_ptr, data, number_of_beams);
+  }
+  for (std::size_t i = 0; i < regions.size(); i++)
+  {
+    if (beams == nullptr)
+    {
+      setEmptyMeasurementData(measurement_data[i]);
+      continue;
+    }
+    measurement_data[i].setIsEmpty(false);
+    setScanPointsInMeasurementData(beams, number_of_beams, data, regions[i], measurement_data[i]);
+  }
+}
+
+std::size_t
+ParseMeasurementData::beginUDPSequence(const datastructure::PacketBuffer& buffer,
+                                       datastructure::Data& data,
+                                       datastructure::MeasurementData& measurement_data)
+{
+  measurement_data.setIsEmpty(false);
+  if (!checkIfPreconditionsAreMet(data))
+  {
+    setEmptyMeasurementData(measurement_data);
+    return 0;
+  }
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
+  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
+  uint32_t number_of_beams = 0;
+  const uint8_t* beams     = findBeams(*vec_ptr, data, number_of_beams);
+  if (beams == nullptr)
+  {
+    setEmptyMeasurementData(measurement_data);
+    return 0;
+  }
+  // The default region of parseUDPSequence(), which keeps every beam
+  measurement_data.setAngles(data.getDerivedValuesPtr()->getStartAngle(),
+                             data.getDerivedValuesPtr()->getAngularBeamResolution());
+  measurement_data.setNumberOfBeams(number_of_beams);
+  measurement_data.resize(number_of_beams);
+  return static_cast<std::size_t>(beams - vec_ptr->data());
+}
+
+void ParseMeasurementData::setEmptyMeasurementData(
+  datastructure::MeasurementData& measurement_data) const
+{
+  // A recycled instance might still hold the beams of a previous scan
+  measurement_data.setIsEmpty(true);
+  measurement_data.setNumberOfBeams(0);
+  measurement_data.resize(0);
 }
 
 bool ParseMeasurementData::checkIfPreconditionsAreMet(const datastructure::Data& data) const
@@ -93,73 +341,132 @@ bool ParseMeasurementData::checkIfDataContainsNeededParsedBlocks(
 }
 
 
-void ParseMeasurementData::setDataInMeasurementData(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::MeasurementData& measurement_data)
+const uint8_t* ParseMeasurementData::findBeams(const std::vector<uint8_t>& buffer,
+                                               const datastructure::Data& data,
+                                               uint32_t& number_of_beams) const
 {
-  setNumberOfBeamsInMeasurementData(data_ptr, measurement_data);
-  setScanPointsInMeasurementData(data_ptr, measurement_data);
+  uint32_t offset = data.getDataHeaderPtr()->getMeasurementDataBlockOffset();
+  if (buffer.size() < offset + BEAM_RECORD_SIZE)
+  {
+    LOG_WARN("Skipping measurement data, the block exceeds the received data.");
+    return nullptr;
+  }
+  const uint8_t* data_ptr = buffer.data() + offset;
+  number_of_beams         = read_write_helper::readUint32LittleEndian(data_ptr + 0);
+
+  uint32_t maxexpectedbeams = 2751;
+  if (number_of_beams > maxexpectedbeams)
+  {
+    LOG_WARN("Field Number Beams has a value larger then the expected Number of Beams for the "
+             "laserscanners. Skipping this measurement.");
+    LOG_WARN("Max expected beams: %i", maxexpectedbeams);
+    LOG_WARN("Number beams according to the datafield: %i", number_of_beams);
+    return nullptr;
+  }
+  if (buffer.size() - offset < BEAM_RECORD_SIZE + number_of_beams * BEAM_RECORD_SIZE)
+  {
+    LOG_WARN("Skipping measurement data, the beams exceed the received data.");
+    return nullptr;
+  }
+  return data_ptr + BEAM_RECORD_SIZE;
 }
 
-void ParseMeasurementData::setNumberOfBeamsInMeasurementData(
-  std::vector<uint8_t>::const_iterator data_ptr,
+void ParseMeasurementData::setScanPointsInMeasurementData(
+  const uint8_t* beams,
+  uint32_t number_of_beams,
+  const datastructure::Data& data,
+  const BeamRegion& region,
   datastructure::MeasurementData& measurement_data) const
 {
-  measurement_data.setNumberOfBeams(read_write_helper::readUint32LittleEndian(data_ptr + 0));
-}
+  float start_angle             = data.getDerivedValuesPtr()->getStartAngle();
+  float angular_beam_resolution = data.getDerivedValuesPtr()->getAngularBeamResolution();
+  uint32_t first_beam           = 0;
+  uint32_t end_beam             = 0;
+  selectBeams(region, start_angle, angular_beam_resolution, number_of_beams, first_beam, end_beam);
 
-void ParseMeasurementData::setStartAngleAndDelta(const datastructure::Data& data)
-{
-  m_angle       = data.getDerivedValuesPtr()->getStartAngle();
-  m_angle_delta = data.getDerivedValuesPtr()->getAngularBeamResolution();
+  uint32_t stride         = region.stride > 1 ? region.stride : 1;
+  uint32_t selected_beams = (end_beam - first_beam + stride - 1) / stride;
+  measurement_data.setAngles(start_angle + static_cast<float>(first_beam) * angular_beam_resolution,
+                             angular_beam_resolution * static_cast<float>(stride));
+  measurement_data.setNumberOfBeams(selected_beams);
+  measurement_data.resize(selected_beams);
+
+  uint16_t* distances     = measurement_data.getDistances().data();
+  uint8_t* reflectivities = measurement_data.getReflectivities().data();
+  uint8_t* status_bits    = measurement_data.getStatusBits().data();
+  if (stride == 1)
+  {
+    decodeBeams(beams + first_beam * BEAM_RECORD_SIZE,
+                selected_beams,
+                distances,
+                reflectivities,
+                status_bits);
+  }
+  else
+  {
+    // Only the records of the kept beams are touched
+    for (uint32_t i = 0; i < selected_beams; i++)
+    {
+      const uint8_t* record = beams + (first_beam + i * stride) * BEAM_RECORD_SIZE;
+      distances[i]          = static_cast<uint16_t>(record[0] | (record[1] << 8));
+      reflectivities[i]     = record[2];
+      status_bits[i]        = record[3];
+    }
+  }
+  applyDistanceLimits(region, measurement_data);
 }
 
-void ParseMeasurementData::setScanPointsInMeasurementData(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::MeasurementData& measurement_data)
+void ParseMeasurementData::selectBeams(const BeamRegion& region,
+                                       float start_angle,
+                                       float angular_beam_resolution,
+                                       uint32_t number_of_beams,
+                                       uint32_t& first_beam,
+                                       uint32_t& end_beam) const
 {
-  uint32_t numBeams = measurement_data.getNumberOfBeams();
-
-  uint32_t maxexpectedbeams = 2751;
-  if (numBeams > maxexpectedbeams)
+  first_beam = 0;
+  end_beam   = number_of_beams;
+  if (!(angular_beam_resolution > 0.0f))
   {
-    LOG_WARN("Field Number Beams has a value larger then the expected Number of Beams for the "
-             "laserscanners. Skipping this measurement.");
-    LOG_WARN("Max expected beams: %i", maxexpectedbeams);
-    LOG_WARN("Number beams according to the datafield: %i", numBeams);
-    measurement_data.setNumberOfBeams(0);
-    measurement_data.setIsEmpty(true);
     return;
   }
-
-  for (uint32_t i = 0; i < numBeams; i++)
+  // Beams within a small fraction of the resolution of a bound belong to the region
+  const double tolerance = 1e-3;
+  double first_position =
+    (static_cast<double>(region.start_angle) - start_angle) / angular_beam_resolution;
+  double end_position =
+    (static_cast<double>(region.end_angle) - start_angle) / angular_beam_resolution;
+  double first = std::ceil(first_position - tolerance);
+  double end   = std::floor(end_position + tolerance) + 1.0;
+  if (first > 0.0)
+  {
+    first_beam = first < number_of_beams ? static_cast<uint32_t>(first) : number_of_beams;
+  }
+  if (end < number_of_beams)
   {
-    addScanPointToMeasurementData(i, data_ptr, measurement_data);
-    m_angle += m_angle_delta;
+    end_beam = end > first_beam ? static_cast<uint32_t>(end) : first_beam;
   }
 }
 
-void ParseMeasurementData::addScanPointToMeasurementData(
-  const uint16_t offset,
-  std::vector<uint8_t>::const_iterator data_ptr,
-  datastructure::MeasurementData& measurement_data) const
+void ParseMeasurementData::applyDistanceLimits(
+  const BeamRegion& region, datastructure::MeasurementData& measurement_data) const
 {
-  uint16_t distance    = read_write_helper::readUint16LittleEndian(data_ptr + (4 + offset * 4));
-  uint8_t reflectivity = read_write_helper::readUint8LittleEndian(data_ptr + (6 + offset * 4));
-  uint8_t status       = read_write_helper::readUint8LittleEndian(data_ptr + (7 + offset * 4));
-  bool valid           = static_cast<bool>(status & (0x01 << 0));
-  bool infinite        = static_cast<bool>(status & (0x01 << 1));
-  bool glare           = static_cast<bool>(status & (0x01 << 2));
-  bool reflector       = static_cast<bool>(status & (0x01 << 3));
-  bool contamination   = static_cast<bool>(status & (0x01 << 4));
-  bool contamination_warning = static_cast<bool>(status & (0x01 << 5));
-  measurement_data.addScanPoint(sick::datastructure::ScanPoint(m_angle,
-                                                               distance,
-                                                               reflectivity,
-                                                               valid,
-                                                               infinite,
-                                                               glare,
-                                                               reflector,
-                                                               contamination,
-                                                               contamination_warning));
+  if (region.min_distance == 0 && region.max_distance == std::numeric_limits<uint16_t>::max())
+  {
+    return;
+  }
+  uint16_t* distances     = measurement_data.getDistances().data();
+  uint8_t* reflectivities = measurement_data.getReflectivities().data();
+  uint8_t* status_bits    = measurement_data.getStatusBits().data();
+  std::size_t size        = measurement_data.getDistances().size();
+  for (std::size_t i = 0; i < size; i++)
+  {
+    if (distances[i] < region.min_distance || distances[i] > region.max_distance)
+    {
+      distances[i]      = 0;
+      reflectivities[i] = 0;
+      status_bits[i]    = 0;
+    }
+  }
 }
 
 } // namespace data_processing
@@ -45,9 +45,9 @@ ParseMeasurementPersistentConfigData::ParseMeasurementPersistentConfigData() {}
 bool ParseMeasurementPersistentConfigData::parseTCPSequence(
   const datastructure::PacketBuffer& buffer, datastructure::ConfigData& config_data) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  const uint8_t* data_ptr                                   = vec_ptr->data();
   config_data.setVersionCVersion(readVersionIndicator(data_ptr));
   config_data.setVersionMajorVersionNumber(readMajorNumber(data_ptr));
   config_data.setVersionMinorVersionNumber(readMinorNumber(data_ptr));
@@ -64,77 +64,67 @@ bool ParseMeasurementPersistentConfigData::parseTCPSequence(
 }
 
 std::string ParseMeasurementPersistentConfigData::readVersionIndicator(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+  const uint8_t* data_ptr) const
 {
   std::string result;
   result.push_back(read_write_helper::readUint8(data_ptr + 0));
   return result;
 }
 
-uint8_t ParseMeasurementPersistentConfigData::readMajorNumber(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseMeasurementPersistentConfigData::readMajorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 1);
 }
 
-uint8_t ParseMeasurementPersistentConfigData::readMinorNumber(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseMeasurementPersistentConfigData::readMinorNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 2);
 }
 
-uint8_t ParseMeasurementPersistentConfigData::readReleaseNumber(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseMeasurementPersistentConfigData::readReleaseNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 3);
 }
 
-bool ParseMeasurementPersistentConfigData::readEnabled(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+bool ParseMeasurementPersistentConfigData::readEnabled(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 4);
 }
 
-uint8_t ParseMeasurementPersistentConfigData::readInterfaceType(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseMeasurementPersistentConfigData::readInterfaceType(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 5);
 }
 
 boost::asio::ip::address_v4 ParseMeasurementPersistentConfigData::readHostIp(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+  const uint8_t* data_ptr) const
 {
   uint32_t word = read_write_helper::readUint32LittleEndian(data_ptr + 8);
   boost::asio::ip::address_v4 addr(word);
   return addr;
 }
 
-uint16_t ParseMeasurementPersistentConfigData::readHostPort(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseMeasurementPersistentConfigData::readHostPort(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 12);
 }
 
-uint16_t ParseMeasurementPersistentConfigData::readPublishingFreq(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseMeasurementPersistentConfigData::readPublishingFreq(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 14);
 }
 
-uint32_t ParseMeasurementPersistentConfigData::readStartAngle(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseMeasurementPersistentConfigData::readStartAngle(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 16);
 }
 
-uint32_t ParseMeasurementPersistentConfigData::readEndAngle(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseMeasurementPersistentConfigData::readEndAngle(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 20);
 }
 
-uint16_t ParseMeasurementPersistentConfigData::readFeatures(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseMeasurementPersistentConfigData::readFeatures(const uint8_t* data_ptr) const
 {
   // TODO parse Features
   return read_write_helper::readUint16LittleEndian(data_ptr + 24);
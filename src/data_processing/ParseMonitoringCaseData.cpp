@@ -36,6 +36,8 @@
 
 #include "sick_safetyscanners_base/cola2/Command.h"
 
+#include <utility>
+
 namespace sick {
 namespace data_processing {
 
@@ -46,29 +48,29 @@ bool ParseMonitoringCaseData::parseTCPSequence(
   const datastructure::PacketBuffer& buffer,
   sick::datastructure::MonitoringCaseData& monitoring_case_data) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  const uint8_t* data_ptr                                   = vec_ptr->data();
   bool valid                                                = isValid(data_ptr);
   monitoring_case_data.setIsValid(valid);
   if (valid)
   {
     monitoring_case_data.setMonitoringCaseNumber(readMonitoringCaseNumber(data_ptr));
 
-    std::vector<uint16_t> indices;
-    std::vector<bool> fields_valid;
+    std::vector<uint16_t> indices(8);
+    std::vector<bool> fields_valid(8);
     for (uint8_t i = 0; i < 8; i++)
     {
-      indices.push_back(readFieldIndex(data_ptr, i));
-      fields_valid.push_back(readFieldValid(data_ptr, i));
+      indices[i]      = readFieldIndex(data_ptr, i);
+      fields_valid[i] = readFieldValid(data_ptr, i);
     }
-    monitoring_case_data.setFieldIndices(indices);
-    monitoring_case_data.setFieldsValid(fields_valid);
+    monitoring_case_data.setFieldIndices(std::move(indices));
+    monitoring_case_data.setFieldsValid(std::move(fields_valid));
   }
   return true;
 }
 
-bool ParseMonitoringCaseData::isValid(std::vector<uint8_t>::const_iterator data_ptr) const
+bool ParseMonitoringCaseData::isValid(const uint8_t* data_ptr) const
 {
   bool res     = false;
   uint8_t byte = read_write_helper::readUint8(data_ptr + 0);
@@ -79,20 +81,18 @@ bool ParseMonitoringCaseData::isValid(std::vector<uint8_t>::const_iterator data_
   return res;
 }
 
-uint16_t ParseMonitoringCaseData::readMonitoringCaseNumber(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseMonitoringCaseData::readMonitoringCaseNumber(const uint8_t* data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 6);
 }
 
-uint16_t ParseMonitoringCaseData::readFieldIndex(std::vector<uint8_t>::const_iterator data_ptr,
+uint16_t ParseMonitoringCaseData::readFieldIndex(const uint8_t* data_ptr,
                                                  const uint8_t& index) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 158 + (index * 4));
 }
 
-bool ParseMonitoringCaseData::readFieldValid(std::vector<uint8_t>::const_iterator data_ptr,
-                                             const uint8_t& index) const
+bool ParseMonitoringCaseData::readFieldValid(const uint8_t* data_ptr, const uint8_t& index) const
 {
   uint8_t byte = read_write_helper::readUint8(data_ptr + 157 + (index * 4));
 
@@ -46,16 +46,15 @@ bool ParseRequiredUserActionData::parseTCPSequence(
   const datastructure::PacketBuffer& buffer,
   sick::datastructure::RequiredUserAction& required_user_action) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the data pointer valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  const uint8_t* data_ptr                                   = vec_ptr->data();
   readRequiredUserAction(data_ptr, required_user_action);
   return true;
 }
 
 bool ParseRequiredUserActionData::readRequiredUserAction(
-  std::vector<uint8_t>::const_iterator data_ptr,
-  sick::datastructure::RequiredUserAction& required_user_action) const
+  const uint8_t* data_ptr, sick::datastructure::RequiredUserAction& required_user_action) const
 {
   uint16_t word = read_write_helper::readUint16LittleEndian(data_ptr + 0);
 
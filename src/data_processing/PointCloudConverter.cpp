@@ -0,0 +1,407 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file PointCloudConverter.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/PointCloudConverter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define SICK_POINT_CLOUD_X86 1
+#  include <immintrin.h>
+#endif
+
+namespace sick {
+namespace data_processing {
+
+namespace {
+
+static_assert(sizeof(CartesianPoint) == 4 * sizeof(float), "CartesianPoint has to be packed.");
+
+// Scale to meters and the rotation and translation of the transform, shared by all kernels.
+struct KernelParameters
+{
+  float meters_per_unit;
+  float cos_yaw;
+  float sin_yaw;
+  float x;
+  float y;
+};
+
+using PointKernel = void (*)(const uint16_t*,
+                             const uint8_t*,
+                             const float*,
+                             const float*,
+                             std::size_t,
+                             const KernelParameters&,
+                             CartesianPoint*);
+
+// All kernels evaluate the same expressions in the same order, so they give identical results.
+void convertPointsScalar(const uint16_t* distances,
+                         const uint8_t* reflectivities,
+                         const float* cosines,
+                         const float* sines,
+                         std::size_t number_of_points,
+                         const KernelParameters& parameters,
+                         CartesianPoint* points)
+{
+  for (std::size_t i = 0; i < number_of_points; i++)
+  {
+    float range           = static_cast<float>(distances[i]) * parameters.meters_per_unit;
+    float sensor_x        = range * cosines[i];
+    float sensor_y        = range * sines[i];
+    float rotated_x       = parameters.cos_yaw * sensor_x - parameters.sin_yaw * sensor_y;
+    float rotated_y       = parameters.sin_yaw * sensor_x + parameters.cos_yaw * sensor_y;
+    CartesianPoint& point = points[i];
+    point.x               = parameters.x + rotated_x;
+    point.y               = parameters.y + rotated_y;
+    point.z               = 0.0f;
+    point.intensity       = static_cast<float>(reflectivities[i]);
+  }
+}
+
+#ifdef SICK_POINT_CLOUD_X86
+#  ifdef __SSE2__
+// Converts 4 beams per iteration, the coordinates are transposed into points before storing.
+void convertPointsSSE2(const uint16_t* distances,
+                       const uint8_t* reflectivities,
+                       const float* cosines,
+                       const float* sines,
+                       std::size_t number_of_points,
+                       const KernelParameters& parameters,
+                       CartesianPoint* points)
+{
+  const __m128i zero    = _mm_setzero_si128();
+  const __m128 scale    = _mm_set1_ps(parameters.meters_per_unit);
+  const __m128 cos_yaw  = _mm_set1_ps(parameters.cos_yaw);
+  const __m128 sin_yaw  = _mm_set1_ps(parameters.sin_yaw);
+  const __m128 offset_x = _mm_set1_ps(parameters.x);
+  const __m128 offset_y = _mm_set1_ps(parameters.y);
+  std::size_t i         = 0;
+  for (; i + 4 <= number_of_points; i += 4)
+  {
+    __m128i distance = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(distances + i));
+    __m128 range     = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(distance, zero)), scale);
+    int32_t reflectivity_bytes;
+    std::memcpy(&reflectivity_bytes, reflectivities + i, sizeof(reflectivity_bytes));
+    __m128i reflectivity = _mm_unpacklo_epi8(_mm_cvtsi32_si128(reflectivity_bytes), zero);
+
+    __m128 sensor_x = _mm_mul_ps(range, _mm_loadu_ps(cosines + i));
+    __m128 sensor_y = _mm_mul_ps(range, _mm_loadu_ps(sines + i));
+    __m128 x        = _mm_add_ps(
+      offset_x, _mm_sub_ps(_mm_mul_ps(cos_yaw, sensor_x), _mm_mul_ps(sin_yaw, sensor_y)));
+    __m128 y = _mm_add_ps(
+      offset_y, _mm_add_ps(_mm_mul_ps(sin_yaw, sensor_x), _mm_mul_ps(cos_yaw, sensor_y)));
+    __m128 z         = _mm_setzero_ps();
+    __m128 intensity = _mm_cvtepi32_ps(_mm_unpacklo_epi16(reflectivity, zero));
+
+    _MM_TRANSPOSE4_PS(x, y, z, intensity);
+    float* target = &points[i].x;
+    _mm_storeu_ps(target + 0, x);
+    _mm_storeu_ps(target + 4, y);
+    _mm_storeu_ps(target + 8, z);
+    _mm_storeu_ps(target + 12, intensity);
+  }
+  convertPointsScalar(distances + i,
+                      reflectivities + i,
+                      cosines + i,
+                      sines + i,
+                      number_of_points - i,
+                      parameters,
+                      points + i);
+}
+#  endif // __SSE2__
+
+// Same as the SSE2 kernel on 8 beams per iteration. The transpose works within 128 bit lanes, the
+// lanes hold the points 0 to 3 and 4 to 7 which are interleaved again before storing.
+__attribute__((target("avx2"))) void convertPointsAVX2(const uint16_t* distances,
+                                                       const uint8_t* reflectivities,
+                                                       const float* cosines,
+                                                       const float* sines,
+                                                       std::size_t number_of_points,
+                                                       const KernelParameters& parameters,
+                                                       CartesianPoint* points)
+{
+  const __m256 scale    = _mm256_set1_ps(parameters.meters_per_unit);
+  const __m256 cos_yaw  = _mm256_set1_ps(parameters.cos_yaw);
+  const __m256 sin_yaw  = _mm256_set1_ps(parameters.sin_yaw);
+  const __m256 offset_x = _mm256_set1_ps(parameters.x);
+  const __m256 offset_y = _mm256_set1_ps(parameters.y);
+  std::size_t i         = 0;
+  for (; i + 8 <= number_of_points; i += 8)
+  {
+    __m128i distance = _mm_loadu_si128(reinterpret_cast<const __m128i*>(distances + i));
+    __m256 range     = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(distance)), scale);
+    __m128i reflectivity = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(reflectivities + i));
+
+    __m256 sensor_x = _mm256_mul_ps(range, _mm256_loadu_ps(cosines + i));
+    __m256 sensor_y = _mm256_mul_ps(range, _mm256_loadu_ps(sines + i));
+    __m256 x        = _mm256_add_ps(
+      offset_x, _mm256_sub_ps(_mm256_mul_ps(cos_yaw, sensor_x), _mm256_mul_ps(sin_yaw, sensor_y)));
+    __m256 y = _mm256_add_ps(
+      offset_y, _mm256_add_ps(_mm256_mul_ps(sin_yaw, sensor_x), _mm256_mul_ps(cos_yaw, sensor_y)));
+    __m256 z         = _mm256_setzero_ps();
+    __m256 intensity = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(reflectivity));
+
+    __m256 xy_low  = _mm256_unpacklo_ps(x, y);
+    __m256 xy_high = _mm256_unpackhi_ps(x, y);
+    __m256 zi_low  = _mm256_unpacklo_ps(z, intensity);
+    __m256 zi_high = _mm256_unpackhi_ps(z, intensity);
+    __m256 p04     = _mm256_shuffle_ps(xy_low, zi_low, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 p15     = _mm256_shuffle_ps(xy_low, zi_low, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 p26     = _mm256_shuffle_ps(xy_high, zi_high, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 p37     = _mm256_shuffle_ps(xy_high, zi_high, _MM_SHUFFLE(3, 2, 3, 2));
+
+    float* target = &points[i].x;
+    _mm256_storeu_ps(target + 0, _mm256_permute2f128_ps(p04, p15, 0x20));
+    _mm256_storeu_ps(target + 8, _mm256_permute2f128_ps(p26, p37, 0x20));
+    _mm256_storeu_ps(target + 16, _mm256_permute2f128_ps(p04, p15, 0x31));
+    _mm256_storeu_ps(target + 24, _mm256_permute2f128_ps(p26, p37, 0x31));
+  }
+  convertPointsScalar(distances + i,
+                      reflectivities + i,
+                      cosines + i,
+                      sines + i,
+                      number_of_points - i,
+                      parameters,
+                      points + i);
+}
+#endif // SICK_POINT_CLOUD_X86
+
+PointKernel getPointKernel(SimdKernel kernel)
+{
+  switch (kernel)
+  {
+#ifdef SICK_POINT_CLOUD_X86
+    case SimdKernel::AVX2:
+      return convertPointsAVX2;
+#  ifdef __SSE2__
+    case SimdKernel::SSE2:
+      return convertPointsSSE2;
+#  endif
+#endif
+    default:
+      return convertPointsScalar;
+  }
+}
+
+} // namespace
+
+bool TrigTable::Key::operator==(const Key& other) const
+{
+  return start_angle == other.start_angle &&
+         angular_beam_resolution == other.angular_beam_resolution &&
+         number_of_beams == other.number_of_beams;
+}
+
+bool TrigTable::Key::operator<(const Key& other) const
+{
+  if (start_angle != other.start_angle)
+  {
+    return start_angle < other.start_angle;
+  }
+  if (angular_beam_resolution != other.angular_beam_resolution)
+  {
+    return angular_beam_resolution < other.angular_beam_resolution;
+  }
+  return number_of_beams < other.number_of_beams;
+}
+
+TrigTable::TrigTable(const Key& key)
+  : m_key(key)
+  , m_cosines(key.number_of_beams)
+  , m_sines(key.number_of_beams)
+{
+  const double radians_per_degree = std::acos(-1.0) / 180.0;
+  for (uint32_t i = 0; i < key.number_of_beams; i++)
+  {
+    // Same angle as sick::datastructure::MeasurementData::getAngle()
+    float angle  = key.start_angle + static_cast<float>(i) * key.angular_beam_resolution;
+    double theta = static_cast<double>(angle) * radians_per_degree;
+    m_cosines[i] = static_cast<float>(std::cos(theta));
+    m_sines[i]   = static_cast<float>(std::sin(theta));
+  }
+}
+
+std::shared_ptr<const TrigTable> TrigTable::get(const Key& key)
+{
+  // Tables live as long as a converter holds them, the cache itself does not keep them alive.
+  static std::mutex mutex;
+  static std::map<Key, std::weak_ptr<const TrigTable> > tables;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  std::shared_ptr<const TrigTable> table = tables[key].lock();
+  if (!table)
+  {
+    for (auto it = tables.begin(); it != tables.end();)
+    {
+      it = it->second.expired() ? tables.erase(it) : std::next(it);
+    }
+    table       = std::make_shared<const TrigTable>(key);
+    tables[key] = table;
+  }
+  return table;
+}
+
+TrigTable::Key TrigTable::makeKey(const sick::datastructure::DerivedValues& derived_values)
+{
+  Key key;
+  key.start_angle             = derived_values.getStartAngle();
+  key.angular_beam_resolution = derived_values.getAngularBeamResolution();
+  key.number_of_beams         = derived_values.getNumberOfBeams();
+  return key;
+}
+
+TrigTable::Key TrigTable::makeKey(const sick::datastructure::MeasurementData& measurement_data)
+{
+  Key key;
+  key.start_angle             = measurement_data.getStartAngle();
+  key.angular_beam_resolution = measurement_data.getAngularBeamResolution();
+  key.number_of_beams         = measurement_data.getNumberOfBeams();
+  return key;
+}
+
+const TrigTable::Key& TrigTable::getKey() const
+{
+  return m_key;
+}
+
+const float* TrigTable::getCosines() const
+{
+  return m_cosines.data();
+}
+
+const float* TrigTable::getSines() const
+{
+  return m_sines.data();
+}
+
+PointCloudConverter::PointCloudConverter()
+  : m_kernel(getBestSimdKernel())
+{
+}
+
+PointCloudConverter::PointCloudConverter(const PlanarTransform& transform)
+  : m_transform(transform)
+  , m_kernel(getBestSimdKernel())
+{
+}
+
+const PlanarTransform& PointCloudConverter::getTransform() const
+{
+  return m_transform;
+}
+
+void PointCloudConverter::setTransform(const PlanarTransform& transform)
+{
+  m_transform = transform;
+}
+
+SimdKernel PointCloudConverter::getKernel() const
+{
+  return m_kernel;
+}
+
+void PointCloudConverter::setKernel(SimdKernel kernel)
+{
+  m_kernel = isSimdKernelSupported(kernel) ? kernel : SimdKernel::SCALAR;
+}
+
+std::size_t PointCloudConverter::convert(const sick::datastructure::Data& data,
+                                         CartesianPoint* points,
+                                         std::size_t capacity)
+{
+  std::shared_ptr<sick::datastructure::DerivedValues> derived_values = data.getDerivedValuesPtr();
+  std::shared_ptr<sick::datastructure::MeasurementData> measurement_data =
+    data.getMeasurementDataPtr();
+  if (!derived_values || derived_values->isEmpty() || !measurement_data ||
+      measurement_data->isEmpty())
+  {
+    return 0;
+  }
+  // The multiplication factor converts the distances to millimeters
+  float meters_per_unit = static_cast<float>(derived_values->getMultiplicationFactor()) * 0.001f;
+  return convert(*measurement_data, meters_per_unit, points, capacity);
+}
+
+std::size_t
+PointCloudConverter::convert(const sick::datastructure::MeasurementData& measurement_data,
+                             float meters_per_unit,
+                             CartesianPoint* points,
+                             std::size_t capacity)
+{
+  const TrigTable& table = getTrigTable(TrigTable::makeKey(measurement_data));
+  std::size_t number_of_points = std::min<std::size_t>(
+    std::min<std::size_t>(measurement_data.getDistances().size(), table.getKey().number_of_beams),
+    capacity);
+
+  KernelParameters parameters;
+  parameters.meters_per_unit = meters_per_unit;
+  parameters.cos_yaw         = std::cos(m_transform.yaw);
+  parameters.sin_yaw         = std::sin(m_transform.yaw);
+  parameters.x               = m_transform.x;
+  parameters.y               = m_transform.y;
+  getPointKernel(m_kernel)(measurement_data.getDistances().data(),
+                           measurement_data.getReflectivities().data(),
+                           table.getCosines(),
+                           table.getSines(),
+                           number_of_points,
+                           parameters,
+                           points);
+  return number_of_points;
+}
+
+void PointCloudConverter::convert(const sick::datastructure::MeasurementData& measurement_data,
+                                  float meters_per_unit,
+                                  std::vector<CartesianPoint>& points)
+{
+  points.resize(measurement_data.getDistances().size());
+  points.resize(convert(measurement_data, meters_per_unit, points.data(), points.size()));
+}
+
+const TrigTable& PointCloudConverter::getTrigTable(const TrigTable::Key& key)
+{
+  // The shared cache is only consulted when the configuration changes
+  if (!m_trig_table || !(m_trig_table->getKey() == key))
+  {
+    m_trig_table = TrigTable::get(key);
+  }
+  return *m_trig_table;
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -0,0 +1,253 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file PriorityBlockDecoder.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/PriorityBlockDecoder.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace sick {
+namespace data_processing {
+
+namespace {
+
+const sick::types::SensorFeatures SUPPORTED_BLOCKS =
+  sick::SensorDataFeatures::DERIVED_SETTINGS | sick::SensorDataFeatures::GENERAL_SYSTEM_STATE |
+  sick::SensorDataFeatures::APPLICATION_DATA;
+
+/*!
+ * \brief Keeps a block for decoding if it is referenced by nobody else, e.g. by a copy of the data
+ * of a previous data packet. Otherwise a new block is created.
+ */
+template <typename BlockT>
+void recycleBlock(std::shared_ptr<BlockT>& block)
+{
+  if (!block || block.use_count() != 1)
+  {
+    block = std::make_shared<BlockT>();
+  }
+}
+
+} // namespace
+
+PriorityBlockDecoder::PriorityBlockDecoder()
+  : m_blocks(0)
+  , m_has_newest_identification(false)
+  , m_newest_identification(0)
+  , m_is_ready(false)
+{
+}
+
+void PriorityBlockDecoder::setBlocks(sick::types::SensorFeatures blocks)
+{
+  m_blocks                    = blocks & SUPPORTED_BLOCKS;
+  m_has_newest_identification = false;
+  m_is_ready                  = false;
+  for (PacketState& packet : m_packets)
+  {
+    packet.in_use = false;
+  }
+}
+
+sick::types::SensorFeatures PriorityBlockDecoder::getBlocks() const
+{
+  return m_blocks;
+}
+
+void PriorityBlockDecoder::update(const datastructure::PacketBuffer& buffer,
+                                  const datastructure::PacketProgress& progress)
+{
+  PacketState& packet = getPacket(progress.identification, progress.identification_window);
+  if (packet.is_decoded)
+  {
+    return;
+  }
+  Fragment fragment = {progress.fragment_offset, progress.fragment_length};
+  packet.fragments.push_back(fragment);
+
+  if (!packet.has_data_header)
+  {
+    if (!isReceived(packet, 0, sick::datastructure::DataHeader::HEADER_SIZE))
+    {
+      return;
+    }
+    packet.data_header     = m_data_header_parser.parseUDPSequence(buffer, m_data);
+    packet.has_data_header = true;
+  }
+  if (areBlocksReceived(packet))
+  {
+    decodeBlocks(buffer, packet.data_header);
+    packet.is_decoded = true;
+    m_is_ready        = true;
+  }
+}
+
+bool PriorityBlockDecoder::isReady() const
+{
+  return m_is_ready;
+}
+
+const sick::datastructure::Data& PriorityBlockDecoder::takeData()
+{
+  m_is_ready = false;
+  return m_data;
+}
+
+PriorityBlockDecoder::PacketState& PriorityBlockDecoder::getPacket(uint32_t identification,
+                                                                  uint32_t window)
+{
+  // The merger only passes on fragments it accepted, so a packet far behind means it resynced.
+  if (!m_has_newest_identification || m_newest_identification - identification > window)
+  {
+    m_has_newest_identification = true;
+    m_newest_identification     = identification;
+  }
+
+  PacketState* free_packet = nullptr;
+  for (PacketState& packet : m_packets)
+  {
+    if (packet.in_use && packet.identification == identification)
+    {
+      return packet;
+    }
+    if (packet.in_use && m_newest_identification - packet.identification > window)
+    {
+      packet.in_use = false;
+    }
+    if (!packet.in_use && free_packet == nullptr)
+    {
+      free_packet = &packet;
+    }
+  }
+  if (free_packet == nullptr)
+  {
+    m_packets.push_back(PacketState());
+    free_packet = &m_packets.back();
+  }
+  free_packet->in_use          = true;
+  free_packet->identification  = identification;
+  free_packet->has_data_header = false;
+  free_packet->is_decoded      = false;
+  free_packet->fragments.clear();
+  return *free_packet;
+}
+
+bool PriorityBlockDecoder::isReceived(const PacketState& packet,
+                                      uint32_t offset,
+                                      uint32_t length) const
+{
+  // Fragments of a data packet do not overlap, duplicates are dropped by the packet merger
+  uint64_t end      = static_cast<uint64_t>(offset) + length;
+  uint64_t received = 0;
+  for (const Fragment& fragment : packet.fragments)
+  {
+    uint64_t fragment_begin = std::max<uint64_t>(fragment.offset, offset);
+    uint64_t fragment_end =
+      std::min<uint64_t>(static_cast<uint64_t>(fragment.offset) + fragment.length, end);
+    if (fragment_end > fragment_begin)
+    {
+      received += fragment_end - fragment_begin;
+    }
+  }
+  return received >= length;
+}
+
+bool PriorityBlockDecoder::areBlocksReceived(const PacketState& packet) const
+{
+  // Blocks which are not published are empty and need no fragment
+  if (sick::SensorDataFeatures::isFlagSet(m_blocks, sick::SensorDataFeatures::DERIVED_SETTINGS) &&
+      !isReceived(packet,
+                  packet.data_header.getDerivedValuesBlockOffset(),
+                  packet.data_header.getDerivedValuesBlockSize()))
+  {
+    return false;
+  }
+  if (sick::SensorDataFeatures::isFlagSet(m_blocks,
+                                          sick::SensorDataFeatures::GENERAL_SYSTEM_STATE) &&
+      !isReceived(packet,
+                  packet.data_header.getGeneralSystemStateBlockOffset(),
+                  packet.data_header.getGeneralSystemStateBlockSize()))
+  {
+    return false;
+  }
+  if (sick::SensorDataFeatures::isFlagSet(m_blocks, sick::SensorDataFeatures::APPLICATION_DATA) &&
+      !isReceived(packet,
+                  packet.data_header.getApplicationDataBlockOffset(),
+                  packet.data_header.getApplicationDataBlockSize()))
+  {
+    return false;
+  }
+  return true;
+}
+
+void PriorityBlockDecoder::decodeBlocks(const datastructure::PacketBuffer& buffer,
+                                        const datastructure::DataHeader& header)
+{
+  std::shared_ptr<sick::datastructure::DataHeader> data_header = m_data.getDataHeaderPtr();
+  m_data.setDataHeaderPtr(nullptr);
+  recycleBlock(data_header);
+  *data_header = header;
+  m_data.setDataHeaderPtr(data_header);
+
+  if (sick::SensorDataFeatures::isFlagSet(m_blocks, sick::SensorDataFeatures::DERIVED_SETTINGS))
+  {
+    std::shared_ptr<sick::datastructure::DerivedValues> derived_values =
+      m_data.getDerivedValuesPtr();
+    m_data.setDerivedValuesPtr(nullptr);
+    recycleBlock(derived_values);
+    m_derived_values_parser.parseUDPSequence(buffer, m_data, *derived_values);
+    m_data.setDerivedValuesPtr(derived_values);
+  }
+  if (sick::SensorDataFeatures::isFlagSet(m_blocks,
+                                          sick::SensorDataFeatures::GENERAL_SYSTEM_STATE))
+  {
+    std::shared_ptr<sick::datastructure::GeneralSystemState> general_system_state =
+      m_data.getGeneralSystemStatePtr();
+    m_data.setGeneralSystemStatePtr(nullptr);
+    recycleBlock(general_system_state);
+    m_general_system_state_parser.parseUDPSequence(buffer, m_data, *general_system_state);
+    m_data.setGeneralSystemStatePtr(general_system_state);
+  }
+  if (sick::SensorDataFeatures::isFlagSet(m_blocks, sick::SensorDataFeatures::APPLICATION_DATA))
+  {
+    std::shared_ptr<sick::datastructure::ApplicationData> application_data =
+      m_data.getApplicationDataPtr();
+    m_data.setApplicationDataPtr(nullptr);
+    recycleBlock(application_data);
+    m_application_data_parser.parseUDPSequence(buffer, m_data, *application_data);
+    m_data.setApplicationDataPtr(application_data);
+  }
+}
+
+} // namespace data_processing
+} // namespace sick
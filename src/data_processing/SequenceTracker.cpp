@@ -0,0 +1,96 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file SequenceTracker.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/SequenceTracker.h"
+
+namespace sick {
+namespace data_processing {
+
+namespace {
+
+//! Jumps of at least this size are treated as a restart of the sensor.
+const uint32_t RESYNC_DISTANCE = 1024;
+
+uint64_t getMissedNumbers(uint32_t previous, uint32_t current)
+{
+  uint32_t distance = current - previous;
+  if (distance <= 1 || distance >= RESYNC_DISTANCE)
+  {
+    return 0;
+  }
+  return distance - 1;
+}
+
+} // namespace
+
+SequenceTracker::SequenceTracker()
+  : m_has_previous(false)
+  , m_previous_scan_number(0)
+  , m_previous_sequence_number(0)
+  , m_missed_scans(0)
+  , m_missed_sequence_numbers(0)
+{
+}
+
+void SequenceTracker::update(const sick::datastructure::DataHeader& data_header)
+{
+  if (data_header.isEmpty())
+  {
+    return;
+  }
+  uint32_t scan_number     = data_header.getScanNumber();
+  uint32_t sequence_number = data_header.getSequenceNumber();
+  if (m_has_previous)
+  {
+    m_missed_scans.fetch_add(getMissedNumbers(m_previous_scan_number, scan_number),
+                             std::memory_order_relaxed);
+    m_missed_sequence_numbers.fetch_add(
+      getMissedNumbers(m_previous_sequence_number, sequence_number), std::memory_order_relaxed);
+  }
+  m_has_previous             = true;
+  m_previous_scan_number     = scan_number;
+  m_previous_sequence_number = sequence_number;
+}
+
+uint64_t SequenceTracker::getMissedScans() const
+{
+  return m_missed_scans.load(std::memory_order_relaxed);
+}
+
+uint64_t SequenceTracker::getMissedSequenceNumbers() const
+{
+  return m_missed_sequence_numbers.load(std::memory_order_relaxed);
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -0,0 +1,88 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file SimdKernel.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/SimdKernel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define SICK_SIMD_KERNEL_X86 1
+#endif
+
+namespace sick {
+namespace data_processing {
+
+namespace {
+
+SimdKernel selectSimdKernel()
+{
+  if (isSimdKernelSupported(SimdKernel::AVX2))
+  {
+    return SimdKernel::AVX2;
+  }
+  if (isSimdKernelSupported(SimdKernel::SSE2))
+  {
+    return SimdKernel::SSE2;
+  }
+  return SimdKernel::SCALAR;
+}
+
+} // namespace
+
+bool isSimdKernelSupported(SimdKernel kernel)
+{
+  switch (kernel)
+  {
+    case SimdKernel::SCALAR:
+      return true;
+#ifdef SICK_SIMD_KERNEL_X86
+#  ifdef __SSE2__
+    case SimdKernel::SSE2:
+      return true;
+#  endif
+    case SimdKernel::AVX2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+#endif
+    default:
+      return false;
+  }
+}
+
+SimdKernel getBestSimdKernel()
+{
+  static const SimdKernel kernel = selectSimdKernel();
+  return kernel;
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -34,11 +34,36 @@
 
 #include "sick_safetyscanners_base/data_processing/UDPPacketMerger.h"
 
+#include "sick_safetyscanners_base/Logging.h"
+
+#include <algorithm>
+#include <cstring>
+
 namespace sick {
 namespace data_processing {
 
+namespace {
+
+//! Identifications further apart than this are treated as a restart of the sensor.
+const uint32_t RESYNC_DISTANCE = 1024;
+
+//! Consecutive fragments behind the identification window after which the merger resyncs.
+const uint32_t RESYNC_LATE_FRAGMENTS = 8;
+
+} // namespace
+
+const uint32_t UDPPacketMerger::DEFAULT_IDENTIFICATION_WINDOW;
+const int64_t UDPPacketMerger::DEFAULT_MAX_AGE_MS;
+const uint32_t UDPPacketMerger::MAX_PINNED_SLABS;
+
 UDPPacketMerger::UDPPacketMerger()
   : m_is_complete(false)
+  , m_identification_window(DEFAULT_IDENTIFICATION_WINDOW)
+  , m_max_age(DEFAULT_MAX_AGE_MS * 1000000)
+  , m_has_newest_identification(false)
+  , m_newest_identification(0)
+  , m_late_fragments_in_row(0)
+  , m_counters()
 {
 }
 
@@ -54,6 +79,39 @@ sick::datastructure::PacketBuffer UDPPacketMerger::getDeployedPacketBuffer()
   return m_deployed_packet_buffer;
 }
 
+void UDPPacketMerger::setEvictionPolicy(uint32_t identification_window,
+                                        sick::types::time_duration_t max_age)
+{
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+  m_identification_window = identification_window;
+  m_max_age               = max_age.total_nanoseconds();
+}
+
+void UDPPacketMerger::setProgressHandler(const sick::types::PacketProgressHandler& handler)
+{
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+  m_progress_handler = handler;
+}
+
+sick::datastructure::StreamCounters UDPPacketMerger::getCounters() const
+{
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+  sick::datastructure::StreamCounters counters = m_counters;
+  for (const auto& slab : m_slabs)
+  {
+    counters.reserved_bytes += slab.buffer->capacity();
+    if (slab.in_use)
+    {
+      counters.buffered_bytes += slab.total_length;
+    }
+    else if (slab.buffer.use_count() > 1)
+    {
+      counters.pinned_slabs++;
+    }
+  }
+  return counters;
+}
+
 bool UDPPacketMerger::addUDPPacket(const datastructure::PacketBuffer& buffer)
 {
   // Protect the internal memory for duplciate calls
@@ -63,108 +121,295 @@ bool UDPPacketMerger::addUDPPacket(const datastructure::PacketBuffer& buffer)
   {
     m_is_complete = false;
   }
+  m_counters.datagrams++;
+  if (buffer.getLength() < sick::datastructure::DatagramHeader::HEADER_SIZE)
+  {
+    LOG_WARN("Skipping udp packet, it is smaller than the datagram header.");
+    m_counters.invalid_datagrams++;
+    return isComplete();
+  }
   sick::datastructure::DatagramHeader datagram_header;
   sick::data_processing::ParseDatagramHeader datagram_header_parser;
   datagram_header_parser.parseUDPSequence(buffer, datagram_header);
-  addToMap(buffer, datagram_header);
-  deployPacketIfComplete(datagram_header);
+
+  if (isLate(datagram_header))
+  {
+    m_counters.late_fragments++;
+    return isComplete();
+  }
+  evictSlabs(buffer.getReceiveTime());
+
+  ReassemblySlab* slab = findSlab(datagram_header);
+  if (slab == nullptr)
+  {
+    if (isDeployed(datagram_header.getIdentification()))
+    {
+      // A fragment of a packet which was already deployed.
+      m_counters.duplicate_fragments++;
+      return isComplete();
+    }
+    slab = acquireSlab(datagram_header, buffer.getReceiveTime());
+  }
+  if (addToSlab(buffer, datagram_header, *slab))
+  {
+    advanceContiguousLength(*slab);
+    if (m_progress_handler)
+    {
+      reportProgress(*slab);
+    }
+    deployPacketIfComplete(*slab);
+  }
 
   return isComplete();
 }
 
-bool UDPPacketMerger::addToMap(const datastructure::PacketBuffer& buffer,
-                               const datastructure::DatagramHeader& header)
+bool UDPPacketMerger::isLate(const datastructure::DatagramHeader& header)
 {
-  sick::datastructure::ParsedPacketBuffer parsed_packet_buffer(buffer, header);
-  auto it = m_parsed_packet_buffer_map.find(header.getIdentification());
-  if (it != m_parsed_packet_buffer_map.end())
+  uint32_t identification = header.getIdentification();
+  if (!m_has_newest_identification)
   {
-    it->second.push_back(parsed_packet_buffer);
+    m_has_newest_identification = true;
+    m_newest_identification     = identification;
+    return false;
   }
-  else
+  uint32_t ahead = identification - m_newest_identification;
+  if (ahead < RESYNC_DISTANCE)
   {
-    sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector vec;
-    vec.push_back(parsed_packet_buffer);
-    m_parsed_packet_buffer_map[header.getIdentification()] = vec;
+    m_newest_identification = identification;
+    m_late_fragments_in_row = 0;
+    return false;
   }
-  return true;
+  uint32_t behind = m_newest_identification - identification;
+  if (behind <= m_identification_window)
+  {
+    m_late_fragments_in_row = 0;
+    return false;
+  }
+  if (behind < RESYNC_DISTANCE)
+  {
+    // A new packet starting behind the window, or a run of fragments which all are, means the
+    // sensor restarted its counter. Otherwise no scan would be delivered until it catches up.
+    bool starts_packet = header.getFragmentOffset() == 0 && findSlab(header) == nullptr &&
+                         !isDeployed(identification);
+    m_late_fragments_in_row++;
+    if (!starts_packet && m_late_fragments_in_row < RESYNC_LATE_FRAGMENTS)
+    {
+      return true;
+    }
+  }
+  m_newest_identification = identification;
+  m_late_fragments_in_row = 0;
+  return false;
 }
 
-bool UDPPacketMerger::deployPacketIfComplete(datastructure::DatagramHeader& header)
+bool UDPPacketMerger::isDeployed(uint32_t identification) const
 {
-  auto it = m_parsed_packet_buffer_map.find(header.getIdentification());
+  return std::any_of(
+    m_slabs.begin(), m_slabs.end(), [identification](const ReassemblySlab& slab) {
+      return slab.is_completed && slab.identification == identification;
+    });
+}
 
-  if (it == m_parsed_packet_buffer_map.end())
+std::size_t UDPPacketMerger::getMaxSlabs() const
+{
+  // One slab per identification inside the window, including the newest one.
+  return static_cast<std::size_t>(m_identification_window) + 1 + MAX_PINNED_SLABS;
+}
+
+void UDPPacketMerger::evictSlabs(int64_t receive_time)
+{
+  for (auto& slab : m_slabs)
   {
-    return false;
+    if (!slab.in_use)
+    {
+      continue;
+    }
+    uint32_t behind        = m_newest_identification - slab.identification;
+    bool is_outside_window = behind > m_identification_window;
+    bool is_too_old        = receive_time != 0 && slab.first_receive_time != 0 &&
+                      receive_time - slab.first_receive_time > m_max_age;
+    if (is_outside_window || is_too_old)
+    {
+      evictSlab(slab);
+    }
   }
-  if (!checkIfComplete(header))
+}
+
+void UDPPacketMerger::evictSlab(ReassemblySlab& slab)
+{
+  uint32_t missing_length = slab.total_length - slab.received_length;
+  m_counters.evicted_packets++;
+  if (slab.max_fragment_length > 0)
   {
-    return false;
+    m_counters.dropped_fragments +=
+      (missing_length + slab.max_fragment_length - 1) / slab.max_fragment_length;
   }
+  slab.in_use       = false;
+  slab.is_completed = false;
+}
 
-  sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector vec =
-    getSortedParsedPacketBufferForIdentification(header);
-  std::vector<uint8_t> headerless_packet_buffer = removeHeaderFromParsedPacketBuffer(vec);
-  m_deployed_packet_buffer.setBuffer(headerless_packet_buffer);
-  m_parsed_packet_buffer_map.erase(header.getIdentification());
-  return true;
+UDPPacketMerger::ReassemblySlab*
+UDPPacketMerger::findSlab(const datastructure::DatagramHeader& header)
+{
+  for (auto& slab : m_slabs)
+  {
+    if (slab.in_use && slab.identification == header.getIdentification())
+    {
+      return &slab;
+    }
+  }
+  return nullptr;
+}
+
+UDPPacketMerger::ReassemblySlab*
+UDPPacketMerger::acquireSlab(const datastructure::DatagramHeader& header, int64_t receive_time)
+{
+  // A slab can only be reused if no deployed packet buffer still references its memory.
+  auto it = std::find_if(m_slabs.begin(), m_slabs.end(), [](const ReassemblySlab& slab) {
+    return !slab.in_use && slab.buffer.use_count() == 1;
+  });
+  if (it == m_slabs.end() && m_slabs.size() < getMaxSlabs())
+  {
+    ReassemblySlab slab = ReassemblySlab();
+    slab.buffer         = std::make_shared<std::vector<uint8_t>>();
+    m_slabs.push_back(slab);
+    it = m_slabs.end() - 1;
+  }
+  else if (it == m_slabs.end())
+  {
+    // At the bound, a pinned slab leaves its buffer to the consumer. If every slab holds a partial
+    // packet, the packet furthest behind the newest identification makes room.
+    it = std::find_if(m_slabs.begin(), m_slabs.end(), [](const ReassemblySlab& slab) {
+      return !slab.in_use;
+    });
+    if (it != m_slabs.end())
+    {
+      it->buffer = std::make_shared<std::vector<uint8_t>>();
+      m_counters.detached_slabs++;
+    }
+    else
+    {
+      uint32_t newest = m_newest_identification;
+      it              = std::max_element(
+        m_slabs.begin(), m_slabs.end(), [newest](const ReassemblySlab& a, const ReassemblySlab& b) {
+          return newest - a.identification < newest - b.identification;
+        });
+      evictSlab(*it);
+    }
+  }
+
+  it->in_use              = true;
+  it->is_completed        = false;
+  it->identification      = header.getIdentification();
+  it->total_length        = header.getTotalLength();
+  it->received_length     = 0;
+  it->max_fragment_length = 0;
+  it->highest_offset      = 0;
+  it->contiguous_length   = 0;
+  it->first_receive_time  = receive_time;
+  it->fragment_offsets.clear();
+  it->fragment_lengths.clear();
+  it->buffer->resize(header.getTotalLength());
+  return &(*it);
 }
 
-bool UDPPacketMerger::checkIfComplete(sick::datastructure::DatagramHeader& header)
+bool UDPPacketMerger::addToSlab(const datastructure::PacketBuffer& buffer,
+                                const datastructure::DatagramHeader& header,
+                                ReassemblySlab& slab)
 {
-  uint32_t total_length = header.getTotalLength();
-  sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector vec =
-    getSortedParsedPacketBufferForIdentification(header);
-  uint32_t cur_length = calcualteCurrentLengthOfParsedPacketBuffer(vec);
-  if (cur_length != total_length)
+  uint32_t payload_length =
+    buffer.getLength() - sick::datastructure::DatagramHeader::HEADER_SIZE;
+  uint32_t offset = header.getFragmentOffset();
+
+  if (header.getTotalLength() != slab.total_length ||
+      offset + payload_length > slab.total_length)
   {
+    LOG_WARN("Skipping udp packet, the fragment does not fit into the data packet.");
+    m_counters.invalid_datagrams++;
     return false;
   }
-  m_is_complete = true;
+  for (std::size_t i = 0; i < slab.fragment_offsets.size(); i++)
+  {
+    uint32_t other_offset = slab.fragment_offsets[i];
+    uint32_t other_length = slab.fragment_lengths[i];
+    if (offset == other_offset && payload_length == other_length)
+    {
+      // Duplicated fragments would otherwise be counted twice.
+      m_counters.duplicate_fragments++;
+      return false;
+    }
+    if (offset < other_offset + other_length && other_offset < offset + payload_length)
+    {
+      // An overlapping fragment of another length is corrupt, it would complete the packet early.
+      LOG_WARN("Skipping udp packet, the fragment overlaps another fragment of the data packet.");
+      m_counters.invalid_datagrams++;
+      return false;
+    }
+  }
+  if (!slab.fragment_offsets.empty() && offset < slab.highest_offset)
+  {
+    m_counters.out_of_order_fragments++;
+  }
+
+  // Keep our own copy of the shared_ptr to keep the data valid
+  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
+  std::memcpy(slab.buffer->data() + offset,
+              vec_ptr->data() + sick::datastructure::DatagramHeader::HEADER_SIZE,
+              payload_length);
+  slab.fragment_offsets.push_back(offset);
+  slab.fragment_lengths.push_back(payload_length);
+  slab.received_length += payload_length;
+  slab.highest_offset      = std::max(slab.highest_offset, offset);
+  slab.max_fragment_length = std::max(slab.max_fragment_length, payload_length);
   return true;
 }
 
-uint32_t UDPPacketMerger::calcualteCurrentLengthOfParsedPacketBuffer(
-  const sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector& vec)
+void UDPPacketMerger::advanceContiguousLength(ReassemblySlab& slab)
 {
-  uint32_t cur_length = 0;
-
-  for (auto& parsed_packet_buffer : vec)
+  // Fragments usually arrive in order, then the first pass finds the newest one.
+  bool has_advanced = true;
+  while (has_advanced)
   {
-    sick::datastructure::PacketBuffer packet_buffer = parsed_packet_buffer.getPacketBuffer();
-    cur_length += (packet_buffer.getLength() - sick::datastructure::DatagramHeader::HEADER_SIZE);
+    has_advanced = false;
+    for (std::size_t i = 0; i < slab.fragment_offsets.size(); i++)
+    {
+      if (slab.fragment_offsets[i] == slab.contiguous_length && slab.fragment_lengths[i] > 0)
+      {
+        slab.contiguous_length += slab.fragment_lengths[i];
+        has_advanced = true;
+      }
+    }
   }
-  return cur_length;
 }
 
-sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector
-UDPPacketMerger::getSortedParsedPacketBufferForIdentification(
-  const sick::datastructure::DatagramHeader& header)
+void UDPPacketMerger::reportProgress(const ReassemblySlab& slab) const
 {
-  auto it = m_parsed_packet_buffer_map.find(header.getIdentification());
-  sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector vec = it->second;
-  std::sort(
-    vec.begin(), vec.end(), sick::datastructure::ParsedPacketBuffer::sortForIncreasingOffset);
-  return vec;
+  sick::datastructure::PacketBuffer partial_buffer(
+    std::shared_ptr<std::vector<uint8_t> const>(slab.buffer));
+  partial_buffer.setReceiveTime(slab.first_receive_time);
+  sick::datastructure::PacketProgress progress;
+  progress.identification        = slab.identification;
+  progress.fragment_offset       = slab.fragment_offsets.back();
+  progress.fragment_length       = slab.fragment_lengths.back();
+  progress.received_length       = slab.contiguous_length;
+  progress.identification_window = m_identification_window;
+  m_progress_handler(partial_buffer, progress);
 }
 
-std::vector<uint8_t> UDPPacketMerger::removeHeaderFromParsedPacketBuffer(
-  const sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector& vec)
+bool UDPPacketMerger::deployPacketIfComplete(ReassemblySlab& slab)
 {
-  std::vector<uint8_t> headerless_packet_buffer;
-  for (auto& parsed_packet_buffer : vec)
+  if (slab.received_length != slab.total_length)
   {
-    sick::datastructure::PacketBuffer packet_buffer = parsed_packet_buffer.getPacketBuffer();
-
-    // This insert is memory safe because we constructed the buffer in this function
-    const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = packet_buffer.getBuffer();
-    headerless_packet_buffer.insert(headerless_packet_buffer.end(),
-                                    vec_ptr->begin() +
-                                      sick::datastructure::DatagramHeader::HEADER_SIZE,
-                                    vec_ptr->end());
+    return false;
   }
-  return headerless_packet_buffer;
+
+  m_deployed_packet_buffer.setBuffer(std::shared_ptr<std::vector<uint8_t> const>(slab.buffer));
+  m_deployed_packet_buffer.setReceiveTime(slab.first_receive_time);
+  slab.in_use       = false;
+  slab.is_completed = true;
+  m_is_complete     = true;
+  m_counters.completed_packets++;
+  return true;
 }
 
 
@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/ApplicationInputs.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 ApplicationInputs::ApplicationInputs() {}
 
-std::vector<bool> ApplicationInputs::getUnsafeInputsInputSourcesVector() const
+const std::vector<bool>& ApplicationInputs::getUnsafeInputsInputSourcesVector() const
 {
   return m_unsafe_inputs_input_sources_vector;
 }
@@ -50,7 +52,13 @@ void ApplicationInputs::setUnsafeInputsInputSourcesVector(
   m_unsafe_inputs_input_sources_vector = unsafe_inputs_input_sources_vector;
 }
 
-std::vector<bool> ApplicationInputs::getUnsafeInputsFlagsVector() const
+void ApplicationInputs::setUnsafeInputsInputSourcesVector(
+  std::vector<bool>&& unsafe_inputs_input_sources_vector)
+{
+  m_unsafe_inputs_input_sources_vector = std::move(unsafe_inputs_input_sources_vector);
+}
+
+const std::vector<bool>& ApplicationInputs::getUnsafeInputsFlagsVector() const
 {
   return m_unsafe_inputs_flags_vector;
 }
@@ -61,7 +69,12 @@ void ApplicationInputs::setUnsafeInputsFlagsVector(
   m_unsafe_inputs_flags_vector = unsafe_inputs_flags_vector;
 }
 
-std::vector<uint16_t> ApplicationInputs::getMonitoringCasevector() const
+void ApplicationInputs::setUnsafeInputsFlagsVector(std::vector<bool>&& unsafe_inputs_flags_vector)
+{
+  m_unsafe_inputs_flags_vector = std::move(unsafe_inputs_flags_vector);
+}
+
+const std::vector<uint16_t>& ApplicationInputs::getMonitoringCasevector() const
 {
   return m_monitoring_case_vector;
 }
@@ -71,7 +84,12 @@ void ApplicationInputs::setMonitoringCaseVector(const std::vector<uint16_t>& mon
   m_monitoring_case_vector = monitoring_case_vector;
 }
 
-std::vector<bool> ApplicationInputs::getMonitoringCaseFlagsVector() const
+void ApplicationInputs::setMonitoringCaseVector(std::vector<uint16_t>&& monitoring_case_vector)
+{
+  m_monitoring_case_vector = std::move(monitoring_case_vector);
+}
+
+const std::vector<bool>& ApplicationInputs::getMonitoringCaseFlagsVector() const
 {
   return m_monitoring_case_flags_vector;
 }
@@ -82,6 +100,12 @@ void ApplicationInputs::setMonitoringCaseFlagsVector(
   m_monitoring_case_flags_vector = monitoring_case_flags_vector;
 }
 
+void ApplicationInputs::setMonitoringCaseFlagsVector(
+  std::vector<bool>&& monitoring_case_flags_vector)
+{
+  m_monitoring_case_flags_vector = std::move(monitoring_case_flags_vector);
+}
+
 int16_t ApplicationInputs::getVelocity0() const
 {
   return m_velocity_0;
@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/ApplicationOutputs.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 ApplicationOutputs::ApplicationOutputs() {}
 
-std::vector<bool> ApplicationOutputs::getEvalOutVector() const
+const std::vector<bool>& ApplicationOutputs::getEvalOutVector() const
 {
   return m_eval_out_vector;
 }
@@ -49,7 +51,12 @@ void ApplicationOutputs::setEvalOutVector(const std::vector<bool>& eval_out_vect
   m_eval_out_vector = eval_out_vector;
 }
 
-std::vector<bool> ApplicationOutputs::getEvalOutIsSafeVector() const
+void ApplicationOutputs::setEvalOutVector(std::vector<bool>&& eval_out_vector)
+{
+  m_eval_out_vector = std::move(eval_out_vector);
+}
+
+const std::vector<bool>& ApplicationOutputs::getEvalOutIsSafeVector() const
 {
   return m_eval_out_is_safe_vector;
 }
@@ -59,7 +66,12 @@ void ApplicationOutputs::setEvalOutIsSafeVector(const std::vector<bool>& eval_ou
   m_eval_out_is_safe_vector = eval_out_is_safe_vector;
 }
 
-std::vector<bool> ApplicationOutputs::getEvalOutIsValidVector() const
+void ApplicationOutputs::setEvalOutIsSafeVector(std::vector<bool>&& eval_out_is_safe_vector)
+{
+  m_eval_out_is_safe_vector = std::move(eval_out_is_safe_vector);
+}
+
+const std::vector<bool>& ApplicationOutputs::getEvalOutIsValidVector() const
 {
   return m_eval_out_is_valid_vector;
 }
@@ -69,7 +81,12 @@ void ApplicationOutputs::setEvalOutIsValidVector(const std::vector<bool>& eval_o
   m_eval_out_is_valid_vector = eval_out_is_valid_vector;
 }
 
-std::vector<uint16_t> ApplicationOutputs::getMonitoringCaseVector() const
+void ApplicationOutputs::setEvalOutIsValidVector(std::vector<bool>&& eval_out_is_valid_vector)
+{
+  m_eval_out_is_valid_vector = std::move(eval_out_is_valid_vector);
+}
+
+const std::vector<uint16_t>& ApplicationOutputs::getMonitoringCaseVector() const
 {
   return m_monitoring_case_vector;
 }
@@ -80,7 +97,12 @@ void ApplicationOutputs::setMonitoringCaseVector(
   m_monitoring_case_vector = monitoring_case_vector;
 }
 
-std::vector<bool> ApplicationOutputs::getMonitoringCaseFlagsVector() const
+void ApplicationOutputs::setMonitoringCaseVector(std::vector<uint16_t>&& monitoring_case_vector)
+{
+  m_monitoring_case_vector = std::move(monitoring_case_vector);
+}
+
+const std::vector<bool>& ApplicationOutputs::getMonitoringCaseFlagsVector() const
 {
   return m_monitoring_case_flags_vector;
 }
@@ -91,6 +113,12 @@ void ApplicationOutputs::setMonitoringCaseFlagsVector(
   m_monitoring_case_flags_vector = monitoring_case_flags_vector;
 }
 
+void ApplicationOutputs::setMonitoringCaseFlagsVector(
+  std::vector<bool>&& monitoring_case_flags_vector)
+{
+  m_monitoring_case_flags_vector = std::move(monitoring_case_flags_vector);
+}
+
 int8_t ApplicationOutputs::getSleepModeOutput() const
 {
   return m_sleep_mode_output;
@@ -224,7 +252,7 @@ void ApplicationOutputs::setVelocity1TransmittedSafely(bool velocity_1_transmitt
   m_velocity_1_transmitted_safely = velocity_1_transmitted_safely;
 }
 
-std::vector<int16_t> ApplicationOutputs::getResultingVelocityVector() const
+const std::vector<int16_t>& ApplicationOutputs::getResultingVelocityVector() const
 {
   return m_resulting_velocity_vector;
 }
@@ -235,7 +263,13 @@ void ApplicationOutputs::setResultingVelocityVector(
   m_resulting_velocity_vector = resulting_velocity_vector;
 }
 
-std::vector<bool> ApplicationOutputs::getResultingVelocityIsValidVector() const
+void ApplicationOutputs::setResultingVelocityVector(
+  std::vector<int16_t>&& resulting_velocity_vector)
+{
+  m_resulting_velocity_vector = std::move(resulting_velocity_vector);
+}
+
+const std::vector<bool>& ApplicationOutputs::getResultingVelocityIsValidVector() const
 {
   return m_resulting_velocity_is_valid_vector;
 }
@@ -246,6 +280,12 @@ void ApplicationOutputs::setResultingVelocityIsValidVector(
   m_resulting_velocity_is_valid_vector = resulting_velocity_is_valid_vector;
 }
 
+void ApplicationOutputs::setResultingVelocityIsValidVector(
+  std::vector<bool>&& resulting_velocity_is_valid_vector)
+{
+  m_resulting_velocity_is_valid_vector = std::move(resulting_velocity_is_valid_vector);
+}
+
 bool ApplicationOutputs::getFlagsSleepModeOutputIsValid() const
 {
   return m_flags_sleep_mode_output_is_valid;
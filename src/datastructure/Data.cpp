@@ -34,10 +34,16 @@
 
 #include "sick_safetyscanners_base/datastructure/Data.h"
 
+#include "sick_safetyscanners_base/Types.h"
+
 namespace sick {
 namespace datastructure {
 
-Data::Data() {}
+Data::Data()
+  : m_receive_time(0)
+  , m_lazy_blocks(0)
+{
+}
 
 std::shared_ptr<DataHeader> Data::getDataHeaderPtr() const
 {
@@ -52,55 +58,112 @@ void Data::setDataHeaderPtr(const std::shared_ptr<DataHeader>& data_header_ptr)
 
 std::shared_ptr<GeneralSystemState> Data::getGeneralSystemStatePtr() const
 {
+  loadBlock(sick::SensorDataFeatures::GENERAL_SYSTEM_STATE);
   return m_general_system_state_ptr;
 }
 
 void Data::setGeneralSystemStatePtr(
   const std::shared_ptr<GeneralSystemState>& general_system_state_ptr)
 {
+  m_lazy_blocks &= ~sick::SensorDataFeatures::GENERAL_SYSTEM_STATE;
   m_general_system_state_ptr = general_system_state_ptr;
 }
 
 std::shared_ptr<DerivedValues> Data::getDerivedValuesPtr() const
 {
+  loadBlock(sick::SensorDataFeatures::DERIVED_SETTINGS);
   return m_derived_values_ptr;
 }
 
 void Data::setDerivedValuesPtr(const std::shared_ptr<DerivedValues>& derived_values_ptr)
 {
+  m_lazy_blocks &= ~sick::SensorDataFeatures::DERIVED_SETTINGS;
   m_derived_values_ptr = derived_values_ptr;
 }
 
 std::shared_ptr<MeasurementData> Data::getMeasurementDataPtr() const
 {
+  loadBlock(sick::SensorDataFeatures::MEASUREMENT_DATA);
   return m_measurement_data_ptr;
 }
 
 void Data::setMeasurementDataPtr(const std::shared_ptr<MeasurementData>& measurement_data_ptr)
 {
+  m_lazy_blocks &= ~sick::SensorDataFeatures::MEASUREMENT_DATA;
   m_measurement_data_ptr = measurement_data_ptr;
 }
 
 std::shared_ptr<IntrusionData> Data::getIntrusionDataPtr() const
 {
+  loadBlock(sick::SensorDataFeatures::INTRUSION_DATA);
   return m_intrusion_data_ptr;
 }
 
 void Data::setIntrusionDataPtr(const std::shared_ptr<IntrusionData>& intrusion_data_ptr)
 {
+  m_lazy_blocks &= ~sick::SensorDataFeatures::INTRUSION_DATA;
   m_intrusion_data_ptr = intrusion_data_ptr;
 }
 
 std::shared_ptr<ApplicationData> Data::getApplicationDataPtr() const
 {
+  loadBlock(sick::SensorDataFeatures::APPLICATION_DATA);
   return m_application_data_ptr;
 }
 
 void Data::setApplicationDataPtr(const std::shared_ptr<ApplicationData>& application_data_ptr)
 {
+  m_lazy_blocks &= ~sick::SensorDataFeatures::APPLICATION_DATA;
   m_application_data_ptr = application_data_ptr;
 }
 
+int64_t Data::getReceiveTime() const
+{
+  return m_receive_time;
+}
+
+void Data::setReceiveTime(int64_t receive_time)
+{
+  m_receive_time = receive_time;
+}
+
+void Data::setLazyBlocks(uint16_t blocks, const BlockLoader& loader)
+{
+  // Recycled instances keep their mutex, copies sharing it only serialize their block loading.
+  if (!m_lazy_mutex && blocks != 0)
+  {
+    m_lazy_mutex = std::make_shared<std::recursive_mutex>();
+  }
+  m_lazy_blocks  = blocks;
+  m_block_loader = loader;
+}
+
+uint16_t Data::getLazyBlocks() const
+{
+  if (!m_lazy_mutex)
+  {
+    return 0;
+  }
+  std::lock_guard<std::recursive_mutex> lock(*m_lazy_mutex);
+  return m_lazy_blocks;
+}
+
+void Data::loadBlock(uint16_t block) const
+{
+  if (!m_lazy_mutex)
+  {
+    return;
+  }
+  // Recursive, since parsing a block may access other deferred blocks it depends on.
+  std::lock_guard<std::recursive_mutex> lock(*m_lazy_mutex);
+  if ((m_lazy_blocks & block) == 0)
+  {
+    return;
+  }
+  m_lazy_blocks &= ~block;
+  // Only the mutable block members are modified through this reference.
+  m_block_loader(block, const_cast<Data&>(*this));
+}
 
 } // namespace datastructure
 } // namespace sick
@@ -0,0 +1,190 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataPool.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/DataPool.h"
+
+#include <atomic>
+#include <type_traits>
+
+namespace sick {
+namespace datastructure {
+
+const std::size_t DataPool::DEFAULT_MAX_SIZE;
+
+namespace {
+
+/*!
+ * \brief Size of the storage for the control block of a handed out reference, larger than the
+ * control blocks of the common standard libraries.
+ */
+const std::size_t CONTROL_BLOCK_SIZE = 128;
+
+} // namespace
+
+/*!
+ * \brief Entry of the pool, holding the instance and the storage of the control block of its handed
+ * out reference.
+ */
+struct DataPool::Slot
+{
+  Data data;
+  std::atomic<bool> checked_out{false};
+  std::aligned_storage<CONTROL_BLOCK_SIZE, alignof(std::max_align_t)>::type control_block;
+};
+
+/*!
+ * \brief Deleter of a handed out instance, called once its last reference is dropped.
+ */
+struct DataPool::Returner
+{
+  void operator()(Data* data) const
+  {
+    // Nobody can access the instance anymore, deferred blocks may release the raw packet buffer
+    data->setLazyBlocks(0, Data::BlockLoader());
+  }
+};
+
+/*!
+ * \brief Allocator of the control block of a handed out reference, which places it into the
+ * storage of the slot. Releasing the control block checks the slot in again. The allocator keeps
+ * the slot alive, so that instances dropped from the pool while checked out are freed afterwards.
+ */
+template <typename T>
+struct DataPool::SlotAllocator
+{
+  typedef T value_type;
+
+  explicit SlotAllocator(const std::shared_ptr<Slot>& slot)
+    : m_slot(slot)
+  {
+  }
+
+  template <typename U>
+  SlotAllocator(const SlotAllocator<U>& other)
+    : m_slot(other.m_slot)
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    if (n * sizeof(T) <= sizeof(m_slot->control_block) && alignof(T) <= alignof(std::max_align_t))
+    {
+      return static_cast<T*>(static_cast<void*>(&m_slot->control_block));
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* pointer, std::size_t)
+  {
+    if (static_cast<void*>(pointer) != static_cast<void*>(&m_slot->control_block))
+    {
+      ::operator delete(pointer);
+    }
+    m_slot->checked_out.store(false, std::memory_order_release);
+  }
+
+  template <typename U>
+  bool operator==(const SlotAllocator<U>& other) const
+  {
+    return m_slot == other.m_slot;
+  }
+
+  template <typename U>
+  bool operator!=(const SlotAllocator<U>& other) const
+  {
+    return m_slot != other.m_slot;
+  }
+
+  std::shared_ptr<Slot> m_slot;
+};
+
+DataPool::DataPool(std::size_t max_size)
+  : m_max_size(max_size)
+{
+  m_slots.reserve(max_size);
+}
+
+std::shared_ptr<Data> DataPool::acquire()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const std::shared_ptr<Slot>& slot : m_slots)
+  {
+    if (!slot->checked_out.load(std::memory_order_acquire))
+    {
+      return checkOut(slot);
+    }
+  }
+  if (m_slots.size() < m_max_size)
+  {
+    m_slots.push_back(std::make_shared<Slot>());
+    return checkOut(m_slots.back());
+  }
+  return std::make_shared<Data>();
+}
+
+std::shared_ptr<Data> DataPool::checkOut(const std::shared_ptr<Slot>& slot)
+{
+  slot->checked_out.store(true, std::memory_order_relaxed);
+  return std::shared_ptr<Data>(&slot->data, Returner(), SlotAllocator<Data>(slot));
+}
+
+void DataPool::release(std::shared_ptr<Data>& data)
+{
+  data.reset();
+}
+
+std::size_t DataPool::getSize() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_slots.size();
+}
+
+std::size_t DataPool::getMaxSize() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_max_size;
+}
+
+void DataPool::setMaxSize(std::size_t max_size)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_max_size = max_size;
+  if (m_slots.size() > max_size)
+  {
+    m_slots.erase(m_slots.begin() + max_size, m_slots.end());
+  }
+  m_slots.reserve(max_size);
+}
+
+} // namespace datastructure
+} // namespace sick
@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/datastructure/FieldData.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
@@ -180,7 +182,7 @@ void FieldData::setIsProtectiveField(bool is_protective_field)
   m_is_protective_field = is_protective_field;
 }
 
-std::vector<uint16_t> FieldData::getBeamDistances() const
+const std::vector<uint16_t>& FieldData::getBeamDistances() const
 {
   return m_beam_distances;
 }
@@ -190,6 +192,11 @@ void FieldData::setBeamDistances(const std::vector<uint16_t>& beam_distances)
   m_beam_distances = beam_distances;
 }
 
+void FieldData::setBeamDistances(std::vector<uint16_t>&& beam_distances)
+{
+  m_beam_distances = std::move(beam_distances);
+}
+
 float FieldData::getStartAngle() const
 {
   return m_start_angle;
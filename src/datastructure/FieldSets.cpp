@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/datastructure/FieldSets.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
@@ -79,7 +81,7 @@ void FieldSets::setVersionReleaseNumber(const uint8_t& version_release_number)
   m_version_release_number = version_release_number;
 }
 
-std::vector<uint32_t> FieldSets::getNameLength() const
+const std::vector<uint32_t>& FieldSets::getNameLength() const
 {
   return m_name_length;
 }
@@ -89,7 +91,12 @@ void FieldSets::setNameLength(const std::vector<uint32_t>& name_length)
   m_name_length = name_length;
 }
 
-std::vector<std::string> FieldSets::getFieldName() const
+void FieldSets::setNameLength(std::vector<uint32_t>&& name_length)
+{
+  m_name_length = std::move(name_length);
+}
+
+const std::vector<std::string>& FieldSets::getFieldName() const
 {
   return m_field_name;
 }
@@ -99,7 +106,12 @@ void FieldSets::setFieldName(const std::vector<std::string>& field_name)
   m_field_name = field_name;
 }
 
-std::vector<bool> FieldSets::getIsDefined() const
+void FieldSets::setFieldName(std::vector<std::string>&& field_name)
+{
+  m_field_name = std::move(field_name);
+}
+
+const std::vector<bool>& FieldSets::getIsDefined() const
 {
   return m_is_defined;
 }
@@ -109,5 +121,10 @@ void FieldSets::setIsDefined(const std::vector<bool>& is_defined)
   m_is_defined = is_defined;
 }
 
+void FieldSets::setIsDefined(std::vector<bool>&& is_defined)
+{
+  m_is_defined = std::move(is_defined);
+}
+
 } // namespace datastructure
 } // namespace sick
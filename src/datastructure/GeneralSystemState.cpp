@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/datastructure/GeneralSystemState.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
@@ -102,7 +104,7 @@ void GeneralSystemState::setManipulationStatus(bool manipulation_status)
   m_manipulation_status = manipulation_status;
 }
 
-std::vector<bool> GeneralSystemState::getSafeCutOffPathVector() const
+const std::vector<bool>& GeneralSystemState::getSafeCutOffPathVector() const
 {
   return m_safe_cut_off_path_vector;
 }
@@ -112,7 +114,12 @@ void GeneralSystemState::setSafeCutOffPathvector(const std::vector<bool>& safe_c
   m_safe_cut_off_path_vector = safe_cut_off_path_vector;
 }
 
-std::vector<bool> GeneralSystemState::getNonSafeCutOffPathVector() const
+void GeneralSystemState::setSafeCutOffPathvector(std::vector<bool>&& safe_cut_off_path_vector)
+{
+  m_safe_cut_off_path_vector = std::move(safe_cut_off_path_vector);
+}
+
+const std::vector<bool>& GeneralSystemState::getNonSafeCutOffPathVector() const
 {
   return m_non_safe_cut_off_path_vector;
 }
@@ -123,7 +130,13 @@ void GeneralSystemState::setNonSafeCutOffPathVector(
   m_non_safe_cut_off_path_vector = non_safe_cut_off_path_vector;
 }
 
-std::vector<bool> GeneralSystemState::getResetRequiredCutOffPathVector() const
+void GeneralSystemState::setNonSafeCutOffPathVector(
+  std::vector<bool>&& non_safe_cut_off_path_vector)
+{
+  m_non_safe_cut_off_path_vector = std::move(non_safe_cut_off_path_vector);
+}
+
+const std::vector<bool>& GeneralSystemState::getResetRequiredCutOffPathVector() const
 {
   return m_reset_required_cut_off_path_vector;
 }
@@ -134,6 +147,12 @@ void GeneralSystemState::setResetRequiredCutOffPathVector(
   m_reset_required_cut_off_path_vector = reset_required_cut_off_path_vector;
 }
 
+void GeneralSystemState::setResetRequiredCutOffPathVector(
+  std::vector<bool>&& reset_required_cut_off_path_vector)
+{
+  m_reset_required_cut_off_path_vector = std::move(reset_required_cut_off_path_vector);
+}
+
 uint8_t GeneralSystemState::getCurrentMonitoringCaseNoTable1() const
 {
   return m_current_monitoring_case_no_table_1;
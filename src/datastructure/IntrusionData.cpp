@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/datastructure/IntrusionData.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
@@ -42,7 +44,7 @@ IntrusionData::IntrusionData()
 {
 }
 
-std::vector<IntrusionDatum> IntrusionData::getIntrusionDataVector() const
+const std::vector<IntrusionDatum>& IntrusionData::getIntrusionDataVector() const
 {
   return m_intrusion_data_vector;
 }
@@ -52,6 +54,11 @@ void IntrusionData::setIntrusionDataVector(const std::vector<IntrusionDatum>& in
   m_intrusion_data_vector = intrusion_data_vector;
 }
 
+void IntrusionData::setIntrusionDataVector(std::vector<IntrusionDatum>&& intrusion_data_vector)
+{
+  m_intrusion_data_vector = std::move(intrusion_data_vector);
+}
+
 bool IntrusionData::isEmpty() const
 {
   return m_is_empty;
@@ -34,11 +34,53 @@
 
 #include "sick_safetyscanners_base/datastructure/IntrusionDatum.h"
 
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+
+#include <algorithm>
+#include <cstring>
+
 namespace sick {
 namespace datastructure {
 
+namespace {
+
+std::size_t popcount(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+  std::size_t count = 0;
+  for (; word != 0; word &= word - 1)
+  {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+std::size_t countTrailingZeros(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+  std::size_t count = 0;
+  for (; (word & 0x01) == 0; word >>= 1)
+  {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+} // namespace
 
-IntrusionDatum::IntrusionDatum() {}
+const std::size_t IntrusionDatum::NO_FLAG;
+
+IntrusionDatum::IntrusionDatum()
+  : m_size(0)
+  , m_number_of_flags(0)
+{
+}
 
 int32_t IntrusionDatum::getSize() const
 {
@@ -52,12 +94,101 @@ void IntrusionDatum::setSize(const int32_t& size)
 
 std::vector<bool> IntrusionDatum::getFlagsVector() const
 {
-  return m_flags_vector;
+  std::vector<bool> flags_vector(m_number_of_flags);
+  for (std::size_t i = 0; i < m_number_of_flags; ++i)
+  {
+    flags_vector[i] = isFlagSet(i);
+  }
+  return flags_vector;
 }
 
 void IntrusionDatum::setFlagsVector(const std::vector<bool>& flags_vector)
 {
-  m_flags_vector = flags_vector;
+  resizeFlags(flags_vector.size());
+  std::fill(m_flag_words.begin(), m_flag_words.end(), 0);
+  for (std::size_t i = 0; i < flags_vector.size(); ++i)
+  {
+    if (flags_vector[i])
+    {
+      m_flag_words[i / 64] |= static_cast<uint64_t>(1) << (i % 64);
+    }
+  }
+}
+
+void IntrusionDatum::setFlags(const uint8_t* bytes, std::size_t number_of_flags)
+{
+  resizeFlags(number_of_flags);
+  if (m_flag_words.empty())
+  {
+    return;
+  }
+  std::size_t num_bytes = (number_of_flags + 7) / 8;
+  // The wire format is little endian, so the bytes are already the words on such hosts.
+  m_flag_words.back() = 0;
+  std::memcpy(m_flag_words.data(), bytes, num_bytes);
+  if (!read_write_helper::HOST_IS_LITTLE_ENDIAN)
+  {
+    for (std::size_t i = 0; i < m_flag_words.size(); ++i)
+    {
+      m_flag_words[i] = read_write_helper::detail::byteSwap(m_flag_words[i]);
+    }
+  }
+  std::size_t tail_bits = number_of_flags % 64;
+  if (tail_bits != 0)
+  {
+    m_flag_words.back() &= (static_cast<uint64_t>(1) << tail_bits) - 1;
+  }
+}
+
+std::size_t IntrusionDatum::getNumberOfFlags() const
+{
+  return m_number_of_flags;
+}
+
+Span<const uint64_t> IntrusionDatum::getFlagWords() const
+{
+  return Span<const uint64_t>(m_flag_words.data(), m_flag_words.size());
+}
+
+std::size_t IntrusionDatum::countFlags() const
+{
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < m_flag_words.size(); ++i)
+  {
+    count += popcount(m_flag_words[i]);
+  }
+  return count;
+}
+
+std::size_t IntrusionDatum::findNextFlag(std::size_t from) const
+{
+  if (from >= m_number_of_flags)
+  {
+    return NO_FLAG;
+  }
+  std::size_t word_index = from / 64;
+  // Clear the bits in front of the start index in the first word.
+  uint64_t word = m_flag_words[word_index] & (~static_cast<uint64_t>(0) << (from % 64));
+  while (word == 0)
+  {
+    if (++word_index == m_flag_words.size())
+    {
+      return NO_FLAG;
+    }
+    word = m_flag_words[word_index];
+  }
+  return word_index * 64 + countTrailingZeros(word);
+}
+
+std::size_t IntrusionDatum::findFirstFlag() const
+{
+  return findNextFlag(0);
+}
+
+void IntrusionDatum::resizeFlags(std::size_t number_of_flags)
+{
+  m_number_of_flags = number_of_flags;
+  m_flag_words.resize((number_of_flags + 63) / 64);
 }
 
 } // namespace datastructure
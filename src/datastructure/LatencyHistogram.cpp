@@ -0,0 +1,175 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file LatencyHistogram.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace sick {
+namespace datastructure {
+
+const uint32_t LatencyHistogram::SUB_BUCKET_BITS;
+const std::size_t LatencyHistogram::BUCKET_COUNT;
+
+namespace {
+
+const int64_t SUB_BUCKET_COUNT = 1 << LatencyHistogram::SUB_BUCKET_BITS;
+
+int getMostSignificantBit(uint64_t value)
+{
+#if defined(__GNUC__)
+  return 63 - __builtin_clzll(value);
+#else
+  int bit = 0;
+  while (value >>= 1)
+  {
+    bit++;
+  }
+  return bit;
+#endif
+}
+
+} // namespace
+
+LatencyHistogram::LatencyHistogram()
+{
+  reset();
+}
+
+void LatencyHistogram::record(int64_t value)
+{
+  if (value < 0)
+  {
+    return;
+  }
+  m_counts[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  m_total_count.fetch_add(1, std::memory_order_relaxed);
+  m_sum.fetch_add(value, std::memory_order_relaxed);
+
+  int64_t min = m_min.load(std::memory_order_relaxed);
+  while (value < min && !m_min.compare_exchange_weak(min, value, std::memory_order_relaxed))
+  {
+  }
+  int64_t max = m_max.load(std::memory_order_relaxed);
+  while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+int64_t LatencyHistogram::getValueAtPercentile(double percentile) const
+{
+  uint64_t count = m_total_count.load(std::memory_order_relaxed);
+  if (count == 0)
+  {
+    return 0;
+  }
+  percentile    = std::min(std::max(percentile, 0.0), 100.0);
+  uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * count));
+  return getValueAtRank(std::max<uint64_t>(rank, 1));
+}
+
+LatencySummary LatencyHistogram::getSummary() const
+{
+  LatencySummary summary = LatencySummary();
+  summary.count          = m_total_count.load(std::memory_order_relaxed);
+  if (summary.count == 0)
+  {
+    return summary;
+  }
+  summary.min  = m_min.load(std::memory_order_relaxed);
+  summary.max  = m_max.load(std::memory_order_relaxed);
+  summary.mean = static_cast<double>(m_sum.load(std::memory_order_relaxed)) / summary.count;
+  summary.p50  = getValueAtPercentile(50.0);
+  summary.p90  = getValueAtPercentile(90.0);
+  summary.p99  = getValueAtPercentile(99.0);
+  summary.p999 = getValueAtPercentile(99.9);
+  return summary;
+}
+
+void LatencyHistogram::reset()
+{
+  for (std::size_t i = 0; i < BUCKET_COUNT; i++)
+  {
+    m_counts[i].store(0, std::memory_order_relaxed);
+  }
+  m_total_count.store(0, std::memory_order_relaxed);
+  m_sum.store(0, std::memory_order_relaxed);
+  m_min.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+  m_max.store(0, std::memory_order_relaxed);
+}
+
+std::size_t LatencyHistogram::getBucketIndex(int64_t value)
+{
+  if (value < 2 * SUB_BUCKET_COUNT)
+  {
+    return static_cast<std::size_t>(value);
+  }
+  // Values in [2^k, 2^(k + 1)) share the shift k - SUB_BUCKET_BITS and are split into
+  // SUB_BUCKET_COUNT buckets of equal width.
+  int shift         = getMostSignificantBit(value) - SUB_BUCKET_BITS;
+  std::size_t index = (shift + 1) * SUB_BUCKET_COUNT + ((value >> shift) - SUB_BUCKET_COUNT);
+  return std::min(index, BUCKET_COUNT - 1);
+}
+
+int64_t LatencyHistogram::getBucketValue(std::size_t index)
+{
+  if (index < static_cast<std::size_t>(2 * SUB_BUCKET_COUNT))
+  {
+    return static_cast<int64_t>(index);
+  }
+  int shift     = static_cast<int>(index / SUB_BUCKET_COUNT) - 1;
+  int64_t lower = (static_cast<int64_t>(index % SUB_BUCKET_COUNT) + SUB_BUCKET_COUNT) << shift;
+  // Middle of the bucket, which halves the worst case error.
+  return lower + ((int64_t(1) << shift) >> 1);
+}
+
+int64_t LatencyHistogram::getValueAtRank(uint64_t rank) const
+{
+  uint64_t cumulative = 0;
+  for (std::size_t i = 0; i < BUCKET_COUNT; i++)
+  {
+    cumulative += m_counts[i].load(std::memory_order_relaxed);
+    if (cumulative >= rank)
+    {
+      int64_t value = getBucketValue(i);
+      return std::min(std::max(value, m_min.load(std::memory_order_relaxed)),
+                      m_max.load(std::memory_order_relaxed));
+    }
+  }
+  return m_max.load(std::memory_order_relaxed);
+}
+
+} // namespace datastructure
+} // namespace sick
@@ -40,6 +40,10 @@ namespace datastructure {
 
 MeasurementData::MeasurementData()
   : m_is_empty(false)
+  , m_number_of_beams(0)
+  , m_has_angles(false)
+  , m_start_angle(0.0f)
+  , m_angular_beam_resolution(0.0f)
 {
 }
 
@@ -55,12 +59,125 @@ void MeasurementData::setNumberOfBeams(const uint32_t& number_of_beams)
 
 std::vector<ScanPoint> MeasurementData::getScanPointsVector() const
 {
-  return m_scan_points_vector;
+  std::vector<ScanPoint> scan_points;
+  scan_points.reserve(m_distances.size());
+  for (std::size_t i = 0; i < m_distances.size(); i++)
+  {
+    uint16_t distance          = m_distances[i];
+    uint8_t reflectivity       = m_reflectivities[i];
+    uint8_t status             = m_status_bits[i];
+    bool valid                 = status & ScanPointStatusBits::VALID;
+    bool infinite              = status & ScanPointStatusBits::INFINITE;
+    bool glare                 = status & ScanPointStatusBits::GLARE;
+    bool reflector             = status & ScanPointStatusBits::REFLECTOR;
+    bool contamination         = status & ScanPointStatusBits::CONTAMINATION;
+    bool contamination_warning = status & ScanPointStatusBits::CONTAMINATION_WARNING;
+    scan_points.push_back(ScanPoint(getAngle(i),
+                                    distance,
+                                    reflectivity,
+                                    valid,
+                                    infinite,
+                                    glare,
+                                    reflector,
+                                    contamination,
+                                    contamination_warning));
+  }
+  return scan_points;
 }
 
 void MeasurementData::addScanPoint(ScanPoint scan_point)
 {
-  m_scan_points_vector.push_back(scan_point);
+  // Without setAngles() the beam grid follows from the first two scanpoints
+  if (!m_has_angles && m_distances.empty())
+  {
+    m_start_angle = scan_point.getAngle();
+  }
+  else if (!m_has_angles && m_distances.size() == 1)
+  {
+    m_angular_beam_resolution = scan_point.getAngle() - m_start_angle;
+  }
+  uint8_t status = (scan_point.getValidBit() ? ScanPointStatusBits::VALID : 0) |
+                   (scan_point.getInfiniteBit() ? ScanPointStatusBits::INFINITE : 0) |
+                   (scan_point.getGlareBit() ? ScanPointStatusBits::GLARE : 0) |
+                   (scan_point.getReflectorBit() ? ScanPointStatusBits::REFLECTOR : 0) |
+                   (scan_point.getContaminationBit() ? ScanPointStatusBits::CONTAMINATION : 0) |
+                   (scan_point.getContaminationWarningBit()
+                      ? ScanPointStatusBits::CONTAMINATION_WARNING
+                      : 0);
+  addBeam(scan_point.getDistance(), scan_point.getReflectivity(), status);
+}
+
+void MeasurementData::addBeam(uint16_t distance, uint8_t reflectivity, uint8_t status_bits)
+{
+  if (m_distances.empty())
+  {
+    // The number of beams is announced before the beams are added
+    reserve(m_number_of_beams);
+  }
+  m_distances.push_back(distance);
+  m_reflectivities.push_back(reflectivity);
+  m_status_bits.push_back(status_bits);
+}
+
+void MeasurementData::reserve(uint32_t number_of_beams)
+{
+  m_distances.reserve(number_of_beams);
+  m_reflectivities.reserve(number_of_beams);
+  m_status_bits.reserve(number_of_beams);
+}
+
+void MeasurementData::resize(uint32_t number_of_beams)
+{
+  m_distances.resize(number_of_beams);
+  m_reflectivities.resize(number_of_beams);
+  m_status_bits.resize(number_of_beams);
+}
+
+Span<const uint16_t> MeasurementData::getDistances() const
+{
+  return Span<const uint16_t>(m_distances);
+}
+
+Span<uint16_t> MeasurementData::getDistances()
+{
+  return Span<uint16_t>(m_distances);
+}
+
+Span<const uint8_t> MeasurementData::getReflectivities() const
+{
+  return Span<const uint8_t>(m_reflectivities);
+}
+
+Span<uint8_t> MeasurementData::getReflectivities()
+{
+  return Span<uint8_t>(m_reflectivities);
+}
+
+Span<const uint8_t> MeasurementData::getStatusBits() const
+{
+  return Span<const uint8_t>(m_status_bits);
+}
+
+Span<uint8_t> MeasurementData::getStatusBits()
+{
+  return Span<uint8_t>(m_status_bits);
+}
+
+float MeasurementData::getStartAngle() const
+{
+  return m_start_angle;
+}
+
+float MeasurementData::getAngularBeamResolution() const
+{
+  return m_angular_beam_resolution;
+}
+
+void MeasurementData::setAngles(float start_angle, float angular_beam_resolution)
+{
+  m_has_angles              = true;
+  m_start_angle             = start_angle;
+  m_angular_beam_resolution = angular_beam_resolution;
 }
 
 bool MeasurementData::isEmpty() const
@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/datastructure/MonitoringCaseData.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
@@ -59,7 +61,7 @@ void MonitoringCaseData::setMonitoringCaseNumber(const uint16_t& monitoring_case
   m_monitoring_case_number = monitoring_case_number;
 }
 
-std::vector<uint16_t> MonitoringCaseData::getFieldIndices() const
+const std::vector<uint16_t>& MonitoringCaseData::getFieldIndices() const
 {
   return m_field_indices;
 }
@@ -69,7 +71,12 @@ void MonitoringCaseData::setFieldIndices(const std::vector<uint16_t>& field_indi
   m_field_indices = field_indices;
 }
 
-std::vector<bool> MonitoringCaseData::getFieldsValid() const
+void MonitoringCaseData::setFieldIndices(std::vector<uint16_t>&& field_indices)
+{
+  m_field_indices = std::move(field_indices);
+}
+
+const std::vector<bool>& MonitoringCaseData::getFieldsValid() const
 {
   return m_fields_valid;
 }
@@ -79,5 +86,10 @@ void MonitoringCaseData::setFieldsValid(const std::vector<bool>& fields_valid)
   m_fields_valid = fields_valid;
 }
 
+void MonitoringCaseData::setFieldsValid(std::vector<bool>&& fields_valid)
+{
+  m_fields_valid = std::move(fields_valid);
+}
+
 } // namespace datastructure
 } // namespace sick
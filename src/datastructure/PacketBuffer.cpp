@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
+#include <chrono>
+
 namespace sick {
 namespace datastructure {
 
@@ -50,6 +52,24 @@ PacketBuffer::PacketBuffer(const PacketBuffer::ArrayBuffer& buffer, const size_t
   setBuffer(buffer, length);
 }
 
+PacketBuffer::PacketBuffer(const std::shared_ptr<std::vector<uint8_t> const>& buffer)
+{
+  setBuffer(buffer);
+}
+
+PacketBuffer::PacketBuffer(const std::shared_ptr<std::vector<uint8_t> const>& buffer,
+                           size_t length)
+{
+  setBuffer(buffer, length);
+}
+
+int64_t PacketBuffer::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::system_clock::now().time_since_epoch())
+    .count();
+}
+
 std::shared_ptr<std::vector<uint8_t> const> PacketBuffer::getBuffer() const
 {
   // Okay to share since it's a shared_ptr<vector const>
@@ -59,16 +79,40 @@ std::shared_ptr<std::vector<uint8_t> const> PacketBuffer::getBuffer() const
 void PacketBuffer::setBuffer(const std::vector<uint8_t>& buffer)
 {
   m_buffer = std::make_shared<std::vector<uint8_t> const>(buffer);
+  m_length = m_buffer->size();
 }
 
 void PacketBuffer::setBuffer(const PacketBuffer::ArrayBuffer& buffer, const size_t& length)
 {
   m_buffer = std::make_shared<std::vector<uint8_t> const>(buffer.data(), buffer.data() + length);
+  m_length = length;
+}
+
+void PacketBuffer::setBuffer(const std::shared_ptr<std::vector<uint8_t> const>& buffer)
+{
+  setBuffer(buffer, buffer->size());
+}
+
+void PacketBuffer::setBuffer(const std::shared_ptr<std::vector<uint8_t> const>& buffer,
+                             size_t length)
+{
+  m_buffer = buffer;
+  m_length = length;
 }
 
 size_t PacketBuffer::getLength() const
 {
-  return m_buffer->size();
+  return m_length;
+}
+
+int64_t PacketBuffer::getReceiveTime() const
+{
+  return m_receive_time;
+}
+
+void PacketBuffer::setReceiveTime(int64_t receive_time)
+{
+  m_receive_time = receive_time;
 }
 
 } // namespace datastructure
@@ -0,0 +1,225 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestBlockLayout.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/ParseData.h"
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+const uint16_t NUMBER_OF_BEAMS = 16;
+
+/*!
+ * \brief Telegram with distinct values in the fields of the data header, the general system
+ * state, the derived values and the application data.
+ */
+std::vector<uint8_t> goldenTelegram()
+{
+  using sick::read_write_helper::storeLittleEndian;
+  std::vector<uint8_t> telegram =
+    tools::createTelegram(NUMBER_OF_BEAMS, sick::SensorDataFeatures::ALL, 0x01020304);
+  uint8_t* header = telegram.data();
+  header[0]       = 'R';
+  header[1]       = 2;
+  header[2]       = 3;
+  header[3]       = 4;
+  storeLittleEndian<uint32_t>(header + 4, 0x11223344);
+  storeLittleEndian<uint32_t>(header + 8, 0x55667788);
+  header[12] = 1;
+  storeLittleEndian<uint16_t>(header + 24, 0x1234);
+  storeLittleEndian<uint32_t>(header + 28, 0x89ABCDEF);
+
+  // The synthetic telegram sets the run mode, contamination warning and every second safe cut-off
+  // path
+  uint8_t* general_system_state =
+    header + sick::read_write_helper::loadLittleEndian<uint16_t>(header + 32);
+  general_system_state[10] = 3;
+  general_system_state[13] = 6;
+  general_system_state[15] = 0x02;
+
+  uint8_t* application_data =
+    header + sick::read_write_helper::loadLittleEndian<uint16_t>(header + 48);
+  application_data[0] = 0x01;
+  storeLittleEndian<uint16_t>(application_data + 12, 7);
+  storeLittleEndian<int16_t>(application_data + 56, -300);
+  application_data[60] = 0x11;
+  application_data[74]  = 2;
+  application_data[140] = 0x04;
+  storeLittleEndian<uint16_t>(application_data + 152, 9);
+  application_data[193] = 1;
+  application_data[194] = 0x22;
+  storeLittleEndian<int16_t>(application_data + 200, 250);
+  application_data[204] = 0x02;
+  storeLittleEndian<int16_t>(application_data + 208, -120);
+  application_data[259] = 0x03;
+  return telegram;
+}
+
+sick::datastructure::Data parse(const std::vector<uint8_t>& telegram)
+{
+  sick::datastructure::Data data;
+  sick::data_processing::ParseData().parseUDPSequence(sick::datastructure::PacketBuffer(telegram),
+                                                      data);
+  return data;
+}
+
+} // namespace
+
+TEST(BlockLayoutTest, DecodesTheDataHeader)
+{
+  sick::datastructure::Data data                = parse(goldenTelegram());
+  const sick::datastructure::DataHeader& header = *data.getDataHeaderPtr();
+  ASSERT_FALSE(header.isEmpty());
+  EXPECT_EQ('R', header.getVersionIndicator());
+  EXPECT_EQ(2, header.getVersionMajorVersion());
+  EXPECT_EQ(3, header.getVersionMinorVersion());
+  EXPECT_EQ(4, header.getVersionRelease());
+  EXPECT_EQ(0x11223344u, header.getSerialNumberOfDevice());
+  EXPECT_EQ(0x55667788u, header.getSerialNumberOfSystemPlug());
+  EXPECT_EQ(1, header.getChannelNumber());
+  EXPECT_EQ(0x01020304u, header.getSequenceNumber());
+  EXPECT_EQ(0x01020304u, header.getScanNumber());
+  EXPECT_EQ(0x1234, header.getTimestampDate());
+  EXPECT_EQ(0x89ABCDEFu, header.getTimestampTime());
+  EXPECT_EQ(tools::DATA_HEADER_SIZE, header.getGeneralSystemStateBlockOffset());
+  EXPECT_EQ(tools::GENERAL_SYSTEM_STATE_SIZE, header.getGeneralSystemStateBlockSize());
+  EXPECT_EQ(tools::APPLICATION_DATA_SIZE, header.getApplicationDataBlockSize());
+}
+
+TEST(BlockLayoutTest, DecodesTheGeneralSystemState)
+{
+  sick::datastructure::Data data                       = parse(goldenTelegram());
+  const sick::datastructure::GeneralSystemState& state = *data.getGeneralSystemStatePtr();
+  ASSERT_FALSE(state.isEmpty());
+  EXPECT_TRUE(state.getRunModeActive());
+  EXPECT_FALSE(state.getStandbyModeActive());
+  EXPECT_TRUE(state.getContaminationWarning());
+  EXPECT_FALSE(state.getContaminationError());
+  ASSERT_EQ(20u, state.getSafeCutOffPathVector().size());
+  for (std::size_t i = 0; i < 20; ++i)
+  {
+    // Byte 0xAA of the first eight paths
+    EXPECT_EQ(i < 8 && i % 2 == 1, state.getSafeCutOffPathVector()[i]) << "path " << i;
+  }
+  EXPECT_EQ(3, state.getCurrentMonitoringCaseNoTable1());
+  EXPECT_EQ(0, state.getCurrentMonitoringCaseNoTable2());
+  EXPECT_EQ(6, state.getCurrentMonitoringCaseNoTable4());
+  EXPECT_FALSE(state.getApplicationError());
+  EXPECT_TRUE(state.getDeviceError());
+}
+
+TEST(BlockLayoutTest, DecodesTheDerivedValues)
+{
+  sick::datastructure::Data data                           = parse(goldenTelegram());
+  const sick::datastructure::DerivedValues& derived_values = *data.getDerivedValuesPtr();
+  ASSERT_FALSE(derived_values.isEmpty());
+  EXPECT_EQ(1, derived_values.getMultiplicationFactor());
+  EXPECT_EQ(NUMBER_OF_BEAMS, derived_values.getNumberOfBeams());
+  EXPECT_EQ(40, derived_values.getScanTime());
+  EXPECT_NEAR(-137.5f, derived_values.getStartAngle(), 1e-5f);
+  EXPECT_NEAR(0.1f, derived_values.getAngularBeamResolution(), 1e-5f);
+  EXPECT_EQ(74u, derived_values.getInterbeamPeriod());
+}
+
+TEST(BlockLayoutTest, DecodesTheApplicationData)
+{
+  sick::datastructure::Data data = parse(goldenTelegram());
+  ASSERT_FALSE(data.getApplicationDataPtr()->isEmpty());
+
+  sick::datastructure::ApplicationInputs inputs = data.getApplicationDataPtr()->getInputs();
+  ASSERT_EQ(32u, inputs.getUnsafeInputsInputSourcesVector().size());
+  EXPECT_TRUE(inputs.getUnsafeInputsInputSourcesVector()[0]);
+  EXPECT_FALSE(inputs.getUnsafeInputsInputSourcesVector()[1]);
+  ASSERT_EQ(20u, inputs.getMonitoringCasevector().size());
+  EXPECT_EQ(7, inputs.getMonitoringCasevector()[0]);
+  EXPECT_EQ(-300, inputs.getVelocity0());
+  EXPECT_TRUE(inputs.getVelocity0Valid());
+  EXPECT_FALSE(inputs.getVelocity1Valid());
+  EXPECT_TRUE(inputs.getVelocity0TransmittedSafely());
+  EXPECT_EQ(2, inputs.getSleepModeInput());
+
+  sick::datastructure::ApplicationOutputs outputs = data.getApplicationDataPtr()->getOutputs();
+  ASSERT_EQ(20u, outputs.getEvalOutVector().size());
+  EXPECT_TRUE(outputs.getEvalOutVector()[2]);
+  EXPECT_FALSE(outputs.getEvalOutVector()[0]);
+  ASSERT_EQ(20u, outputs.getMonitoringCaseVector().size());
+  EXPECT_EQ(9, outputs.getMonitoringCaseVector()[0]);
+  EXPECT_EQ(1, outputs.getSleepModeOutput());
+  EXPECT_FALSE(outputs.getHostErrorFlagContaminationWarning());
+  EXPECT_TRUE(outputs.getHostErrorFlagContaminationError());
+  EXPECT_TRUE(outputs.getHostErrorFlagCriticalError());
+  EXPECT_EQ(250, outputs.getVelocity0());
+  EXPECT_FALSE(outputs.getVelocity0Valid());
+  EXPECT_TRUE(outputs.getVelocity1Valid());
+  ASSERT_EQ(20u, outputs.getResultingVelocityVector().size());
+  EXPECT_EQ(-120, outputs.getResultingVelocityVector()[0]);
+  EXPECT_TRUE(outputs.getFlagsSleepModeOutputIsValid());
+  EXPECT_TRUE(outputs.getFlagsHostErrorFlagsAreValid());
+}
+
+TEST(BlockLayoutTest, MarksATruncatedBlockEmpty)
+{
+  std::vector<uint8_t> telegram = goldenTelegram();
+  // The application data block ends 100 bytes behind the telegram
+  sick::read_write_helper::storeLittleEndian<uint16_t>(
+    telegram.data() + 48,
+    static_cast<uint16_t>(telegram.size() - tools::APPLICATION_DATA_SIZE + 100));
+
+  sick::datastructure::Data data = parse(telegram);
+  EXPECT_TRUE(data.getApplicationDataPtr()->isEmpty());
+  EXPECT_FALSE(data.getDataHeaderPtr()->isEmpty());
+  EXPECT_FALSE(data.getGeneralSystemStatePtr()->isEmpty());
+  EXPECT_FALSE(data.getDerivedValuesPtr()->isEmpty());
+}
+
+TEST(BlockLayoutTest, MarksATruncatedDataHeaderEmpty)
+{
+  std::vector<uint8_t> telegram = goldenTelegram();
+  telegram.resize(sick::datastructure::DataHeader::HEADER_SIZE - 1);
+
+  sick::datastructure::Data data = parse(telegram);
+  EXPECT_TRUE(data.getDataHeaderPtr()->isEmpty());
+  EXPECT_TRUE(data.getGeneralSystemStatePtr()->isEmpty());
+  EXPECT_TRUE(data.getDerivedValuesPtr()->isEmpty());
+  EXPECT_TRUE(data.getApplicationDataPtr()->isEmpty());
+}
+
+} // namespace tests
+} // namespace sick
@@ -0,0 +1,119 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestCaptureFile.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/ReplaySickSafetyScanner.h"
+#include "sick_safetyscanners_base/communication/CaptureFile.h"
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+// Receive time of the first datagram, the datagrams follow each other by a microsecond.
+const int64_t FIRST_TIMESTAMP = 1700000000000000000;
+
+class CaptureFileTest : public testing::Test
+{
+protected:
+  CaptureFileTest()
+    : path(testing::TempDir() + "capture.bin")
+  {
+    for (uint32_t scan_number = 1; scan_number <= 2; scan_number++)
+    {
+      std::vector<sick::datastructure::PacketBuffer> scan_datagrams = tools::createDatagrams(
+        tools::createTelegram(541, sick::SensorDataFeatures::ALL, scan_number), scan_number);
+      datagrams.insert(datagrams.end(), scan_datagrams.begin(), scan_datagrams.end());
+    }
+    sick::communication::CaptureWriter writer(path);
+    for (std::size_t i = 0; i < datagrams.size(); i++)
+    {
+      writer.write(datagrams[i], getTimestamp(i));
+    }
+    writer.flush();
+  }
+
+  ~CaptureFileTest() override { std::remove(path.c_str()); }
+
+  static int64_t getTimestamp(std::size_t index) { return FIRST_TIMESTAMP + index * 1000; }
+
+  std::string path;
+  std::vector<sick::datastructure::PacketBuffer> datagrams;
+};
+
+} // namespace
+
+TEST_F(CaptureFileTest, ReadsTheWrittenDatagrams)
+{
+  sick::communication::CaptureReader reader(path);
+  sick::communication::CaptureRecord record;
+  for (std::size_t i = 0; i < datagrams.size(); i++)
+  {
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(getTimestamp(i), record.timestamp);
+    EXPECT_EQ(*datagrams[i].getBuffer(),
+              std::vector<uint8_t>(record.data, record.data + record.length));
+  }
+  EXPECT_FALSE(reader.next(record));
+}
+
+TEST_F(CaptureFileTest, ReplaysTheRecordedReceiveTimes)
+{
+  std::vector<int64_t> receive_times;
+  sick::types::ScanDataCb callback = [&receive_times](const sick::datastructure::Data& data) {
+    receive_times.push_back(data.getReceiveTime());
+  };
+  sick::ReplaySickSafetyScanner(path, callback).run(sick::ReplayPace::MAXIMUM);
+  ASSERT_EQ(2u, receive_times.size());
+  EXPECT_EQ(getTimestamp(0), receive_times[0]);
+  EXPECT_EQ(getTimestamp(datagrams.size() / 2), receive_times[1]);
+
+  // At the recorded pace the receive times start with the replay.
+  receive_times.clear();
+  int64_t start = sick::datastructure::PacketBuffer::now();
+  sick::ReplaySickSafetyScanner(path, callback).run(sick::ReplayPace::RECORDED);
+  ASSERT_EQ(2u, receive_times.size());
+  EXPECT_LE(start, receive_times[0]);
+  EXPECT_GE(sick::datastructure::PacketBuffer::now(), receive_times[0]);
+  EXPECT_EQ(getTimestamp(datagrams.size() / 2) - getTimestamp(0),
+            receive_times[1] - receive_times[0]);
+}
+
+} // namespace tests
+} // namespace sick
@@ -0,0 +1,141 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestConfigurationCache.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/ConfigurationCache.h"
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+class ConfigurationCacheTest : public testing::Test
+{
+protected:
+  ConfigurationCacheTest()
+    : cache(testing::TempDir())
+  {
+    serial_number.setSerialNumber("12345678");
+    config_metadata.setAppChecksum(0x1234);
+    config_metadata.setOverallChecksum(0x5678);
+    config_metadata.setIntegrityHash(std::vector<uint32_t>{1, 2, 3, 4});
+
+    sick::datastructure::FieldData field;
+    field.setIsValid(true);
+    field.setVersionCVersion("V");
+    field.setVersionMajorVersionNumber(1);
+    field.setVersionMinorVersionNumber(2);
+    field.setVersionReleaseNumber(3);
+    field.setIsDefined(true);
+    field.setEvalMethod(0);
+    field.setMultiSampling(2);
+    field.setObjectResolution(70);
+    field.setFieldSetIndex(5);
+    field.setNameLength(6);
+    field.setFieldName("Field1");
+    field.setIsWarningField(false);
+    field.setIsProtectiveField(true);
+    field.setBeamDistances(std::vector<uint16_t>{1000, 1200, 1400});
+    field.setStartAngleDegrees(-47.5f);
+    field.setEndAngleDegrees(-46.5f);
+    field.setAngularBeamResolutionDegrees(0.5f);
+    fields.push_back(field);
+
+    sick::datastructure::MonitoringCaseData monitoring_case;
+    monitoring_case.setIsValid(true);
+    monitoring_case.setMonitoringCaseNumber(7);
+    monitoring_case.setFieldIndices(std::vector<uint16_t>{0, 3});
+    monitoring_case.setFieldsValid(std::vector<bool>{true, false});
+    monitoring_cases.push_back(monitoring_case);
+  }
+
+  ~ConfigurationCacheTest() { std::remove(cache.getFilePath(serial_number).c_str()); }
+
+  sick::data_processing::ConfigurationCache cache;
+  sick::datastructure::SerialNumber serial_number;
+  sick::datastructure::ConfigMetadata config_metadata;
+  std::vector<sick::datastructure::FieldData> fields;
+  std::vector<sick::datastructure::MonitoringCaseData> monitoring_cases;
+};
+
+} // namespace
+
+TEST_F(ConfigurationCacheTest, LoadsTheStoredConfiguration)
+{
+  ASSERT_TRUE(cache.store(serial_number, config_metadata, fields, monitoring_cases));
+
+  std::vector<sick::datastructure::FieldData> loaded_fields;
+  std::vector<sick::datastructure::MonitoringCaseData> loaded_cases;
+  ASSERT_TRUE(cache.load(serial_number, config_metadata, loaded_fields, loaded_cases));
+
+  ASSERT_EQ(1u, loaded_fields.size());
+  const sick::datastructure::FieldData& field = loaded_fields[0];
+  EXPECT_TRUE(field.getIsValid());
+  EXPECT_EQ("V", field.getVersionCVersion());
+  EXPECT_EQ(3, field.getVersionReleaseNumber());
+  EXPECT_EQ(70, field.getObjectResolution());
+  EXPECT_EQ(5, field.getFieldSetIndex());
+  EXPECT_EQ("Field1", field.getFieldName());
+  EXPECT_FALSE(field.getIsWarningField());
+  EXPECT_TRUE(field.getIsProtectiveField());
+  EXPECT_EQ(fields[0].getBeamDistances(), field.getBeamDistances());
+  EXPECT_EQ(-47.5f, field.getStartAngle());
+  EXPECT_EQ(-46.5f, field.getEndAngle());
+  EXPECT_EQ(0.5f, field.getAngularBeamResolution());
+
+  ASSERT_EQ(1u, loaded_cases.size());
+  EXPECT_TRUE(loaded_cases[0].getIsValid());
+  EXPECT_EQ(7, loaded_cases[0].getMonitoringCaseNumber());
+  EXPECT_EQ(monitoring_cases[0].getFieldIndices(), loaded_cases[0].getFieldIndices());
+  EXPECT_EQ(monitoring_cases[0].getFieldsValid(), loaded_cases[0].getFieldsValid());
+}
+
+TEST_F(ConfigurationCacheTest, IgnoresTheCacheOfAnotherChecksum)
+{
+  ASSERT_TRUE(cache.store(serial_number, config_metadata, fields, monitoring_cases));
+
+  sick::datastructure::ConfigMetadata changed_metadata = config_metadata;
+  changed_metadata.setOverallChecksum(0x5679);
+  std::vector<sick::datastructure::FieldData> loaded_fields;
+  std::vector<sick::datastructure::MonitoringCaseData> loaded_cases;
+  EXPECT_FALSE(cache.load(serial_number, changed_metadata, loaded_fields, loaded_cases));
+  EXPECT_TRUE(loaded_fields.empty());
+  EXPECT_TRUE(loaded_cases.empty());
+}
+
+} // namespace tests
+} // namespace sick
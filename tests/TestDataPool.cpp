@@ -0,0 +1,119 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestDataPool.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/DataPool.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+std::atomic<std::size_t> g_allocations(0);
+
+} // namespace
+
+// Counts the allocations of the test binary
+void* operator new(std::size_t size)
+{
+  g_allocations++;
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (!pointer)
+  {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+namespace sick {
+namespace tests {
+
+TEST(DataPoolTest, HandsOutAnInstanceAgainOnceItsLastReferenceIsDropped)
+{
+  sick::datastructure::DataPool pool(1);
+  std::shared_ptr<sick::datastructure::Data> data = pool.acquire();
+  sick::datastructure::Data* instance            = data.get();
+  std::shared_ptr<sick::datastructure::Data> copy = data;
+  pool.release(data);
+
+  // Still held by the copy, so a new instance is returned which is not pooled
+  std::shared_ptr<sick::datastructure::Data> other = pool.acquire();
+  EXPECT_NE(instance, other.get());
+  EXPECT_EQ(1u, pool.getSize());
+
+  copy.reset();
+  EXPECT_EQ(instance, pool.acquire().get());
+}
+
+TEST(DataPoolTest, FreesCheckedOutInstancesDroppedFromThePool)
+{
+  std::shared_ptr<sick::datastructure::Data> data;
+  {
+    sick::datastructure::DataPool pool(2);
+    data = pool.acquire();
+    pool.setMaxSize(0);
+    EXPECT_EQ(0u, pool.getSize());
+  }
+  // Returning the instance after the pool is gone must not access the pool
+  data.reset();
+}
+
+TEST(DataPoolTest, RecyclesInstancesWithoutAllocating)
+{
+  sick::datastructure::DataPool pool(2);
+  // The first cycle creates the pooled instance
+  std::shared_ptr<sick::datastructure::Data> data = pool.acquire();
+  pool.release(data);
+
+  std::size_t allocations = g_allocations.load();
+  for (int i = 0; i < 100; ++i)
+  {
+    data                                            = pool.acquire();
+    std::shared_ptr<sick::datastructure::Data> copy = data;
+    pool.release(data);
+    copy.reset();
+  }
+  EXPECT_EQ(allocations, g_allocations.load());
+  EXPECT_EQ(1u, pool.getSize());
+}
+
+} // namespace tests
+} // namespace sick
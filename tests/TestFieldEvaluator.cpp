@@ -0,0 +1,120 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestFieldEvaluator.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/FieldEvaluator.h"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+using sick::data_processing::FieldEvaluation;
+using sick::data_processing::FieldEvaluator;
+using sick::data_processing::SimdKernel;
+
+/*!
+ * \brief Protective field from -10.02 to 9.98 degrees in steps of 0.5 degrees, which is 5 meters
+ * deep up to -0.02 degrees and 4 meters deep from 0.48 degrees. The contour points lie between the
+ * beams of the scan, so every beam is resampled from two of them.
+ */
+sick::datastructure::FieldData createField()
+{
+  sick::datastructure::FieldData field;
+  field.setIsValid(true);
+  field.setIsDefined(true);
+  field.setIsProtectiveField(true);
+  field.setIsWarningField(false);
+  field.setStartAngleDegrees(-10.02f);
+  field.setAngularBeamResolutionDegrees(0.5f);
+  std::vector<uint16_t> beam_distances(41, 4000);
+  std::fill(beam_distances.begin(), beam_distances.begin() + 21, 5000);
+  field.setBeamDistances(beam_distances);
+  return field;
+}
+
+} // namespace
+
+TEST(FieldEvaluatorTest, KernelsEvaluateAKnownContour)
+{
+  // Beam i is at -137.5 + 0.1 * i degrees, 1000 + i units away and valid if i is odd. The field
+  // covers the beams 1273 to 1477. With 2 millimeters per unit the thresholds are 2500 units up
+  // to beam 1379, which intrudes the odd beams, and 2000 units from beam 1380, which are clear.
+  sick::datastructure::Data data = tools::parsedTelegram(2751);
+  const SimdKernel kernels[]     = {SimdKernel::SCALAR, SimdKernel::SSE2, SimdKernel::AVX2};
+
+  for (SimdKernel kernel : kernels)
+  {
+    if (!sick::data_processing::isSimdKernelSupported(kernel))
+    {
+      continue;
+    }
+    SCOPED_TRACE(testing::Message() << "kernel " << static_cast<int>(kernel));
+    FieldEvaluator evaluator(std::vector<sick::datastructure::FieldData>(1, createField()));
+    evaluator.setKernel(kernel);
+    std::vector<FieldEvaluation> evaluations;
+    evaluator.evaluate(*data.getMeasurementDataPtr(), 2, evaluations);
+    ASSERT_EQ(1u, evaluations.size());
+
+    sick::Span<const uint16_t> thresholds = evaluator.getThresholds(0);
+    ASSERT_EQ(2751u, thresholds.size());
+    EXPECT_EQ(0, thresholds[1272]);
+    EXPECT_EQ(2500, thresholds[1273]);
+    EXPECT_EQ(2500, thresholds[1379]);
+    EXPECT_EQ(2000, thresholds[1380]);
+    EXPECT_EQ(2000, thresholds[1477]);
+    EXPECT_EQ(0, thresholds[1478]);
+
+    const FieldEvaluation& evaluation = evaluations[0];
+    EXPECT_TRUE(evaluation.is_protective_field);
+    EXPECT_FALSE(evaluation.is_warning_field);
+    ASSERT_EQ((2751u + 63) / 64, evaluation.intrusion_words.size());
+    for (std::size_t i = 0; i < 2751; ++i)
+    {
+      bool is_intruded = (evaluation.intrusion_words[i / 64] >> (i % 64)) & 1;
+      EXPECT_EQ(i >= 1273 && i <= 1379 && i % 2 == 1, is_intruded) << "beam " << i;
+    }
+    EXPECT_EQ(54u, evaluation.number_of_intruded_beams);
+    // Beam 1273 is 2273 units away, 227 units or 454 millimeters within the field
+    EXPECT_EQ(-454, evaluation.min_clearance);
+  }
+}
+
+} // namespace tests
+} // namespace sick
@@ -0,0 +1,149 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestLockFreeRing.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/LockFreeRing.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+std::atomic<bool> g_stalls(false);
+std::atomic<bool> g_is_moving(false);
+std::atomic<bool> g_may_move(false);
+
+// Item whose move stalls the consumer between claiming a slot and releasing it.
+struct StallingItem
+{
+  int value   = 0;
+  bool stalls  = false;
+
+  StallingItem() = default;
+  StallingItem(int value_, bool stalls_)
+    : value(value_)
+    , stalls(stalls_)
+  {
+  }
+
+  StallingItem& operator=(StallingItem&& other)
+  {
+    if (other.stalls && g_stalls)
+    {
+      g_is_moving = true;
+      while (!g_may_move)
+      {
+        std::this_thread::yield();
+      }
+    }
+    value  = other.value;
+    stalls = other.stalls;
+    return *this;
+  }
+};
+
+} // namespace
+
+TEST(LockFreeRingTest, PassesDiscardedOldestItemsToTheHandler)
+{
+  sick::datastructure::LockFreeRing<int> ring(2);
+  std::vector<int> discarded;
+  auto on_discard = [&discarded](int& item) { discarded.push_back(item); };
+  for (int i = 1; i <= 4; i++)
+  {
+    EXPECT_TRUE(ring.push(int(i), sick::datastructure::OverflowPolicy::DROP_OLDEST, on_discard));
+  }
+  EXPECT_EQ((std::vector<int>{1, 2}), discarded);
+
+  int item = 0;
+  ASSERT_TRUE(ring.tryPop(item));
+  EXPECT_EQ(3, item);
+  ASSERT_TRUE(ring.tryPop(item));
+  EXPECT_EQ(4, item);
+  EXPECT_FALSE(ring.tryPop(item));
+  EXPECT_EQ(2u, ring.getCounters().dropped_oldest);
+}
+
+TEST(LockFreeRingTest, LeavesDroppedNewItemsToTheCaller)
+{
+  // A single slot is rounded up to two
+  sick::datastructure::LockFreeRing<int> ring(1);
+  ASSERT_EQ(2u, ring.capacity());
+  std::vector<int> discarded;
+  auto on_discard = [&discarded](int& item) { discarded.push_back(item); };
+  EXPECT_TRUE(ring.push(1, sick::datastructure::OverflowPolicy::DROP_NEWEST, on_discard));
+  EXPECT_TRUE(ring.push(2, sick::datastructure::OverflowPolicy::DROP_NEWEST, on_discard));
+  EXPECT_FALSE(ring.push(3, sick::datastructure::OverflowPolicy::DROP_NEWEST, on_discard));
+  EXPECT_TRUE(discarded.empty());
+  EXPECT_EQ(1u, ring.getCounters().dropped_newest);
+}
+
+TEST(LockFreeRingTest, WaitsForAConsumerReleasingTheOldestSlot)
+{
+  sick::datastructure::LockFreeRing<StallingItem> ring(2);
+  EXPECT_TRUE(ring.tryPush(StallingItem(1, true)));
+  EXPECT_TRUE(ring.tryPush(StallingItem(2, false)));
+
+  StallingItem popped;
+  g_stalls = true;
+  std::thread consumer([&ring, &popped]() { ring.tryPop(popped); });
+  while (!g_is_moving)
+  {
+    std::this_thread::yield();
+  }
+  std::thread releaser([]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    g_may_move = true;
+  });
+  EXPECT_TRUE(ring.push(StallingItem(3, false), sick::datastructure::OverflowPolicy::DROP_OLDEST));
+  releaser.join();
+  consumer.join();
+
+  EXPECT_EQ(0u, ring.getCounters().dropped_oldest);
+  EXPECT_EQ(1, popped.value);
+  StallingItem item;
+  ASSERT_TRUE(ring.tryPop(item));
+  EXPECT_EQ(2, item.value);
+  ASSERT_TRUE(ring.tryPop(item));
+  EXPECT_EQ(3, item.value);
+}
+
+} // namespace tests
+} // namespace sick
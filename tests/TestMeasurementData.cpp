@@ -0,0 +1,99 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestMeasurementData.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/MeasurementData.h"
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+sick::datastructure::ScanPoint scanPoint(float angle, uint16_t distance)
+{
+  uint8_t reflectivity = 0;
+  bool valid           = true;
+  bool cleared         = false;
+  return sick::datastructure::ScanPoint(
+    angle, distance, reflectivity, valid, cleared, cleared, cleared, cleared, cleared);
+}
+
+} // namespace
+
+TEST(MeasurementDataTest, AddsScanPointsOnTheBeamAngles)
+{
+  sick::datastructure::MeasurementData measurement_data;
+  measurement_data.setAngles(-10.0f, 0.5f);
+  measurement_data.addScanPoint(scanPoint(-10.0f, 100));
+  measurement_data.addScanPoint(scanPoint(-9.5f, 200));
+
+  std::vector<sick::datastructure::ScanPoint> scan_points = measurement_data.getScanPointsVector();
+  ASSERT_EQ(2u, scan_points.size());
+  EXPECT_FLOAT_EQ(-9.5f, scan_points[1].getAngle());
+  EXPECT_EQ(200, scan_points[1].getDistance());
+  EXPECT_TRUE(scan_points[1].getValidBit());
+}
+
+TEST(MeasurementDataTest, DerivesTheBeamAnglesFromTheFirstScanPoints)
+{
+  sick::datastructure::MeasurementData measurement_data;
+  measurement_data.addScanPoint(scanPoint(-10.0f, 100));
+  measurement_data.addScanPoint(scanPoint(-9.5f, 200));
+  measurement_data.addScanPoint(scanPoint(-9.0f, 300));
+
+  EXPECT_FLOAT_EQ(-10.0f, measurement_data.getStartAngle());
+  EXPECT_FLOAT_EQ(0.5f, measurement_data.getAngularBeamResolution());
+  std::vector<sick::datastructure::ScanPoint> scan_points = measurement_data.getScanPointsVector();
+  ASSERT_EQ(3u, scan_points.size());
+  EXPECT_FLOAT_EQ(-9.0f, scan_points[2].getAngle());
+}
+
+TEST(MeasurementDataTest, AcceptsScanPointsOffTheBeamAngles)
+{
+  sick::datastructure::MeasurementData measurement_data;
+  measurement_data.setAngles(-10.0f, 0.5f);
+  measurement_data.addScanPoint(scanPoint(-10.0f, 100));
+  measurement_data.addScanPoint(scanPoint(-9.0f, 200));
+
+  // The angles set before take precedence
+  EXPECT_FLOAT_EQ(0.5f, measurement_data.getAngularBeamResolution());
+  std::vector<sick::datastructure::ScanPoint> scan_points = measurement_data.getScanPointsVector();
+  ASSERT_EQ(2u, scan_points.size());
+  EXPECT_FLOAT_EQ(-9.5f, scan_points[1].getAngle());
+  EXPECT_EQ(200, scan_points[1].getDistance());
+}
+
+} // namespace tests
+} // namespace sick
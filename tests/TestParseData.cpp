@@ -0,0 +1,106 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestParseData.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/ParseData.h"
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+// 2751 beams from -137.5 to 137.5 degrees, the distance of beam i is 1000 + i.
+const uint16_t NUMBER_OF_BEAMS = 2751;
+
+sick::data_processing::BeamRegion frontSector()
+{
+  sick::data_processing::BeamRegion region;
+  region.start_angle = -45.0f;
+  region.end_angle   = 45.0f;
+  return region;
+}
+
+void expectFrontSector(const sick::datastructure::MeasurementData& measurement_data)
+{
+  // Beams 925 to 1825 are within +-45 degrees
+  ASSERT_EQ(901u, measurement_data.getNumberOfBeams());
+  EXPECT_NEAR(-45.0f, measurement_data.getStartAngle(), 1e-3f);
+  EXPECT_EQ(1000 + 925, measurement_data.getDistances()[0]);
+  EXPECT_EQ(1000 + 1825, measurement_data.getDistances()[900]);
+}
+
+} // namespace
+
+TEST(ParseDataTest, DecodesOnlyTheBeamsOfTheRegion)
+{
+  sick::datastructure::PacketBuffer buffer(
+    tools::createTelegram(NUMBER_OF_BEAMS, sick::SensorDataFeatures::ALL, 1));
+  sick::data_processing::ParseData parser;
+  parser.setBeamRegion(frontSector());
+
+  sick::datastructure::Data data;
+  parser.parseUDPSequence(buffer, data);
+  expectFrontSector(*data.getMeasurementDataPtr());
+}
+
+TEST(ParseDataTest, DecodesOnlyTheBeamsOfTheRegionOnFirstAccess)
+{
+  sick::datastructure::PacketBuffer buffer(
+    tools::createTelegram(NUMBER_OF_BEAMS, sick::SensorDataFeatures::ALL, 1));
+  sick::data_processing::ParseData parser(sick::SensorDataFeatures::GENERAL_SYSTEM_STATE);
+  parser.setBeamRegion(frontSector());
+
+  sick::datastructure::Data data;
+  parser.parseUDPSequence(buffer, data);
+  expectFrontSector(*data.getMeasurementDataPtr());
+}
+
+TEST(ParseDataTest, DecodesAllBeamsOnceTheRegionIsCleared)
+{
+  sick::datastructure::PacketBuffer buffer(
+    tools::createTelegram(NUMBER_OF_BEAMS, sick::SensorDataFeatures::ALL, 1));
+  sick::data_processing::ParseData parser;
+  parser.setBeamRegion(frontSector());
+  parser.clearBeamRegion();
+
+  sick::datastructure::Data data;
+  parser.parseUDPSequence(buffer, data);
+  EXPECT_EQ(NUMBER_OF_BEAMS, data.getMeasurementDataPtr()->getNumberOfBeams());
+}
+
+} // namespace tests
+} // namespace sick
@@ -0,0 +1,113 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestParseMeasurementData.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/ParseMeasurementData.h"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+using sick::data_processing::ParseMeasurementData;
+using sick::data_processing::SimdKernel;
+
+// Lengths around the 16 and 32 beams of the vector loops and the beams of a full scan
+const uint32_t NUMBER_OF_BEAMS[] = {0, 1, 7, 15, 16, 17, 31, 32, 33, 100, 2751};
+
+struct DecodedBeams
+{
+  explicit DecodedBeams(uint32_t number_of_beams)
+    : distances(number_of_beams)
+    , reflectivities(number_of_beams)
+    , status_bits(number_of_beams)
+  {
+  }
+
+  std::vector<uint16_t> distances;
+  std::vector<uint8_t> reflectivities;
+  std::vector<uint8_t> status_bits;
+};
+
+} // namespace
+
+TEST(ParseMeasurementDataTest, KernelsDecodeRandomBeamRecords)
+{
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> byte(0, 255);
+  const SimdKernel kernels[] = {SimdKernel::SCALAR, SimdKernel::SSE2, SimdKernel::AVX2};
+
+  for (uint32_t number_of_beams : NUMBER_OF_BEAMS)
+  {
+    std::vector<uint8_t> records(number_of_beams * ParseMeasurementData::BEAM_RECORD_SIZE);
+    for (uint8_t& value : records)
+    {
+      value = static_cast<uint8_t>(byte(generator));
+    }
+    DecodedBeams expected(number_of_beams);
+    for (uint32_t i = 0; i < number_of_beams; ++i)
+    {
+      const uint8_t* record      = &records[i * ParseMeasurementData::BEAM_RECORD_SIZE];
+      expected.distances[i]      = static_cast<uint16_t>(record[0] | (record[1] << 8));
+      expected.reflectivities[i] = record[2];
+      expected.status_bits[i]    = record[3];
+    }
+
+    for (SimdKernel kernel : kernels)
+    {
+      if (!sick::data_processing::isSimdKernelSupported(kernel))
+      {
+        continue;
+      }
+      DecodedBeams decoded(number_of_beams);
+      ParseMeasurementData::decodeBeams(kernel,
+                                        records.data(),
+                                        number_of_beams,
+                                        decoded.distances.data(),
+                                        decoded.reflectivities.data(),
+                                        decoded.status_bits.data());
+      SCOPED_TRACE(testing::Message() << "kernel " << static_cast<int>(kernel) << ", "
+                                      << number_of_beams << " beams");
+      EXPECT_EQ(expected.distances, decoded.distances);
+      EXPECT_EQ(expected.reflectivities, decoded.reflectivities);
+      EXPECT_EQ(expected.status_bits, decoded.status_bits);
+    }
+  }
+}
+
+} // namespace tests
+} // namespace sick
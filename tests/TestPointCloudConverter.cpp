@@ -0,0 +1,123 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestPointCloudConverter.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/PointCloudConverter.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+using sick::data_processing::CartesianPoint;
+using sick::data_processing::PointCloudConverter;
+using sick::data_processing::SimdKernel;
+using sick::data_processing::TrigTable;
+
+// Counts around the 4 and 8 points of the vector loops and the beams of a full scan
+const uint16_t NUMBER_OF_BEAMS[] = {1, 3, 5, 7, 9, 13, 17, 2751};
+
+} // namespace
+
+TEST(PointCloudConverterTest, KernelsConvertWithATransform)
+{
+  const sick::data_processing::PlanarTransform transform(0.25f, -1.5f, 0.3f);
+  const SimdKernel kernels[] = {SimdKernel::SSE2, SimdKernel::AVX2};
+
+  for (uint16_t number_of_beams : NUMBER_OF_BEAMS)
+  {
+    sick::datastructure::Data data = tools::parsedTelegram(number_of_beams);
+    PointCloudConverter scalar(transform);
+    scalar.setKernel(SimdKernel::SCALAR);
+    std::vector<CartesianPoint> expected(number_of_beams);
+    ASSERT_EQ(number_of_beams, scalar.convert(data, expected.data(), expected.size()));
+
+    // Beam i is at -137.5 + 0.1 * i degrees with a distance of 1000 + i millimeters
+    const double radians_per_degree = std::acos(-1.0) / 180.0;
+    for (uint16_t i = 0; i < number_of_beams; ++i)
+    {
+      double angle = (-137.5 + 0.1 * i) * radians_per_degree + 0.3;
+      double range = (1000 + i) * 0.001;
+      EXPECT_NEAR(0.25 + range * std::cos(angle), expected[i].x, 1e-4);
+      EXPECT_NEAR(-1.5 + range * std::sin(angle), expected[i].y, 1e-4);
+      EXPECT_EQ(0.0f, expected[i].z);
+      EXPECT_EQ(static_cast<float>(i & 0xFF), expected[i].intensity);
+    }
+
+    for (SimdKernel kernel : kernels)
+    {
+      if (!sick::data_processing::isSimdKernelSupported(kernel))
+      {
+        continue;
+      }
+      PointCloudConverter converter(transform);
+      converter.setKernel(kernel);
+      ASSERT_EQ(kernel, converter.getKernel());
+      std::vector<CartesianPoint> points(number_of_beams);
+      ASSERT_EQ(number_of_beams, converter.convert(data, points.data(), points.size()));
+      for (uint16_t i = 0; i < number_of_beams; ++i)
+      {
+        SCOPED_TRACE(testing::Message() << "kernel " << static_cast<int>(kernel) << ", point " << i
+                                        << " of " << number_of_beams);
+        EXPECT_FLOAT_EQ(expected[i].x, points[i].x);
+        EXPECT_FLOAT_EQ(expected[i].y, points[i].y);
+        EXPECT_EQ(expected[i].z, points[i].z);
+        EXPECT_EQ(expected[i].intensity, points[i].intensity);
+      }
+    }
+  }
+}
+
+TEST(PointCloudConverterTest, SharesTheTrigTableOfEqualKeys)
+{
+  TrigTable::Key key;
+  key.start_angle             = -137.5f;
+  key.angular_beam_resolution = 0.1f;
+  key.number_of_beams         = 2751;
+  TrigTable::Key other_key    = key;
+  other_key.number_of_beams   = 1375;
+
+  std::shared_ptr<const TrigTable> table = TrigTable::get(key);
+  EXPECT_EQ(table, TrigTable::get(key));
+  EXPECT_NE(table, TrigTable::get(other_key));
+  EXPECT_TRUE(TrigTable::get(other_key)->getKey() == other_key);
+}
+
+} // namespace tests
+} // namespace sick
@@ -0,0 +1,144 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestPriorityBlockDecoder.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/ParseData.h"
+#include "sick_safetyscanners_base/data_processing/PriorityBlockDecoder.h"
+#include "sick_safetyscanners_base/data_processing/UDPPacketMerger.h"
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+// Feeds datagrams through a merger into the decoder, like the asynchronous scanner does.
+class PriorityBlockDecoderTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_merger.setProgressHandler([this](const sick::datastructure::PacketBuffer& buffer,
+                                       const sick::datastructure::PacketProgress& progress) {
+      m_decoder.update(buffer, progress);
+    });
+  }
+
+  // Adds the datagrams and returns the scan numbers of the data decoded early.
+  std::vector<uint32_t>
+  addDatagrams(const std::vector<sick::datastructure::PacketBuffer>& datagrams)
+  {
+    std::vector<uint32_t> scan_numbers;
+    for (const auto& datagram : datagrams)
+    {
+      m_merger.addUDPPacket(datagram);
+      if (m_decoder.isReady())
+      {
+        m_early_data = m_decoder.takeData();
+        EXPECT_FALSE(m_early_data.getGeneralSystemStatePtr()->isEmpty());
+        scan_numbers.push_back(m_early_data.getDataHeaderPtr()->getScanNumber());
+      }
+    }
+    return scan_numbers;
+  }
+
+  sick::data_processing::UDPPacketMerger m_merger;
+  sick::data_processing::PriorityBlockDecoder m_decoder;
+  sick::datastructure::Data m_early_data;
+};
+
+} // namespace
+
+TEST_F(PriorityBlockDecoderTest, DecodesTheGeneralSystemStateWithTheFirstFragment)
+{
+  m_decoder.setBlocks(sick::SensorDataFeatures::GENERAL_SYSTEM_STATE);
+  std::vector<sick::datastructure::PacketBuffer> datagrams =
+    tools::createDatagrams(tools::createTelegram(2751, sick::SensorDataFeatures::ALL, 7), 1);
+
+  EXPECT_EQ(std::vector<uint32_t>{7}, addDatagrams({datagrams.front()}));
+  datagrams.erase(datagrams.begin());
+  EXPECT_TRUE(addDatagrams(datagrams).empty());
+
+  sick::datastructure::Data data;
+  sick::data_processing::ParseData().parseUDPSequence(m_merger.getDeployedPacketBuffer(), data);
+  EXPECT_EQ(data.getGeneralSystemStatePtr()->getRunModeActive(),
+            m_early_data.getGeneralSystemStatePtr()->getRunModeActive());
+  EXPECT_EQ(data.getGeneralSystemStatePtr()->getCurrentMonitoringCaseNoTable1(),
+            m_early_data.getGeneralSystemStatePtr()->getCurrentMonitoringCaseNoTable1());
+}
+
+TEST_F(PriorityBlockDecoderTest, DecodesInterleavedPackets)
+{
+  // The application data is the last block of the telegram, so it needs all fragments.
+  m_decoder.setBlocks(sick::SensorDataFeatures::GENERAL_SYSTEM_STATE |
+                      sick::SensorDataFeatures::APPLICATION_DATA);
+  std::vector<sick::datastructure::PacketBuffer> first =
+    tools::createDatagrams(tools::createTelegram(2751, sick::SensorDataFeatures::ALL, 1), 10);
+  std::vector<sick::datastructure::PacketBuffer> second =
+    tools::createDatagrams(tools::createTelegram(2751, sick::SensorDataFeatures::ALL, 2), 11);
+  ASSERT_EQ(first.size(), second.size());
+
+  std::vector<sick::datastructure::PacketBuffer> interleaved;
+  for (std::size_t i = 0; i < first.size(); i++)
+  {
+    interleaved.push_back(first[i]);
+    interleaved.push_back(second[i]);
+  }
+  EXPECT_EQ((std::vector<uint32_t>{1, 2}), addDatagrams(interleaved));
+  EXPECT_EQ(2u, m_merger.getCounters().completed_packets);
+}
+
+TEST_F(PriorityBlockDecoderTest, FollowsTheIdentificationWindowOfTheMerger)
+{
+  // The first packet falls further behind than the default window before it completes.
+  const uint32_t window = sick::data_processing::UDPPacketMerger::DEFAULT_IDENTIFICATION_WINDOW;
+  m_merger.setEvictionPolicy(2 * window, boost::posix_time::milliseconds(500));
+  m_decoder.setBlocks(sick::SensorDataFeatures::GENERAL_SYSTEM_STATE |
+                      sick::SensorDataFeatures::APPLICATION_DATA);
+  std::vector<sick::datastructure::PacketBuffer> first =
+    tools::createDatagrams(tools::createTelegram(2751, sick::SensorDataFeatures::ALL, 1), 10);
+  std::vector<sick::datastructure::PacketBuffer> second = tools::createDatagrams(
+    tools::createTelegram(2751, sick::SensorDataFeatures::ALL, 2), 10 + window + 4);
+
+  EXPECT_TRUE(addDatagrams({first.front()}).empty());
+  first.erase(first.begin());
+  EXPECT_EQ(std::vector<uint32_t>{2}, addDatagrams(second));
+  EXPECT_EQ(std::vector<uint32_t>{1}, addDatagrams(first));
+  EXPECT_EQ(2u, m_merger.getCounters().completed_packets);
+}
+
+} // namespace tests
+} // namespace sick
@@ -0,0 +1,159 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+
+//----------------------------------------------------------------------
+/*!
+ * \file TestUDPPacketMerger.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "SyntheticTelegrams.h"
+
+#include "sick_safetyscanners_base/data_processing/UDPPacketMerger.h"
+
+#include <gtest/gtest.h>
+
+namespace sick {
+namespace tests {
+
+namespace {
+
+// Adds the datagrams and returns the number of data packets which were completed.
+std::size_t addDatagrams(sick::data_processing::UDPPacketMerger& merger,
+                         const std::vector<sick::datastructure::PacketBuffer>& datagrams)
+{
+  std::size_t completed = 0;
+  for (const auto& datagram : datagrams)
+  {
+    if (merger.addUDPPacket(datagram))
+    {
+      merger.getDeployedPacketBuffer();
+      completed++;
+    }
+  }
+  return completed;
+}
+
+} // namespace
+
+TEST(UDPPacketMergerTest, ResyncsWhenTheIdentificationJumpsBack)
+{
+  std::vector<uint8_t> telegram = tools::createTelegram(2751, sick::SensorDataFeatures::ALL, 1);
+  sick::data_processing::UDPPacketMerger merger;
+
+  EXPECT_EQ(1u, addDatagrams(merger, tools::createDatagrams(telegram, 1000)));
+  EXPECT_EQ(1u, addDatagrams(merger, tools::createDatagrams(telegram, 500)));
+  EXPECT_EQ(1u, addDatagrams(merger, tools::createDatagrams(telegram, 501)));
+  EXPECT_EQ(0u, merger.getCounters().late_fragments);
+}
+
+TEST(UDPPacketMergerTest, SkipsLateFragmentsOfAnEvictedPacket)
+{
+  // Few fragments per packet, a longer run of late fragments would be taken as a restart.
+  std::vector<uint8_t> telegram = tools::createTelegram(541, sick::SensorDataFeatures::ALL, 1);
+  std::vector<sick::datastructure::PacketBuffer> old_datagrams =
+    tools::createDatagrams(telegram, 100);
+  sick::data_processing::UDPPacketMerger merger;
+
+  // The first fragment of packet 100 arrives in time, the others only after packet 120.
+  EXPECT_EQ(0u, addDatagrams(merger, {old_datagrams.front()}));
+  EXPECT_EQ(1u, addDatagrams(merger, tools::createDatagrams(telegram, 120)));
+  old_datagrams.erase(old_datagrams.begin());
+  EXPECT_EQ(0u, addDatagrams(merger, old_datagrams));
+  ASSERT_LT(old_datagrams.size(), 8u);
+  EXPECT_EQ(old_datagrams.size(), merger.getCounters().late_fragments);
+  EXPECT_EQ(1u, addDatagrams(merger, tools::createDatagrams(telegram, 121)));
+}
+
+TEST(UDPPacketMergerTest, ResyncsAfterARunOfLateFragments)
+{
+  std::vector<uint8_t> telegram = tools::createTelegram(2751, sick::SensorDataFeatures::ALL, 1);
+  std::vector<sick::datastructure::PacketBuffer> datagrams = tools::createDatagrams(telegram, 500);
+  sick::data_processing::UDPPacketMerger merger;
+
+  EXPECT_EQ(1u, addDatagrams(merger, tools::createDatagrams(telegram, 1000)));
+  // Without the first fragment packet 500 cannot complete, but the merger follows it.
+  datagrams.erase(datagrams.begin());
+  EXPECT_EQ(0u, addDatagrams(merger, datagrams));
+  EXPECT_EQ(1u, addDatagrams(merger, tools::createDatagrams(telegram, 501)));
+}
+
+TEST(UDPPacketMergerTest, SkipsFragmentsOverlappingWithAnotherLength)
+{
+  std::vector<sick::datastructure::PacketBuffer> datagrams =
+    tools::createDatagrams(tools::createTelegram(2751, sick::SensorDataFeatures::ALL, 1), 1);
+  sick::data_processing::UDPPacketMerger merger;
+  // The first fragment again, but truncated
+  const std::size_t truncated_length = sick::datastructure::DatagramHeader::HEADER_SIZE + 100;
+  sick::datastructure::PacketBuffer truncated(datagrams.front().getBuffer(), truncated_length);
+
+  EXPECT_EQ(0u, addDatagrams(merger, {datagrams.front(), datagrams.front(), truncated}));
+  EXPECT_EQ(1u, merger.getCounters().duplicate_fragments);
+  EXPECT_EQ(1u, merger.getCounters().invalid_datagrams);
+  datagrams.erase(datagrams.begin());
+  EXPECT_EQ(1u, addDatagrams(merger, datagrams));
+}
+
+TEST(UDPPacketMergerTest, BoundsTheSlabsPinnedByDeployedPackets)
+{
+  std::vector<uint8_t> telegram = tools::createTelegram(541, sick::SensorDataFeatures::ALL, 1);
+  sick::data_processing::UDPPacketMerger merger;
+  const uint32_t max_slabs = sick::data_processing::UDPPacketMerger::DEFAULT_IDENTIFICATION_WINDOW +
+                             1 + sick::data_processing::UDPPacketMerger::MAX_PINNED_SLABS;
+  const uint32_t num_packets = max_slabs + 5;
+
+  std::vector<sick::datastructure::PacketBuffer> deployed;
+  for (uint32_t identification = 0; identification < num_packets; ++identification)
+  {
+    for (const auto& datagram : tools::createDatagrams(telegram, identification))
+    {
+      if (merger.addUDPPacket(datagram))
+      {
+        deployed.push_back(merger.getDeployedPacketBuffer());
+      }
+    }
+  }
+  ASSERT_EQ(num_packets, deployed.size());
+  sick::datastructure::StreamCounters counters = merger.getCounters();
+  EXPECT_EQ(max_slabs, counters.pinned_slabs);
+  EXPECT_EQ(num_packets - max_slabs, counters.detached_slabs);
+  EXPECT_GE(max_slabs * telegram.size(), counters.reserved_bytes);
+  for (uint32_t i = 0; i < num_packets; ++i)
+  {
+    EXPECT_EQ(telegram, *deployed[i].getBuffer());
+  }
+
+  // The merger keeps the latest deployed packet itself.
+  deployed.clear();
+  EXPECT_EQ(1u, merger.getCounters().pinned_slabs);
+  EXPECT_EQ(1u, addDatagrams(merger, tools::createDatagrams(telegram, num_packets)));
+  EXPECT_EQ(num_packets - max_slabs, merger.getCounters().detached_slabs);
+}
+
+} // namespace tests
+} // namespace sick
@@ -0,0 +1,201 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file SyntheticTelegrams.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_TOOLS_SYNTHETICTELEGRAMS_H
+#define SICK_SAFETYSCANNERS_BASE_TOOLS_SYNTHETICTELEGRAMS_H
+
+#include "sick_safetyscanners_base/Types.h"
+#include "sick_safetyscanners_base/data_processing/ParseData.h"
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+#include "sick_safetyscanners_base/datastructure/Data.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace sick {
+namespace tools {
+
+/*!
+ * \brief Payload of a single datagram, the sensor fragments telegrams to fit the Ethernet MTU.
+ */
+const std::size_t MAX_DATAGRAM_PAYLOAD = 1460 - 24;
+
+const std::size_t DATA_HEADER_SIZE          = 64;
+const std::size_t GENERAL_SYSTEM_STATE_SIZE = 16;
+const std::size_t DERIVED_VALUES_SIZE       = 40;
+const std::size_t APPLICATION_DATA_SIZE     = 268;
+const std::size_t NUMBER_OF_CUT_OFF_PATHS   = 24;
+
+/*!
+ * \brief Creates a sensor data telegram as it is reassembled from the datagrams of a scan.
+ *
+ * \param number_of_beams The number of beams of the measurement and intrusion data.
+ * \param features The blocks contained in the telegram, see sick::SensorDataFeatures.
+ * \param scan_number The scan number of the telegram.
+ *
+ * \returns The telegram.
+ */
+inline std::vector<uint8_t> createTelegram(uint16_t number_of_beams,
+                                           sick::types::SensorFeatures features,
+                                           uint32_t scan_number)
+{
+  using namespace sick::read_write_helper;
+  std::size_t measurement_size = 4 + 4 * number_of_beams;
+  std::size_t flag_bytes       = (number_of_beams + 7) / 8;
+  std::size_t intrusion_size   = NUMBER_OF_CUT_OFF_PATHS * (4 + flag_bytes);
+
+  // Offset and size of every block in the order of the data header.
+  struct Block
+  {
+    uint16_t feature;
+    std::size_t size;
+    std::size_t offset;
+  } blocks[] = {{sick::SensorDataFeatures::GENERAL_SYSTEM_STATE, GENERAL_SYSTEM_STATE_SIZE, 0},
+                {sick::SensorDataFeatures::DERIVED_SETTINGS, DERIVED_VALUES_SIZE, 0},
+                {sick::SensorDataFeatures::MEASUREMENT_DATA, measurement_size, 0},
+                {sick::SensorDataFeatures::INTRUSION_DATA, intrusion_size, 0},
+                {sick::SensorDataFeatures::APPLICATION_DATA, APPLICATION_DATA_SIZE, 0}};
+  std::size_t size = DATA_HEADER_SIZE;
+  for (Block& block : blocks)
+  {
+    if (features & block.feature)
+    {
+      block.offset = size;
+      size += block.size;
+    }
+    else
+    {
+      block.size = 0;
+    }
+  }
+
+  std::vector<uint8_t> telegram(size, 0);
+  std::vector<uint8_t>::iterator it = telegram.begin();
+  writeUint32LittleEndian(it + 16, scan_number);
+  writeUint32LittleEndian(it + 20, scan_number);
+  for (std::size_t i = 0; i < 5; i++)
+  {
+    writeUint16LittleEndian(it + 32 + 4 * i, blocks[i].offset);
+    writeUint16LittleEndian(it + 34 + 4 * i, blocks[i].size);
+  }
+
+  if (blocks[0].size > 0)
+  {
+    telegram[blocks[0].offset]     = 0x05;
+    telegram[blocks[0].offset + 1] = 0xAA;
+  }
+  if (blocks[1].size > 0)
+  {
+    std::size_t offset = blocks[1].offset;
+    writeUint16LittleEndian(it + offset, 1);
+    writeUint16LittleEndian(it + offset + 2, number_of_beams);
+    writeUint16LittleEndian(it + offset + 4, 40);
+    writeInt32LittleEndian(it + offset + 8, static_cast<int32_t>(-137.5 * 4194304.0));
+    writeInt32LittleEndian(it + offset + 12, static_cast<int32_t>(0.1 * 4194304.0));
+    writeUint32LittleEndian(it + offset + 16, 74);
+  }
+  if (blocks[2].size > 0)
+  {
+    std::size_t offset = blocks[2].offset;
+    writeUint32LittleEndian(it + offset, number_of_beams);
+    for (std::size_t i = 0; i < number_of_beams; i++)
+    {
+      writeUint16LittleEndian(it + offset + 4 + 4 * i, 1000 + i % 4000);
+      telegram[offset + 6 + 4 * i] = i & 0xFF;
+      telegram[offset + 7 + 4 * i] = i & 0x3F;
+    }
+  }
+  if (blocks[3].size > 0)
+  {
+    std::size_t offset = blocks[3].offset;
+    for (std::size_t path = 0; path < NUMBER_OF_CUT_OFF_PATHS; path++)
+    {
+      writeUint32LittleEndian(it + offset, flag_bytes);
+      offset += 4;
+      for (std::size_t i = 0; i < flag_bytes; i++)
+      {
+        telegram[offset + i] = (path * 7 + i) & 0xFF;
+      }
+      offset += flag_bytes;
+    }
+  }
+  return telegram;
+}
+
+/*!
+ * \brief Creates a telegram with all blocks and parses it, e.g. as input of the consumers of scans.
+ *
+ * \param number_of_beams The number of beams of the measurement and intrusion data.
+ *
+ * \returns The parsed data.
+ */
+inline sick::datastructure::Data parsedTelegram(uint16_t number_of_beams)
+{
+  sick::datastructure::PacketBuffer buffer(
+    createTelegram(number_of_beams, sick::SensorDataFeatures::ALL, 1));
+  sick::datastructure::Data data;
+  sick::data_processing::ParseData().parseUDPSequence(buffer, data);
+  return data;
+}
+
+/*!
+ * \brief Splits a telegram into the datagrams the sensor sends, each with a datagram header.
+ *
+ * \param telegram The telegram to split.
+ * \param identification The identification of the telegram shared by all its datagrams.
+ *
+ * \returns The datagrams in the order they are sent.
+ */
+inline std::vector<sick::datastructure::PacketBuffer>
+createDatagrams(const std::vector<uint8_t>& telegram, uint32_t identification)
+{
+  using namespace sick::read_write_helper;
+  std::vector<sick::datastructure::PacketBuffer> datagrams;
+  for (std::size_t offset = 0; offset < telegram.size(); offset += MAX_DATAGRAM_PAYLOAD)
+  {
+    std::size_t length = std::min(MAX_DATAGRAM_PAYLOAD, telegram.size() - offset);
+    std::vector<uint8_t> datagram(24 + length, 0);
+    writeUint32LittleEndian(datagram.begin() + 8, telegram.size());
+    writeUint32LittleEndian(datagram.begin() + 12, identification);
+    writeUint32LittleEndian(datagram.begin() + 16, offset);
+    std::copy(telegram.begin() + offset, telegram.begin() + offset + length, datagram.begin() + 24);
+    datagrams.push_back(sick::datastructure::PacketBuffer(datagram));
+  }
+  return datagrams;
+}
+
+} // namespace tools
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_TOOLS_SYNTHETICTELEGRAMS_H
@@ -0,0 +1,596 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file SensorEmulator.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "emulator/SensorEmulator.h"
+
+#include "SyntheticTelegrams.h"
+#include "sick_safetyscanners_base/Logging.h"
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+
+namespace sick {
+namespace tools {
+
+namespace {
+
+const uint32_t TELEGRAM_STX          = 0x02020202;
+const std::size_t HEADER_SIZE        = 8;
+const std::size_t REQUEST_DATA_BEGIN = 18;
+const std::size_t REPLY_HEADER_SIZE  = 20;
+const std::size_t MAX_TELEGRAM_SIZE  = 1 << 20;
+
+//! Reply payloads are padded, the parsers of the driver read fixed size structures.
+const std::size_t MIN_REPLY_SIZE = 512;
+
+const uint16_t NUMBER_OF_FIELD_POINTS = 551;
+
+//! Days between 1970-01-01 and the sensor epoch 1972-01-01.
+const int64_t SENSOR_EPOCH_DAYS = 730;
+
+const uint16_t METHOD_CHANGE_COMM_SETTINGS = 0x00b0;
+
+enum VariableIndex
+{
+  SERIAL_NUMBER                = 3,
+  FIRMWARE_VERSION             = 4,
+  TYPE_CODE                    = 13,
+  ORDER_NUMBER                 = 14,
+  DEVICE_STATUS                = 15,
+  REQUIRED_USER_ACTION         = 16,
+  DEVICE_NAME                  = 17,
+  PROJECT_NAME                 = 18,
+  STATUS_OVERVIEW              = 23,
+  CONFIG_METADATA              = 28,
+  APPLICATION_NAME             = 33,
+  USER_NAME                    = 35,
+  PERSISTENT_CONFIG            = 177,
+  CURRENT_CONFIG               = 178,
+  LATEST_TELEGRAM_BEGIN        = 179,
+  LATEST_TELEGRAM_END          = 182,
+  FIELD_SETS                   = 1003,
+  MONITORING_CASE_TABLE_HEADER = 2100,
+  MONITORING_CASE_BEGIN        = 2101,
+  MONITORING_CASE_END          = 2101 + 254,
+  FIELD_HEADER_BEGIN           = 0x2710,
+  FIELD_HEADER_END             = 0x2710 + 128,
+  FIELD_GEOMETRY_BEGIN         = 0x2810,
+  FIELD_GEOMETRY_END           = 0x2810 + 128
+};
+
+void writeString16(std::vector<uint8_t>& payload, const std::string& value)
+{
+  read_write_helper::writeUint16LittleEndian(payload.begin(), value.size());
+  std::copy(value.begin(), value.end(), payload.begin() + 2);
+}
+
+void writeString32(std::vector<uint8_t>& payload, std::size_t offset, const std::string& value)
+{
+  read_write_helper::writeUint32LittleEndian(payload.begin() + offset, value.size());
+  std::copy(value.begin(), value.end(), payload.begin() + offset + 4);
+}
+
+void writeMeasurementConfig(std::vector<uint8_t>& payload, const std::vector<uint8_t>& settings)
+{
+  if (settings.empty())
+  {
+    payload[0] = 1;
+    payload[4] = 1;
+    read_write_helper::writeUint16LittleEndian(payload.begin() + 14, 1);
+    read_write_helper::writeInt32LittleEndian(payload.begin() + 16,
+                                              static_cast<int32_t>(-137.5 * 4194304.0));
+    read_write_helper::writeInt32LittleEndian(payload.begin() + 20,
+                                              static_cast<int32_t>(137.5 * 4194304.0));
+    read_write_helper::writeUint16LittleEndian(payload.begin() + 24,
+                                               sick::SensorDataFeatures::ALL);
+    return;
+  }
+  std::copy(settings.begin(), settings.end(), payload.begin());
+}
+
+uint32_t checksum(const std::string& value)
+{
+  // FNV-1a, stable across runs so that cached configurations of the driver stay valid.
+  uint32_t hash = 2166136261u;
+  for (char c : value)
+  {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+} // namespace
+
+/*!
+ * \brief A COLA2 connection of a client, replies to every request telegram in order.
+ */
+class SensorEmulator::Connection : public std::enable_shared_from_this<SensorEmulator::Connection>
+{
+public:
+  Connection(SensorEmulator& emulator, boost::asio::io_service& io_service)
+    : m_emulator(emulator)
+    , m_socket(io_service)
+  {
+  }
+
+  boost::asio::ip::tcp::socket& getSocket() { return m_socket; }
+
+  void start()
+  {
+    boost::system::error_code ec;
+    m_peer_address = m_socket.remote_endpoint(ec).address();
+    readHeader();
+  }
+
+private:
+  SensorEmulator& m_emulator;
+  boost::asio::ip::tcp::socket m_socket;
+  boost::asio::ip::address m_peer_address;
+  std::vector<uint8_t> m_request;
+  std::vector<uint8_t> m_reply;
+
+  void readHeader()
+  {
+    m_request.resize(HEADER_SIZE);
+    std::shared_ptr<Connection> self = shared_from_this();
+    boost::asio::async_read(m_socket,
+                            boost::asio::buffer(m_request),
+                            [self](const boost::system::error_code& ec, std::size_t) {
+                              if (!ec)
+                              {
+                                self->readBody();
+                              }
+                            });
+  }
+
+  void readBody()
+  {
+    std::vector<uint8_t>::const_iterator data_ptr = m_request.begin();
+    uint32_t length = read_write_helper::readUint32BigEndian(data_ptr + 4);
+    // A telegram without the request header, e.g. of zero length, cannot be answered.
+    if (read_write_helper::readUint32BigEndian(data_ptr + 0) != TELEGRAM_STX ||
+        length < REQUEST_DATA_BEGIN - HEADER_SIZE || length > MAX_TELEGRAM_SIZE)
+    {
+      LOG_WARN("Emulator received an invalid telegram, closing connection.");
+      return;
+    }
+    m_request.resize(HEADER_SIZE + length);
+    std::shared_ptr<Connection> self = shared_from_this();
+    boost::asio::async_read(m_socket,
+                            boost::asio::buffer(m_request.data() + HEADER_SIZE, length),
+                            [self](const boost::system::error_code& ec, std::size_t) {
+                              if (!ec)
+                              {
+                                self->reply();
+                              }
+                            });
+  }
+
+  void reply()
+  {
+    m_reply = m_emulator.handleTelegram(m_request, m_peer_address);
+    if (m_reply.empty())
+    {
+      return;
+    }
+    std::shared_ptr<Connection> self = shared_from_this();
+    boost::asio::async_write(m_socket,
+                             boost::asio::buffer(m_reply),
+                             [self](const boost::system::error_code& ec, std::size_t) {
+                               if (!ec)
+                               {
+                                 self->readHeader();
+                               }
+                             });
+  }
+};
+
+EmulatorSettings::EmulatorSettings()
+  : sensor_ip(boost::asio::ip::address_v4::loopback())
+  , tcp_port(2122)
+  , scan_rate(25.0)
+  , number_of_beams(2751)
+  , number_of_fields(4)
+  , number_of_monitoring_cases(4)
+  , drop_probability(0.0)
+  , drop_every(0)
+  , duplicate_probability(0.0)
+  , reverse_fragments(false)
+  , seed(0)
+{
+}
+
+SensorEmulator::SensorEmulator(boost::asio::io_service& io_service,
+                               const EmulatorSettings& settings)
+  : m_io_service(io_service)
+  , m_settings(settings)
+  , m_acceptor(io_service,
+               boost::asio::ip::tcp::endpoint(settings.sensor_ip, settings.tcp_port))
+  , m_udp_socket(io_service,
+                 boost::asio::ip::udp::endpoint(settings.sensor_ip, 0))
+  , m_publish_timer(io_service)
+  , m_random(settings.seed)
+  , m_is_stopped(false)
+  , m_next_session_id(1)
+  , m_scan_number(0)
+  , m_datagram_count(0)
+  , m_counters()
+  , m_telegram_features(0)
+{
+  m_publish_settings.enabled              = false;
+  m_publish_settings.publishing_frequency = 1;
+  m_publish_settings.features             = sick::SensorDataFeatures::ALL;
+  startAccept();
+}
+
+SensorEmulator::~SensorEmulator()
+{
+  stop();
+}
+
+void SensorEmulator::stop()
+{
+  if (m_is_stopped.exchange(true))
+  {
+    return;
+  }
+  boost::system::error_code ec;
+  m_acceptor.close(ec);
+  m_publish_timer.cancel(ec);
+}
+
+EmulatorCounters SensorEmulator::getCounters() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_counters;
+}
+
+void SensorEmulator::startAccept()
+{
+  std::shared_ptr<Connection> connection = std::make_shared<Connection>(*this, m_io_service);
+  m_acceptor.async_accept(connection->getSocket(),
+                          [this, connection](const boost::system::error_code& ec) {
+                            if (ec || m_is_stopped)
+                            {
+                              return;
+                            }
+                            connection->start();
+                            startAccept();
+                          });
+}
+
+std::vector<uint8_t> SensorEmulator::handleTelegram(const std::vector<uint8_t>& request,
+                                                    const boost::asio::ip::address& peer_address)
+{
+  if (request.size() < REQUEST_DATA_BEGIN)
+  {
+    return std::vector<uint8_t>();
+  }
+  std::vector<uint8_t>::const_iterator request_ptr = request.begin();
+  uint32_t session_id = read_write_helper::readUint32BigEndian(request_ptr + 10);
+  uint8_t type        = request[16];
+  uint8_t mode        = request[17];
+
+  std::vector<uint8_t> payload;
+  uint8_t reply_type = type;
+  uint8_t reply_mode = 'A';
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_counters.commands++;
+  }
+
+  if (type == 'O' && mode == 'X')
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    session_id = m_next_session_id++;
+    m_counters.sessions++;
+  }
+  else if (type == 'C' && mode == 'X')
+  {
+  }
+  else if (type == 'R' && mode == 'I' && request.size() >= REQUEST_DATA_BEGIN + 2)
+  {
+    payload = readVariable(read_write_helper::readUint16LittleEndian(request_ptr + 18));
+  }
+  else if (type == 'M' && mode == 'I' && request.size() >= REQUEST_DATA_BEGIN + 2)
+  {
+    reply_type = 'A';
+    reply_mode = 'I';
+    uint16_t method = read_write_helper::readUint16LittleEndian(request_ptr + 18);
+    if (method == METHOD_CHANGE_COMM_SETTINGS && request.size() >= REQUEST_DATA_BEGIN + 2 + 28)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      changeCommSettings(std::vector<uint8_t>(request_ptr + 20, request_ptr + 48), peer_address);
+    }
+    payload.assign(4, 0);
+  }
+  else
+  {
+    LOG_WARN("Emulator received unsupported command %c%c.", type, mode);
+    reply_mode = 'N';
+  }
+
+  std::vector<uint8_t> reply(REPLY_HEADER_SIZE + payload.size(), 0);
+  std::vector<uint8_t>::iterator reply_ptr = reply.begin();
+  read_write_helper::writeUint32BigEndian(reply_ptr + 0, TELEGRAM_STX);
+  read_write_helper::writeUint32BigEndian(reply_ptr + 4, reply.size() - HEADER_SIZE);
+  reply[8] = request[8];
+  reply[9] = request[9];
+  read_write_helper::writeUint32BigEndian(reply_ptr + 10, session_id);
+  reply[14] = request[14];
+  reply[15] = request[15];
+  reply[16] = reply_type;
+  reply[17] = reply_mode;
+  std::copy(payload.begin(), payload.end(), reply_ptr + REPLY_HEADER_SIZE);
+  return reply;
+}
+
+std::vector<uint8_t> SensorEmulator::readVariable(uint16_t index)
+{
+  std::vector<uint8_t> payload(MIN_REPLY_SIZE, 0);
+  std::string port_suffix = std::to_string(m_settings.tcp_port);
+  std::string serial      = "2026" + m_settings.sensor_ip.to_string() + ":" + port_suffix;
+  serial.erase(std::remove(serial.begin(), serial.end(), '.'), serial.end());
+
+  switch (index)
+  {
+    case SERIAL_NUMBER:
+      writeString16(payload, serial);
+      break;
+    case FIRMWARE_VERSION:
+      writeString16(payload, "V1.0.0");
+      break;
+    case TYPE_CODE:
+      writeString16(payload, "V300P-111990ZA00");
+      break;
+    case ORDER_NUMBER:
+      writeString16(payload, "1234567");
+      break;
+    case DEVICE_NAME:
+      writeString16(payload, "Emulator");
+      break;
+    case PROJECT_NAME:
+      writeString16(payload, "Loopback");
+      break;
+    case USER_NAME:
+    case APPLICATION_NAME:
+      payload[0] = 'V';
+      payload[1] = 1;
+      writeString32(payload, 4, index == USER_NAME ? "emulator" : "Loopback application");
+      break;
+    case CONFIG_METADATA:
+    {
+      std::string config = std::to_string(m_settings.number_of_fields) + "/" +
+                           std::to_string(m_settings.number_of_monitoring_cases);
+      payload[0] = 'V';
+      payload[1] = 1;
+      read_write_helper::writeUint32LittleEndian(payload.begin() + 36, checksum("app" + config));
+      read_write_helper::writeUint32LittleEndian(payload.begin() + 52, checksum("all" + config));
+      for (std::size_t i = 0; i < 4; i++)
+      {
+        read_write_helper::writeUint32LittleEndian(payload.begin() + 68 + 4 * i,
+                                                   checksum(config + std::to_string(i)));
+      }
+      break;
+    }
+    case PERSISTENT_CONFIG:
+    case CURRENT_CONFIG:
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      writeMeasurementConfig(payload, m_publish_settings.raw_settings);
+      break;
+    }
+    case FIELD_SETS:
+    case MONITORING_CASE_TABLE_HEADER:
+    case DEVICE_STATUS:
+    case REQUIRED_USER_ACTION:
+    case STATUS_OVERVIEW:
+      payload[0] = 'V';
+      payload[1] = 1;
+      break;
+    default:
+      if (index >= LATEST_TELEGRAM_BEGIN && index <= LATEST_TELEGRAM_END)
+      {
+        uint32_t scan_number = 0;
+        {
+          // Incremented by the publishing thread
+          std::lock_guard<std::mutex> lock(m_mutex);
+          scan_number = m_scan_number;
+        }
+        payload =
+          createTelegram(m_settings.number_of_beams, sick::SensorDataFeatures::ALL, scan_number);
+        payload.resize(std::max(payload.size(), MIN_REPLY_SIZE), 0);
+      }
+      else if (index >= FIELD_HEADER_BEGIN && index < FIELD_HEADER_END)
+      {
+        uint16_t field = index - FIELD_HEADER_BEGIN;
+        if (field > m_settings.number_of_fields)
+        {
+          break;
+        }
+        payload[0]  = 'R';
+        payload[72] = 1;
+        // The contour field at index 0 is followed by alternating protective and warning fields.
+        payload[73] = field == 0 ? 0 : (field % 2 == 1 ? 4 : 5);
+        read_write_helper::writeUint16LittleEndian(payload.begin() + 74, 2);
+        read_write_helper::writeUint16LittleEndian(payload.begin() + 78, 70);
+        read_write_helper::writeUint16LittleEndian(payload.begin() + 82, (field + 1) / 2);
+        writeString32(payload, 84, "Field " + std::to_string(field));
+      }
+      else if (index >= FIELD_GEOMETRY_BEGIN && index < FIELD_GEOMETRY_END)
+      {
+        uint16_t field = index - FIELD_GEOMETRY_BEGIN;
+        payload.resize(std::max<std::size_t>(MIN_REPLY_SIZE, 8 + 2 * NUMBER_OF_FIELD_POINTS), 0);
+        read_write_helper::writeUint32LittleEndian(payload.begin() + 4, NUMBER_OF_FIELD_POINTS);
+        for (std::size_t i = 0; i < NUMBER_OF_FIELD_POINTS; i++)
+        {
+          read_write_helper::writeUint16LittleEndian(payload.begin() + 8 + 2 * i,
+                                                     500 + 250 * field + i % 100);
+        }
+      }
+      else if (index >= MONITORING_CASE_BEGIN && index < MONITORING_CASE_END)
+      {
+        uint16_t monitoring_case = index - MONITORING_CASE_BEGIN;
+        if (monitoring_case >= m_settings.number_of_monitoring_cases)
+        {
+          break;
+        }
+        payload[0] = 'R';
+        read_write_helper::writeUint16LittleEndian(payload.begin() + 6, monitoring_case);
+        for (std::size_t k = 0; k < 2 && 2 * monitoring_case + k < m_settings.number_of_fields;
+             k++)
+        {
+          payload[157 + 4 * k] = 1;
+          read_write_helper::writeUint16LittleEndian(payload.begin() + 158 + 4 * k,
+                                                     1 + 2 * monitoring_case + k);
+        }
+      }
+      break;
+  }
+  return payload;
+}
+
+void SensorEmulator::changeCommSettings(const std::vector<uint8_t>& settings,
+                                        const boost::asio::ip::address& peer_address)
+{
+  std::vector<uint8_t>::const_iterator data_ptr = settings.begin();
+  bool enabled       = settings[4] != 0;
+  uint32_t host_ip   = read_write_helper::readUint32LittleEndian(data_ptr + 8);
+  uint16_t host_port = read_write_helper::readUint16LittleEndian(data_ptr + 12);
+
+  boost::asio::ip::address address = boost::asio::ip::address_v4(host_ip);
+  if (host_ip == 0 && !peer_address.is_unspecified())
+  {
+    address = peer_address;
+  }
+
+  m_publish_settings.raw_settings         = settings;
+  m_publish_settings.endpoint             = boost::asio::ip::udp::endpoint(address, host_port);
+  m_publish_settings.publishing_frequency =
+    std::max<uint16_t>(1, read_write_helper::readUint16LittleEndian(data_ptr + 14));
+  m_publish_settings.features = read_write_helper::readUint16LittleEndian(data_ptr + 24);
+
+  LOG_INFO("Emulator at %s publishes to %s:%u.",
+           m_settings.sensor_ip.to_string().c_str(),
+           address.to_string().c_str(),
+           host_port);
+
+  bool was_enabled           = m_publish_settings.enabled;
+  m_publish_settings.enabled = enabled && host_port != 0;
+  if (m_publish_settings.enabled && !was_enabled)
+  {
+    m_next_publish_time = boost::posix_time::microsec_clock::universal_time();
+    schedulePublish();
+  }
+}
+
+void SensorEmulator::schedulePublish()
+{
+  double period = m_publish_settings.publishing_frequency / std::max(m_settings.scan_rate, 0.001);
+  m_next_publish_time += boost::posix_time::microseconds(static_cast<int64_t>(period * 1e6));
+  m_publish_timer.expires_at(m_next_publish_time);
+  m_publish_timer.async_wait([this](const boost::system::error_code& ec) {
+    if (ec || m_is_stopped)
+    {
+      return;
+    }
+    publishScan();
+  });
+}
+
+void SensorEmulator::publishScan()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_publish_settings.enabled)
+  {
+    return;
+  }
+  if (m_telegram.empty() || m_telegram_features != m_publish_settings.features)
+  {
+    m_telegram_features = m_publish_settings.features;
+    m_telegram = createTelegram(m_settings.number_of_beams, m_telegram_features, 0);
+  }
+
+  m_scan_number++;
+  int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                     std::chrono::system_clock::now().time_since_epoch())
+                     .count();
+  std::vector<uint8_t>::iterator it = m_telegram.begin();
+  read_write_helper::writeUint32LittleEndian(it + 16, m_scan_number);
+  read_write_helper::writeUint32LittleEndian(it + 20, m_scan_number);
+  read_write_helper::writeUint16LittleEndian(it + 24, now_ms / 86400000 - SENSOR_EPOCH_DAYS);
+  read_write_helper::writeUint32LittleEndian(it + 28, now_ms % 86400000);
+
+  std::vector<sick::datastructure::PacketBuffer> datagrams =
+    createDatagrams(m_telegram, m_scan_number);
+  if (m_settings.reverse_fragments)
+  {
+    std::reverse(datagrams.begin(), datagrams.end());
+  }
+
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  for (const sick::datastructure::PacketBuffer& datagram : datagrams)
+  {
+    m_datagram_count++;
+    if ((m_settings.drop_every > 0 && m_datagram_count % m_settings.drop_every == 0) ||
+        distribution(m_random) < m_settings.drop_probability)
+    {
+      m_counters.datagrams_dropped++;
+      continue;
+    }
+    sendDatagram(*datagram.getBuffer());
+    if (distribution(m_random) < m_settings.duplicate_probability)
+    {
+      m_counters.datagrams_duplicated++;
+      sendDatagram(*datagram.getBuffer());
+    }
+  }
+  m_counters.scans++;
+  schedulePublish();
+}
+
+void SensorEmulator::sendDatagram(const std::vector<uint8_t>& datagram)
+{
+  boost::system::error_code ec;
+  m_udp_socket.send_to(boost::asio::buffer(datagram), m_publish_settings.endpoint, 0, ec);
+  if (!ec)
+  {
+    m_counters.datagrams_sent++;
+  }
+}
+
+} // namespace tools
+} // namespace sick
@@ -0,0 +1,179 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file SensorEmulator.h
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_TOOLS_EMULATOR_SENSOREMULATOR_H
+#define SICK_SAFETYSCANNERS_BASE_TOOLS_EMULATOR_SENSOREMULATOR_H
+
+#include "sick_safetyscanners_base/Types.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+namespace sick {
+namespace tools {
+
+/*!
+ * \brief Behaviour of an emulated sensor.
+ */
+struct EmulatorSettings
+{
+  EmulatorSettings();
+
+  //! Address the COLA2 server of the sensor listens on.
+  sick::types::ip_address_t sensor_ip;
+  //! Port the COLA2 server of the sensor listens on.
+  sick::types::port_t tcp_port;
+  //! Number of scans per second, before applying the publishing frequency of the client.
+  double scan_rate;
+  //! Number of beams of every scan.
+  uint16_t number_of_beams;
+  //! Number of valid fields following the contour field at index 0.
+  uint16_t number_of_fields;
+  //! Number of valid monitoring cases.
+  uint16_t number_of_monitoring_cases;
+  //! Probability of dropping a datagram.
+  double drop_probability;
+  //! Drops every n-th datagram, zero to disable.
+  uint32_t drop_every;
+  //! Probability of sending a datagram twice.
+  double duplicate_probability;
+  //! Sends the datagrams of every scan in reverse order.
+  bool reverse_fragments;
+  //! Seed of the random loss and duplication pattern.
+  uint32_t seed;
+};
+
+/*!
+ * \brief Counters of an emulated sensor.
+ */
+struct EmulatorCounters
+{
+  uint64_t sessions;
+  uint64_t commands;
+  uint64_t scans;
+  uint64_t datagrams_sent;
+  uint64_t datagrams_dropped;
+  uint64_t datagrams_duplicated;
+};
+
+/*!
+ * \brief Emulates a safety scanner on the local host. It implements the COLA2 commands used by the
+ * driver to open and close sessions, read variables and change the communication settings, and
+ * publishes fragmented scan telegrams to the host configured by the client.
+ *
+ * Every scan carries the wall clock time it was sent at as its sensor timestamp, so that receivers
+ * can compute the end to end latency.
+ */
+class SensorEmulator
+{
+public:
+  SensorEmulator()                      = delete;
+  SensorEmulator(const SensorEmulator&) = delete;
+  SensorEmulator& operator=(const SensorEmulator&) = delete;
+
+  /*!
+   * \brief Constructor of the emulator, starts listening for COLA2 connections.
+   *
+   * \param io_service The io_service running all handlers of the emulator.
+   * \param settings The behaviour of the emulated sensor.
+   */
+  SensorEmulator(boost::asio::io_service& io_service, const EmulatorSettings& settings);
+
+  /*!
+   * \brief Destructor, stops the emulator.
+   */
+  ~SensorEmulator();
+
+  /*!
+   * \brief Stops accepting connections and publishing scans.
+   */
+  void stop();
+
+  /*!
+   * \brief Returns the counters of the emulator.
+   *
+   * \returns The counters.
+   */
+  EmulatorCounters getCounters() const;
+
+private:
+  class Connection;
+
+  struct PublishSettings
+  {
+    bool enabled;
+    boost::asio::ip::udp::endpoint endpoint;
+    uint16_t publishing_frequency;
+    sick::types::SensorFeatures features;
+    std::vector<uint8_t> raw_settings;
+  };
+
+  boost::asio::io_service& m_io_service;
+  EmulatorSettings m_settings;
+  boost::asio::ip::tcp::acceptor m_acceptor;
+  boost::asio::ip::udp::socket m_udp_socket;
+  boost::asio::deadline_timer m_publish_timer;
+  boost::posix_time::ptime m_next_publish_time;
+  std::mt19937 m_random;
+  std::atomic<bool> m_is_stopped;
+
+  mutable std::mutex m_mutex;
+  PublishSettings m_publish_settings;
+  uint32_t m_next_session_id;
+  uint32_t m_scan_number;
+  uint32_t m_datagram_count;
+  EmulatorCounters m_counters;
+  std::vector<uint8_t> m_telegram;
+  sick::types::SensorFeatures m_telegram_features;
+
+  void startAccept();
+  void schedulePublish();
+  void publishScan();
+  void sendDatagram(const std::vector<uint8_t>& datagram);
+
+  std::vector<uint8_t> handleTelegram(const std::vector<uint8_t>& request,
+                                      const boost::asio::ip::address& peer_address);
+  std::vector<uint8_t> readVariable(uint16_t index);
+  void changeCommSettings(const std::vector<uint8_t>& settings,
+                          const boost::asio::ip::address& peer_address);
+};
+
+} // namespace tools
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_TOOLS_EMULATOR_SENSOREMULATOR_H
@@ -0,0 +1,181 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file main.cpp
+ *
+ * \date    2026-10-17
+ */
+//----------------------------------------------------------------------
+
+#include "emulator/SensorEmulator.h"
+
+#include <algorithm>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const char* USAGE =
+  "Usage: sick_safetyscanners_base_emulator [options]\n"
+  "  --sensors N           number of sensors, bound to consecutive addresses (1)\n"
+  "  --ip ADDRESS          address of the first sensor (127.0.0.1)\n"
+  "  --port PORT           COLA2 port of every sensor (2122)\n"
+  "  --rate HZ             scans per second (25)\n"
+  "  --beams N             beams per scan (2751)\n"
+  "  --fields N            number of fields besides the contour field (4)\n"
+  "  --monitoring-cases N  number of monitoring cases (4)\n"
+  "  --drop P              probability of dropping a datagram (0)\n"
+  "  --drop-every N        drops every n-th datagram (0)\n"
+  "  --duplicate P         probability of sending a datagram twice (0)\n"
+  "  --reverse             sends the datagrams of every scan in reverse order\n"
+  "  --seed N              seed of the loss pattern (0)\n"
+  "  --threads N           number of threads running the sensors (1)\n"
+  "  --duration S          stops after S seconds, runs until interrupted if 0 (0)\n";
+
+boost::asio::io_service* g_io_service = nullptr;
+
+void handleSignal(int)
+{
+  if (g_io_service)
+  {
+    g_io_service->stop();
+  }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  sick::tools::EmulatorSettings settings;
+  std::size_t number_of_sensors = 1;
+  std::size_t number_of_threads = 1;
+  double duration               = 0.0;
+
+  std::vector<std::string> args(argv + 1, argv + argc);
+  for (std::size_t i = 0; i < args.size(); i++)
+  {
+    const std::string& arg = args[i];
+    if (arg == "--reverse")
+    {
+      settings.reverse_fragments = true;
+      continue;
+    }
+    if (arg == "--help" || i + 1 >= args.size())
+    {
+      std::cerr << USAGE;
+      return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    const char* value = args[++i].c_str();
+    if (arg == "--sensors")
+      number_of_sensors = std::strtoul(value, nullptr, 10);
+    else if (arg == "--ip")
+      settings.sensor_ip = boost::asio::ip::address_v4::from_string(value);
+    else if (arg == "--port")
+      settings.tcp_port = std::strtoul(value, nullptr, 10);
+    else if (arg == "--rate")
+      settings.scan_rate = std::strtod(value, nullptr);
+    else if (arg == "--beams")
+      settings.number_of_beams = std::strtoul(value, nullptr, 10);
+    else if (arg == "--fields")
+      settings.number_of_fields = std::strtoul(value, nullptr, 10);
+    else if (arg == "--monitoring-cases")
+      settings.number_of_monitoring_cases = std::strtoul(value, nullptr, 10);
+    else if (arg == "--drop")
+      settings.drop_probability = std::strtod(value, nullptr);
+    else if (arg == "--drop-every")
+      settings.drop_every = std::strtoul(value, nullptr, 10);
+    else if (arg == "--duplicate")
+      settings.duplicate_probability = std::strtod(value, nullptr);
+    else if (arg == "--seed")
+      settings.seed = std::strtoul(value, nullptr, 10);
+    else if (arg == "--threads")
+      number_of_threads = std::max<std::size_t>(1, std::strtoul(value, nullptr, 10));
+    else if (arg == "--duration")
+      duration = std::strtod(value, nullptr);
+    else
+    {
+      std::cerr << "Unknown option " << arg << "\n" << USAGE;
+      return EXIT_FAILURE;
+    }
+  }
+
+  boost::asio::io_service io_service;
+  std::vector<std::unique_ptr<sick::tools::SensorEmulator> > emulators;
+  for (std::size_t i = 0; i < number_of_sensors; i++)
+  {
+    sick::tools::EmulatorSettings sensor_settings = settings;
+    sensor_settings.sensor_ip =
+      boost::asio::ip::address_v4(static_cast<uint32_t>(settings.sensor_ip.to_ulong() + i));
+    sensor_settings.seed = settings.seed + i;
+    emulators.push_back(std::unique_ptr<sick::tools::SensorEmulator>(
+      new sick::tools::SensorEmulator(io_service, sensor_settings)));
+    std::cout << "Sensor " << i << " listening on " << sensor_settings.sensor_ip << ":"
+              << sensor_settings.tcp_port << std::endl;
+  }
+
+  g_io_service = &io_service;
+  std::signal(SIGINT, handleSignal);
+  std::signal(SIGTERM, handleSignal);
+
+  boost::asio::deadline_timer stop_timer(io_service);
+  if (duration > 0.0)
+  {
+    stop_timer.expires_from_now(
+      boost::posix_time::microseconds(static_cast<int64_t>(duration * 1e6)));
+    stop_timer.async_wait([&io_service](const boost::system::error_code& ec) {
+      if (!ec)
+      {
+        io_service.stop();
+      }
+    });
+  }
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < number_of_threads; i++)
+  {
+    threads.emplace_back([&io_service]() { io_service.run(); });
+  }
+  io_service.run();
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  for (std::size_t i = 0; i < emulators.size(); i++)
+  {
+    sick::tools::EmulatorCounters counters = emulators[i]->getCounters();
+    std::cout << "Sensor " << i << ": " << counters.sessions << " sessions, " << counters.commands
+              << " commands, " << counters.scans << " scans, " << counters.datagrams_sent
+              << " datagrams sent, " << counters.datagrams_dropped << " dropped, "
+              << counters.datagrams_duplicated << " duplicated" << std::endl;
+  }
+  return EXIT_SUCCESS;
+}